@@ -27,6 +27,10 @@ void InitializeDoubleLinkedListHead(DOUBLE_LINKED_LIST_HEAD *Head)
 {
 	Head->Beginning = (DOUBLE_LINKED_LIST_NODE*)NULL;
 	Head->End = (DOUBLE_LINKED_LIST_NODE*)NULL;
+
+	#if (USING_DOUBLE_LINKED_LIST_NODE_COUNT == 1)
+		Head->NumberOfNodes = 0;
+	#endif // end of #if (USING_DOUBLE_LINKED_LIST_NODE_COUNT == 1)
 }
 
 void InitializeDoubleLinkedListNode(DOUBLE_LINKED_LIST_NODE *Node)
@@ -51,6 +55,10 @@ void InitializeDoubleLinkedListNode(DOUBLE_LINKED_LIST_NODE *Node)
 			Head->Beginning->PreviousNode = Node;
 			Head->Beginning = Node;
 		}
+
+		#if (USING_DOUBLE_LINKED_LIST_NODE_COUNT == 1)
+			Head->NumberOfNodes++;
+		#endif // end of #if (USING_DOUBLE_LINKED_LIST_NODE_COUNT == 1)
 	}
 #endif // end of #if (USING_INSERT_NODE_AT_BEGINNING_OF_DOUBLE_LINKED_LIST_METHOD == 1)
 
@@ -68,9 +76,58 @@ void InitializeDoubleLinkedListNode(DOUBLE_LINKED_LIST_NODE *Node)
             Node->PreviousNode = Head->End;
             Head->End = Head->End->NextNode = Node;
         }
+
+        #if (USING_DOUBLE_LINKED_LIST_NODE_COUNT == 1)
+            Head->NumberOfNodes++;
+        #endif // end of #if (USING_DOUBLE_LINKED_LIST_NODE_COUNT == 1)
     }
 #endif // end of #if (USING_INSERT_NODE_AT_END_OF_DOUBLE_LINKED_LIST_METHOD == 1)
 
+#if (USING_INSERT_NODE_AFTER_NODE_OF_DOUBLE_LINKED_LIST_METHOD == 1)
+    void InsertNodeAfterNodeOfDoubleLinkedList(DOUBLE_LINKED_LIST_HEAD *Head, DOUBLE_LINKED_LIST_NODE *Position, DOUBLE_LINKED_LIST_NODE *Node)
+    {
+        Node->PreviousNode = Position;
+
+        if(Position == (DOUBLE_LINKED_LIST_NODE*)NULL)
+        {
+            Node->NextNode = Head->Beginning;
+            Head->Beginning = Node;
+        }
+        else
+        {
+            Node->NextNode = Position->NextNode;
+            Position->NextNode = Node;
+        }
+
+        if(Node->NextNode == (DOUBLE_LINKED_LIST_NODE*)NULL)
+            Head->End = Node;
+        else
+            Node->NextNode->PreviousNode = Node;
+
+        #if (USING_DOUBLE_LINKED_LIST_NODE_COUNT == 1)
+            Head->NumberOfNodes++;
+        #endif // end of #if (USING_DOUBLE_LINKED_LIST_NODE_COUNT == 1)
+    }
+#endif // end of #if (USING_INSERT_NODE_AFTER_NODE_OF_DOUBLE_LINKED_LIST_METHOD == 1)
+
+#if (USING_INSERT_NODE_IN_ORDER_OF_DOUBLE_LINKED_LIST_METHOD == 1)
+    void InsertNodeInOrderOfDoubleLinkedList(DOUBLE_LINKED_LIST_HEAD *Head, DOUBLE_LINKED_LIST_NODE *Node, DOUBLE_LINKED_LIST_COMPARE Compare)
+    {
+        DOUBLE_LINKED_LIST_NODE *Position = Head->End;
+
+        // search back from the end for the last node which doesn't go after the new one
+        while(Position != (DOUBLE_LINKED_LIST_NODE*)NULL)
+        {
+            if(Compare(Node, Position) >= 0)
+                break;
+
+            Position = Position->PreviousNode;
+        }
+
+        InsertNodeAfterNodeOfDoubleLinkedList(Head, Position, Node);
+    }
+#endif // end of #if (USING_INSERT_NODE_IN_ORDER_OF_DOUBLE_LINKED_LIST_METHOD == 1)
+
 #if (USING_REMOVE_NODE_FROM_DOUBLE_LINKED_LIST_METHOD == 1)
     DOUBLE_LINKED_LIST_NODE *RemoveNodeFromDoubleLinkedList(DOUBLE_LINKED_LIST_HEAD *Head, DOUBLE_LINKED_LIST_NODE *Node)
     {
@@ -99,10 +156,81 @@ void InitializeDoubleLinkedListNode(DOUBLE_LINKED_LIST_NODE *Node)
 
         Node->NextNode = Node->PreviousNode = (DOUBLE_LINKED_LIST_NODE*)NULL;
 
+        #if (USING_DOUBLE_LINKED_LIST_NODE_COUNT == 1)
+            Head->NumberOfNodes--;
+        #endif // end of #if (USING_DOUBLE_LINKED_LIST_NODE_COUNT == 1)
+
         return Node;
     }
 #endif // end of #if (USING_REMOVE_NODE_FROM_DOUBLE_LINKED_LIST_METHOD == 1)
 
+#if (USING_DOUBLE_LINKED_LIST_SPLICE_METHODS == 1)
+    void DoubleLinkedListSplice(DOUBLE_LINKED_LIST_HEAD *Destination, DOUBLE_LINKED_LIST_NODE *Position, DOUBLE_LINKED_LIST_HEAD *Source)
+    {
+        DOUBLE_LINKED_LIST_NODE *After;
+
+        if(Source->Beginning == (DOUBLE_LINKED_LIST_NODE*)NULL)
+            return;
+
+        // find what the moved nodes will sit in front of
+        if(Position == (DOUBLE_LINKED_LIST_NODE*)NULL)
+            After = Destination->Beginning;
+        else
+            After = Position->NextNode;
+
+        Source->Beginning->PreviousNode = Position;
+        Source->End->NextNode = After;
+
+        if(Position == (DOUBLE_LINKED_LIST_NODE*)NULL)
+            Destination->Beginning = Source->Beginning;
+        else
+            Position->NextNode = Source->Beginning;
+
+        if(After == (DOUBLE_LINKED_LIST_NODE*)NULL)
+            Destination->End = Source->End;
+        else
+            After->PreviousNode = Source->End;
+
+        #if (USING_DOUBLE_LINKED_LIST_NODE_COUNT == 1)
+            Destination->NumberOfNodes += Source->NumberOfNodes;
+            Source->NumberOfNodes = 0;
+        #endif // end of #if (USING_DOUBLE_LINKED_LIST_NODE_COUNT == 1)
+
+        Source->Beginning = Source->End = (DOUBLE_LINKED_LIST_NODE*)NULL;
+    }
+
+    void DoubleLinkedListAppendList(DOUBLE_LINKED_LIST_HEAD *Destination, DOUBLE_LINKED_LIST_HEAD *Source)
+    {
+        DoubleLinkedListSplice(Destination, Destination->End, Source);
+    }
+
+    void DoubleLinkedListCut(DOUBLE_LINKED_LIST_HEAD *Source, DOUBLE_LINKED_LIST_NODE *Node, DOUBLE_LINKED_LIST_HEAD *Destination)
+    {
+        #if (USING_DOUBLE_LINKED_LIST_NODE_COUNT == 1)
+            DOUBLE_LINKED_LIST_NODE *Iterator;
+            UINT32 NodesMoved = 0;
+
+            for(Iterator = Node; Iterator != (DOUBLE_LINKED_LIST_NODE*)NULL; Iterator = Iterator->NextNode)
+                NodesMoved++;
+
+            Source->NumberOfNodes -= NodesMoved;
+            Destination->NumberOfNodes = NodesMoved;
+        #endif // end of #if (USING_DOUBLE_LINKED_LIST_NODE_COUNT == 1)
+
+        Destination->Beginning = Node;
+        Destination->End = Source->End;
+
+        Source->End = Node->PreviousNode;
+
+        if(Source->End == (DOUBLE_LINKED_LIST_NODE*)NULL)
+            Source->Beginning = (DOUBLE_LINKED_LIST_NODE*)NULL;
+        else
+            Source->End->NextNode = (DOUBLE_LINKED_LIST_NODE*)NULL;
+
+        Node->PreviousNode = (DOUBLE_LINKED_LIST_NODE*)NULL;
+    }
+#endif // end of #if (USING_DOUBLE_LINKED_LIST_SPLICE_METHODS == 1)
+
 #if (USING_DOUBLE_LINKED_LIST_HAS_DATA_METHOD == 1)
     BOOL DoubleLinkedListHasData(DOUBLE_LINKED_LIST_HEAD *Head)
     {
@@ -113,23 +241,27 @@ void InitializeDoubleLinkedListNode(DOUBLE_LINKED_LIST_NODE *Node)
 #if (USING_DOUBLE_LINKED_LIST_GET_SIZE_METHOD == 1)
 	UINT32 DoubleLinkedListGetSize(DOUBLE_LINKED_LIST_HEAD *Head)
 	{
-		UINT32 Size;
-		DOUBLE_LINKED_LIST_NODE *Iterator;
+		#if (USING_DOUBLE_LINKED_LIST_NODE_COUNT == 1)
+			return Head->NumberOfNodes;
+		#else
+			UINT32 Size;
+			DOUBLE_LINKED_LIST_NODE *Iterator;
 
-		if (Head->Beginning == (DOUBLE_LINKED_LIST_NODE*)NULL)
-			return 0;
+			if (Head->Beginning == (DOUBLE_LINKED_LIST_NODE*)NULL)
+				return 0;
 
-		Iterator = Head->Beginning;
+			Iterator = Head->Beginning;
 
-		Size = 0;
+			Size = 0;
 
-		do
-		{
-			Iterator = Iterator->NextNode;
-			Size++;
-		} while (Iterator != (DOUBLE_LINKED_LIST_NODE*)NULL);
+			do
+			{
+				Iterator = Iterator->NextNode;
+				Size++;
+			} while (Iterator != (DOUBLE_LINKED_LIST_NODE*)NULL);
 
-		return Size;
+			return Size;
+		#endif // end of #if (USING_DOUBLE_LINKED_LIST_NODE_COUNT == 1)
 	}
 #endif // end of #if (USING_DOUBLE_LINKED_LIST_GET_SIZE_METHOD == 1)
 
@@ -24,6 +24,7 @@
 	#define DOUBLE_LINKED_LIST_H
 
 #include "GenericTypes.h"
+#include "DoubleLinkedListConfig.h"
 
 /*
 	This structure is used link up tasks that are in a list.  It has a pointer
@@ -52,8 +53,24 @@ typedef struct
 {
 	DOUBLE_LINKED_LIST_NODE *Beginning;
 	DOUBLE_LINKED_LIST_NODE *End;
+
+	#if (USING_DOUBLE_LINKED_LIST_NODE_COUNT == 1)
+		// how many nodes are in the list, kept up to date by every method here
+		UINT32 NumberOfNodes;
+	#endif // end of #if (USING_DOUBLE_LINKED_LIST_NODE_COUNT == 1)
 }DOUBLE_LINKED_LIST_HEAD;
 
+/*
+	This is used to keep a double linked list in order.  It returns a negative
+	number if Node1 goes before Node2, 0 if they are equal and a positive number
+	if Node1 goes after Node2.
+*/
+typedef INT32 (*DOUBLE_LINKED_LIST_COMPARE)(DOUBLE_LINKED_LIST_NODE *Node1, DOUBLE_LINKED_LIST_NODE *Node2);
+
+#if (USING_INSERT_NODE_IN_ORDER_OF_DOUBLE_LINKED_LIST_METHOD == 1 && USING_INSERT_NODE_AFTER_NODE_OF_DOUBLE_LINKED_LIST_METHOD != 1)
+	#error "USING_INSERT_NODE_AFTER_NODE_OF_DOUBLE_LINKED_LIST_METHOD must be defined as a 1 to use USING_INSERT_NODE_IN_ORDER_OF_DOUBLE_LINKED_LIST_METHOD"
+#endif // end of #if (USING_INSERT_NODE_IN_ORDER_OF_DOUBLE_LINKED_LIST_METHOD == 1 && USING_INSERT_NODE_AFTER_NODE_OF_DOUBLE_LINKED_LIST_METHOD != 1)
+
 /*
 	void InitializeDoubleLinkedListHead(DOUBLE_LINKED_LIST_HEAD *Head)
 
@@ -156,6 +173,69 @@ void InsertNodeAtEndOfDoubleLinkedList(DOUBLE_LINKED_LIST_HEAD *Head, DOUBLE_LIN
 */
 void InsertNodeAtBeginningOfDoubleLinkedList(DOUBLE_LINKED_LIST_HEAD *Head, DOUBLE_LINKED_LIST_NODE *Node);
 
+/*
+	void InsertNodeAfterNodeOfDoubleLinkedList(DOUBLE_LINKED_LIST_HEAD *Head, DOUBLE_LINKED_LIST_NODE *Position, DOUBLE_LINKED_LIST_NODE *Node)
+
+	Description: This method adds a DOUBLE_LINKED_LIST_NODE to the specified DOUBLE_LINKED_LIST_HEAD
+    right after a node which is already in the double linked list.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		DOUBLE_LINKED_LIST_HEAD *Head - The head of double linked list to added the node to.
+
+        DOUBLE_LINKED_LIST_NODE *Position - The node already in the list to add Node after.  If
+        this is (DOUBLE_LINKED_LIST_NODE*)NULL Node is added at the beginning.
+ 
+        DOUBLE_LINKED_LIST_NODE *Node - The node of the double linked list to add to.
+ 
+	Returns:
+		- None
+
+	Notes:
+		- USING_INSERT_NODE_AFTER_NODE_OF_DOUBLE_LINKED_LIST_METHOD in DoubleLinkedListConfig.h
+          must be defined as a 1 to use this method.
+
+	See Also:
+		- InsertNodeInOrderOfDoubleLinkedList(), RemoveNodeFromDoubleLinkedList()
+*/
+void InsertNodeAfterNodeOfDoubleLinkedList(DOUBLE_LINKED_LIST_HEAD *Head, DOUBLE_LINKED_LIST_NODE *Position, DOUBLE_LINKED_LIST_NODE *Node);
+
+/*
+	void InsertNodeInOrderOfDoubleLinkedList(DOUBLE_LINKED_LIST_HEAD *Head, DOUBLE_LINKED_LIST_NODE *Node, DOUBLE_LINKED_LIST_COMPARE Compare)
+
+	Description: This method adds a DOUBLE_LINKED_LIST_NODE to a double linked list which
+    is kept in order by Compare.  The node goes after every node which does not go after it,
+    so nodes which compare equal stay in the order they were added.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		DOUBLE_LINKED_LIST_HEAD *Head - The head of double linked list to added the node to.
+ 
+        DOUBLE_LINKED_LIST_NODE *Node - The node of the double linked list to add to.
+
+        DOUBLE_LINKED_LIST_COMPARE Compare - The method which orders the nodes.
+ 
+	Returns:
+		- None
+
+	Notes:
+		- USING_INSERT_NODE_IN_ORDER_OF_DOUBLE_LINKED_LIST_METHOD in DoubleLinkedListConfig.h
+          must be defined as a 1 to use this method.
+
+        - The search starts from the end of the list, so this is quickest when new
+          nodes usually go at or near the end, like deadlines or timeouts do.
+
+	See Also:
+		- InsertNodeAfterNodeOfDoubleLinkedList()
+*/
+void InsertNodeInOrderOfDoubleLinkedList(DOUBLE_LINKED_LIST_HEAD *Head, DOUBLE_LINKED_LIST_NODE *Node, DOUBLE_LINKED_LIST_COMPARE Compare);
+
 /*
 	DOUBLE_LINKED_LIST_NODE *RemoveNodeFromDoubleLinkedList(DOUBLE_LINKED_LIST_HEAD *Head, DOUBLE_LINKED_LIST_NODE *Node)
 
@@ -181,6 +261,98 @@ void InsertNodeAtBeginningOfDoubleLinkedList(DOUBLE_LINKED_LIST_HEAD *Head, DOUB
 */
 DOUBLE_LINKED_LIST_NODE *RemoveNodeFromDoubleLinkedList(DOUBLE_LINKED_LIST_HEAD *Head, DOUBLE_LINKED_LIST_NODE *Node);
 
+/*
+	void DoubleLinkedListSplice(DOUBLE_LINKED_LIST_HEAD *Destination, DOUBLE_LINKED_LIST_NODE *Position, DOUBLE_LINKED_LIST_HEAD *Source)
+
+	Description: This method moves every node in one double linked list into another one
+    in a single step, no matter how many nodes there are.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		DOUBLE_LINKED_LIST_HEAD *Destination - The head of double linked list to move the nodes to.
+
+        DOUBLE_LINKED_LIST_NODE *Position - The node in Destination to place the nodes after.  If
+        this is (DOUBLE_LINKED_LIST_NODE*)NULL the nodes are placed at the beginning.
+ 
+        DOUBLE_LINKED_LIST_HEAD *Source - The head of double linked list to take the nodes from.
+        This is left empty.
+ 
+	Returns:
+		- None
+
+	Notes:
+		- USING_DOUBLE_LINKED_LIST_SPLICE_METHODS in DoubleLinkedListConfig.h
+          must be defined as a 1 to use this method.
+
+	See Also:
+		- DoubleLinkedListAppendList(), DoubleLinkedListCut()
+*/
+void DoubleLinkedListSplice(DOUBLE_LINKED_LIST_HEAD *Destination, DOUBLE_LINKED_LIST_NODE *Position, DOUBLE_LINKED_LIST_HEAD *Source);
+
+/*
+	void DoubleLinkedListAppendList(DOUBLE_LINKED_LIST_HEAD *Destination, DOUBLE_LINKED_LIST_HEAD *Source)
+
+	Description: This method moves every node in one double linked list onto the end of
+    another one in a single step.  If Destination is empty this takes over the whole list.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		DOUBLE_LINKED_LIST_HEAD *Destination - The head of double linked list to move the nodes to.
+ 
+        DOUBLE_LINKED_LIST_HEAD *Source - The head of double linked list to take the nodes from.
+        This is left empty.
+ 
+	Returns:
+		- None
+
+	Notes:
+		- USING_DOUBLE_LINKED_LIST_SPLICE_METHODS in DoubleLinkedListConfig.h
+          must be defined as a 1 to use this method.
+
+	See Also:
+		- DoubleLinkedListSplice(), DoubleLinkedListCut()
+*/
+void DoubleLinkedListAppendList(DOUBLE_LINKED_LIST_HEAD *Destination, DOUBLE_LINKED_LIST_HEAD *Source);
+
+/*
+	void DoubleLinkedListCut(DOUBLE_LINKED_LIST_HEAD *Source, DOUBLE_LINKED_LIST_NODE *Node, DOUBLE_LINKED_LIST_HEAD *Destination)
+
+	Description: This method splits a double linked list in two.  Node and every node
+    after it are moved into Destination in a single step.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		DOUBLE_LINKED_LIST_HEAD *Source - The head of double linked list to split.
+
+        DOUBLE_LINKED_LIST_NODE *Node - The first node in Source to move.
+ 
+        DOUBLE_LINKED_LIST_HEAD *Destination - The head of double linked list which will hold
+        the moved nodes.  Anything it held before is forgotten, so it should be empty.
+ 
+	Returns:
+		- None
+
+	Notes:
+		- USING_DOUBLE_LINKED_LIST_SPLICE_METHODS in DoubleLinkedListConfig.h
+          must be defined as a 1 to use this method.
+
+        - If USING_DOUBLE_LINKED_LIST_NODE_COUNT is defined as a 1 the moved nodes
+          have to be counted, so this method then walks from Node to the end.
+
+	See Also:
+		- DoubleLinkedListSplice(), DoubleLinkedListAppendList()
+*/
+void DoubleLinkedListCut(DOUBLE_LINKED_LIST_HEAD *Source, DOUBLE_LINKED_LIST_NODE *Node, DOUBLE_LINKED_LIST_HEAD *Destination);
+
 /*
 	BOOL DoubleLinkedListHasData(DOUBLE_LINKED_LIST_HEAD *Head)
 
@@ -226,7 +398,8 @@ BOOL DoubleLinkedListHasData(DOUBLE_LINKED_LIST_HEAD *Head);
 		UINT32 - How many nodes are associated in the DOUBLE_LINKED_LIST_HEAD.
 
 	Notes:
-		- None
+		- If USING_DOUBLE_LINKED_LIST_NODE_COUNT is defined as a 1 this just returns
+          the count kept in the DOUBLE_LINKED_LIST_HEAD, otherwise every node is walked.
 
 	See Also:
 		- InsertNodeAtBeginningOfDoubleLinkedList(), InsertNodeAtEndOfDoubleLinkedList()
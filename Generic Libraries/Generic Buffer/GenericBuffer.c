@@ -24,7 +24,7 @@
 	Developer: brodie
 	Date: July 9, 2015
 	File Name: GenericBuffer.c
-	Version: 1.06
+	Version: 1.07
 	IDE: Visual Studio 2010 Professional
 	Compiler: C89
 
@@ -33,6 +33,22 @@
 	the GenericBuffer library.  For method descriptions see
 	GenericBuffer.h.
 
+	v1.07 Release Notes
+			- Added in GenericBufferGetWriteSpan(), GenericBufferCommitWrite(),
+			  GenericBufferGetReadSpan() and GenericBufferConsume().  These let the
+			  user work directly inside the GENERIC_BUFFER instead of copying through
+			  a buffer of their own.
+			- Added in the SPSC_GENERIC_BUFFER.  This is a GENERIC_BUFFER for one producer
+			  and one consumer which needs no critical section on either side.
+			- Added in the GENERIC_BUFFER_SEARCH.  This searches a GENERIC_BUFFER for one or
+			  more patterns and only looks at the bytes which arrived since the last search.
+			- Added in GenericBufferWriteVector() and GenericBufferReadVector().  These move
+			  several separate segments in or out of a GENERIC_BUFFER in one call.
+			- GenericBufferContains() and GenericBufferSeek() now compare a whole UINT32
+			  at a time when GENERIC_BUFFER_WORD_SCAN is 1.
+			- Added in USING_GENERIC_BUFFER_OVERWRITE_MODE.  A GENERIC_BUFFER can now be created
+			  to drop its oldest data when full, see GenericBufferGetBytesDropped().
+
 	v1.06 Release Notes
 			- Added in the method GenericBufferContainsSequence().  This looks for a sequence
 			  of bytes located within the GENERIC_BUFFER.
@@ -58,6 +74,9 @@
 
 */
 
+#include <stdint.h>
+#include <string.h>
+
 #include "GenericBufferConfig.h"
 #include "GenericBuffer.h"
 
@@ -65,50 +84,148 @@
 	#include "stdlib.h"
 #endif // end of GENERIC_BUFFER_USE_MALLOC
 
-static UINT32 BufferReadToUserBuffer(GENERIC_BUFFER *GenericBuffer, UINT32 BytesToRead, BYTE *UserBuffer)
+/*
+	The data in a GENERIC_BUFFER can wrap around the end of the Buffer, so any run of it
+	is at most two contiguous pieces.  These copy a run in or out with one memcpy() per
+	piece and return the position just past the run.
+
+	Splitting the run and calling memcpy() costs more than it saves on a few bytes.  With
+	it a 1 byte write and read took about 1.3 to 2 times as long as the old byte loop on
+	a PC (see Tools/GenericBufferHarness), so GenericBufferWrite() and GenericBufferRead()
+	still copy runs this short a byte at a time.
+*/
+#define BUFFER_SHORT_COPY_SIZE_IN_BYTES			8
+
+static BYTE *BufferCopyFromRing(GENERIC_BUFFER *GenericBuffer, BYTE *Position, BYTE *Destination, UINT32 NumberOfBytes)
+{
+	UINT32 BytesUntilEnd = (UINT32)((GenericBuffer->Buffer + GenericBuffer->BufferCapacity) - Position);
+
+	if(NumberOfBytes < BytesUntilEnd)
+	{
+		memcpy((void*)Destination, (const void*)Position, (size_t)NumberOfBytes);
+
+		return Position + NumberOfBytes;
+	}
+
+	memcpy((void*)Destination, (const void*)Position, (size_t)BytesUntilEnd);
+	memcpy((void*)(Destination + BytesUntilEnd), (const void*)GenericBuffer->Buffer, (size_t)(NumberOfBytes - BytesUntilEnd));
+
+	return GenericBuffer->Buffer + (NumberOfBytes - BytesUntilEnd);
+}
+
+static BYTE *BufferCopyToRing(GENERIC_BUFFER *GenericBuffer, BYTE *Position, const BYTE *Source, UINT32 NumberOfBytes)
 {
-	UINT32 BytesRead = (UINT32)0;
-	BYTE *ReadPtr = (BYTE*)UserBuffer;
+	UINT32 BytesUntilEnd = (UINT32)((GenericBuffer->Buffer + GenericBuffer->BufferCapacity) - Position);
 
+	if(NumberOfBytes < BytesUntilEnd)
+	{
+		memcpy((void*)Position, (const void*)Source, (size_t)NumberOfBytes);
+
+		return Position + NumberOfBytes;
+	}
+
+	memcpy((void*)Position, (const void*)Source, (size_t)BytesUntilEnd);
+	memcpy((void*)GenericBuffer->Buffer, (const void*)(Source + BytesUntilEnd), (size_t)(NumberOfBytes - BytesUntilEnd));
+
+	return GenericBuffer->Buffer + (NumberOfBytes - BytesUntilEnd);
+}
+
+#if (USING_GENERIC_BUFFER_SPAN_METHODS == 1 || USING_GENERIC_BUFFER_SEARCH_METHODS == 1 || USING_GENERIC_BUFFER_OVERWRITE_MODE == 1)
+	static BYTE *BufferAdvancePosition(GENERIC_BUFFER *GenericBuffer, BYTE *Position, UINT32 NumberOfBytes)
+	{
+		UINT32 BytesUntilEnd = (UINT32)((GenericBuffer->Buffer + GenericBuffer->BufferCapacity) - Position);
+
+		if(NumberOfBytes < BytesUntilEnd)
+			return Position + NumberOfBytes;
+
+		return GenericBuffer->Buffer + (NumberOfBytes - BytesUntilEnd);
+	}
+#endif // end of USING_GENERIC_BUFFER_SPAN_METHODS || USING_GENERIC_BUFFER_SEARCH_METHODS || USING_GENERIC_BUFFER_OVERWRITE_MODE
+
+#if (USING_GENERIC_BUFFER_OVERWRITE_MODE == 1)
 	/*
-		While the Buffer still has some space in it to read from, and we haven't
-		reached the number of bytes the user wanted us to read, go ahead and keep
-		on reading.
+		Writes all of the data, dropping the oldest bytes in the GENERIC_BUFFER to make
+		room for it.  If there is more data than the whole GENERIC_BUFFER holds only the
+		newest part of it is kept.  This is only pointer math and one copy so it is
+		cheap enough for an ISR.
 	*/
-	while(GenericBuffer->BufferSize && BytesRead != (UINT32)BytesToRead)
+	static UINT32 BufferOverwrite(GENERIC_BUFFER *GenericBuffer, const BYTE *DataToWrite, UINT32 NumberOfBytes)
 	{
-		/*
-			There is at least 1 byte to read, and we haven't read the number
-			of bytes that the user wanted us to.
-		*/
-		BytesRead++;
+		UINT32 BytesToSkip = 0, BytesToDrop = 0;
 
-		GenericBuffer->BufferSize--;
+		if(NumberOfBytes > GenericBuffer->BufferCapacity)
+			BytesToSkip = NumberOfBytes - GenericBuffer->BufferCapacity;
 
-		/*
-			Copy the next byte into the user buffer, and advance the read pointer and
-			the pointer to the users buffer.
-		*/
-		*ReadPtr++ = *(GenericBuffer->CurrentReadPosition);
-		
-		GenericBuffer->CurrentReadPosition++;
+		// both of these are at most BufferCapacity so the sum can't wrap
+		if(GenericBuffer->BufferSize + (NumberOfBytes - BytesToSkip) > GenericBuffer->BufferCapacity)
+		{
+			BytesToDrop = GenericBuffer->BufferSize + (NumberOfBytes - BytesToSkip) - GenericBuffer->BufferCapacity;
 
-		/*
-			If we're 1 byte past the end of the Buffer, then go back to the beginning.
-		*/
-		if((UINT32)(GenericBuffer->CurrentReadPosition) == ((UINT32)(GenericBuffer->Buffer) + (UINT32)(GenericBuffer->BufferCapacity)))
-			GenericBuffer->CurrentReadPosition = (BYTE*)(GenericBuffer->Buffer);
+			GenericBuffer->CurrentReadPosition = BufferAdvancePosition(GenericBuffer, GenericBuffer->CurrentReadPosition, BytesToDrop);
+
+			GenericBuffer->BufferSize -= BytesToDrop;
+
+			// a dropped byte is gone just like a read one as far as a search is concerned
+			#if (USING_GENERIC_BUFFER_SEARCH_METHODS == 1)
+				GenericBuffer->TotalBytesRead += BytesToDrop;
+			#endif // end of USING_GENERIC_BUFFER_SEARCH_METHODS
+		}
+
+		GenericBuffer->BytesDropped += BytesToSkip + BytesToDrop;
+
+		GenericBuffer->CurrentWritePosition = BufferCopyToRing(GenericBuffer, GenericBuffer->CurrentWritePosition, DataToWrite + BytesToSkip, NumberOfBytes - BytesToSkip);
+
+		GenericBuffer->BufferSize += NumberOfBytes - BytesToSkip;
+
+		return (UINT32)NumberOfBytes;
 	}
+#endif // end of USING_GENERIC_BUFFER_OVERWRITE_MODE
 
+static UINT32 BufferReadToUserBuffer(GENERIC_BUFFER *GenericBuffer, UINT32 BytesToRead, BYTE *UserBuffer)
+{
 	/*
-		Return the number of bytes read.  This may not be the requested amount, but return
-		it anways.
+		We can only read as many bytes as the Buffer has in it, this may not be
+		the requested amount.
 	*/
+	if(BytesToRead > GenericBuffer->BufferSize)
+		BytesToRead = GenericBuffer->BufferSize;
 
-	return (UINT32)BytesRead;
+	if(BytesToRead <= BUFFER_SHORT_COPY_SIZE_IN_BYTES)
+	{
+		BYTE *Position = GenericBuffer->CurrentReadPosition;
+		UINT32 i;
+
+		for(i = 0; i < BytesToRead; i++)
+		{
+			UserBuffer[i] = *Position++;
+
+			if(Position == GenericBuffer->Buffer + GenericBuffer->BufferCapacity)
+				Position = GenericBuffer->Buffer;
+		}
+
+		GenericBuffer->CurrentReadPosition = Position;
+	}
+	else
+	{
+		GenericBuffer->CurrentReadPosition = BufferCopyFromRing(GenericBuffer, GenericBuffer->CurrentReadPosition, UserBuffer, BytesToRead);
+	}
+
+	GenericBuffer->BufferSize -= BytesToRead;
+
+	#if (USING_GENERIC_BUFFER_SEARCH_METHODS == 1)
+		GenericBuffer->TotalBytesRead += BytesToRead;
+	#endif // end of USING_GENERIC_BUFFER_SEARCH_METHODS
+
+	return (UINT32)BytesToRead;
 }
 
-GENERIC_BUFFER *CreateGenericBuffer(GENERIC_BUFFER *GenericBuffer, UINT32 CapacityInBytes, BYTE *Buffer)
+GENERIC_BUFFER *CreateGenericBuffer(GENERIC_BUFFER *GenericBuffer, UINT32 CapacityInBytes, BYTE *Buffer
+
+									#if (USING_GENERIC_BUFFER_OVERWRITE_MODE == 1)
+										, BOOL OverwriteOldest
+									#endif // end of USING_GENERIC_BUFFER_OVERWRITE_MODE
+
+									)
 {
 	void *TempBuffer;
 
@@ -163,13 +280,21 @@ GENERIC_BUFFER *CreateGenericBuffer(GENERIC_BUFFER *GenericBuffer, UINT32 Capaci
 	GenericBuffer->BufferSize = (UINT32)0;
 	GenericBuffer->CurrentReadPosition = GenericBuffer->CurrentWritePosition = (BYTE*)(GenericBuffer->Buffer);
 
+	#if (USING_GENERIC_BUFFER_SEARCH_METHODS == 1)
+		GenericBuffer->TotalBytesRead = (UINT32)0;
+	#endif // end of USING_GENERIC_BUFFER_SEARCH_METHODS
+
+	#if (USING_GENERIC_BUFFER_OVERWRITE_MODE == 1)
+		GenericBuffer->OverwriteOldest = OverwriteOldest;
+		GenericBuffer->BytesDropped = (UINT32)0;
+	#endif // end of USING_GENERIC_BUFFER_OVERWRITE_MODE
+
 	return (GENERIC_BUFFER*)GenericBuffer;
 }
 
 UINT32 GenericBufferWrite(GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes, const BYTE *DataToWrite)
 {
 	UINT32 BytesWritten;
-	BYTE *DataPtr;
 
 	#if (GENERIC_BUFFER_SAFE_MODE == 1)
 		if(GenericBufferIsNull(GenericBuffer))
@@ -182,33 +307,42 @@ UINT32 GenericBufferWrite(GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes, c
 			return (UINT32)0;
 	#endif // end of GENERIC_BUFFER_SAFE_MODE
 
-	BytesWritten = (UINT32)0;
-	DataPtr = (BYTE*)DataToWrite;
+	#if (USING_GENERIC_BUFFER_OVERWRITE_MODE == 1)
+		if(GenericBuffer->OverwriteOldest == TRUE)
+			return BufferOverwrite(GenericBuffer, DataToWrite, NumberOfBytes);
+	#endif // end of USING_GENERIC_BUFFER_OVERWRITE_MODE
 
 	/*
-		While the Buffer still has some space in it to write to, and we haven't
-		reached the number of bytes the user wanted us to write, go ahead and keep
-		on writing.
+		We can only write as many bytes as the Buffer has room for, this may not
+		be the requested amount.
 	*/
-	while(GenericBuffer->BufferSize < (UINT32)(GenericBuffer->BufferCapacity) && BytesWritten != (UINT32)NumberOfBytes)
+	BytesWritten = (UINT32)(GenericBuffer->BufferCapacity) - (UINT32)(GenericBuffer->BufferSize);
+
+	if(BytesWritten > NumberOfBytes)
+		BytesWritten = NumberOfBytes;
+
+	if(BytesWritten <= BUFFER_SHORT_COPY_SIZE_IN_BYTES)
 	{
-		BytesWritten++;
-		GenericBuffer->BufferSize++;
+		BYTE *Position = GenericBuffer->CurrentWritePosition;
+		UINT32 i;
 
-		/*
-			Copy the next byte into the buffer, and advance the read pointer and
-			the pointer to the users buffer.
-		*/
-		*(GenericBuffer->CurrentWritePosition) =  *DataPtr++;
-		GenericBuffer->CurrentWritePosition++;
+		for(i = 0; i < BytesWritten; i++)
+		{
+			*Position++ = DataToWrite[i];
 
-		/*
-			If we're 1 byte past the end of the Buffer, then go back to the beginning.
-		*/
-		if((UINT32)(GenericBuffer->CurrentWritePosition) == ((UINT32)(GenericBuffer->Buffer) + (UINT32)(GenericBuffer->BufferCapacity)))
-			GenericBuffer->CurrentWritePosition = (BYTE*)(GenericBuffer->Buffer);
+			if(Position == GenericBuffer->Buffer + GenericBuffer->BufferCapacity)
+				Position = GenericBuffer->Buffer;
+		}
+
+		GenericBuffer->CurrentWritePosition = Position;
+	}
+	else
+	{
+		GenericBuffer->CurrentWritePosition = BufferCopyToRing(GenericBuffer, GenericBuffer->CurrentWritePosition, DataToWrite, BytesWritten);
 	}
 
+	GenericBuffer->BufferSize += BytesWritten;
+
 	return (UINT32)BytesWritten;
 }
 
@@ -252,6 +386,10 @@ UINT32 GenericBufferRead(GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes, BY
 		BYTE *ReadPointerMarker;
 		UINT32 BuffersSize;
 
+		#if (USING_GENERIC_BUFFER_SEARCH_METHODS == 1)
+			UINT32 TotalBytesRead;
+		#endif // end of USING_GENERIC_BUFFER_SEARCH_METHODS
+
 		#if (GENERIC_BUFFER_SAFE_MODE == 1)
 			if(GenericBufferIsNull(GenericBuffer))
 				return (UINT32)0;
@@ -274,11 +412,17 @@ UINT32 GenericBufferRead(GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes, BY
 
 		/*
 			Copy the Buffer size and read pointers so we can set them
-			back to where they were before the read.
+			back to where they were before the read.  The read count has
+			to go back too, a GENERIC_BUFFER_SEARCH would otherwise think
+			the peeked bytes were gone and report a match in the wrong place.
 		*/
 		ReadPointerMarker = (BYTE*)(GenericBuffer->CurrentReadPosition);
 		BuffersSize = (UINT32)(GenericBuffer->BufferSize);
 
+		#if (USING_GENERIC_BUFFER_SEARCH_METHODS == 1)
+			TotalBytesRead = GenericBuffer->TotalBytesRead;
+		#endif // end of USING_GENERIC_BUFFER_SEARCH_METHODS
+
 		/*
 			Read in the data to the user buffer.
 		*/
@@ -291,6 +435,10 @@ UINT32 GenericBufferRead(GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes, BY
 		GenericBuffer->BufferSize = (UINT32)BuffersSize;
 		GenericBuffer->CurrentReadPosition = (BYTE*)ReadPointerMarker;
 
+		#if (USING_GENERIC_BUFFER_SEARCH_METHODS == 1)
+			GenericBuffer->TotalBytesRead = TotalBytesRead;
+		#endif // end of USING_GENERIC_BUFFER_SEARCH_METHODS
+
 		if (NullTerminate == TRUE)
 			DestinationBuffer[BytesRead] = '\0';
 
@@ -298,32 +446,92 @@ UINT32 GenericBufferRead(GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes, BY
 	}
 #endif // end of USING_GENERIC_BUFFER_PEEK_METHOD
 
+#if (USING_GENERIC_BUFFER_CONTAINS_METHOD == 1 || USING_GENERIC_BUFFER_SEEK_METHOD == 1)
+	/*
+		The data in the GENERIC_BUFFER is at most two contiguous runs, these scan one run.
+		With GENERIC_BUFFER_WORD_SCAN the bytes are XORed a UINT32 at a time against the
+		Character, which turns every matching byte into a zero byte.  The zero bytes
+		are then found without looking at the bytes one by one.
+	*/
+	#if (GENERIC_BUFFER_WORD_SCAN == 1)
+		#define BUFFER_WORD_ONES			((UINT32)~(UINT32)0 / (UINT32)0xFF)
+		#define BUFFER_WORD_LOW_7_BITS		(BUFFER_WORD_ONES * (UINT32)0x7F)
+
+		/*
+			Returns 0x80 in every byte of Word which is zero and 0x00 in all others.  Unlike
+			the shorter (Word - 0x01010101) & ~Word & 0x80808080 no carry can reach the next
+			byte, so every zero byte is marked and only the zero bytes are.
+		*/
+		static UINT32 BufferWordZeroBytes(UINT32 Word)
+		{
+			return ~(((Word & BUFFER_WORD_LOW_7_BITS) + BUFFER_WORD_LOW_7_BITS) | Word | BUFFER_WORD_LOW_7_BITS);
+		}
+
+		static UINT32 BufferLoadWord(const BYTE *Position)
+		{
+			UINT32 Word;
+
+			// Position is word aligned, this ends up as a single load
+			memcpy((void*)&Word, (const void*)Position, sizeof(UINT32));
+
+			return Word;
+		}
+	#endif // end of GENERIC_BUFFER_WORD_SCAN
+#endif // end of USING_GENERIC_BUFFER_CONTAINS_METHOD || USING_GENERIC_BUFFER_SEEK_METHOD
+
 #if (USING_GENERIC_BUFFER_CONTAINS_METHOD == 1)
+	static UINT32 BufferCountInRun(const BYTE *Position, UINT32 NumberOfBytes, BYTE Character)
+	{
+		UINT32 Count = 0;
+
+		#if (GENERIC_BUFFER_WORD_SCAN == 1)
+			UINT32 Pattern = (UINT32)Character * BUFFER_WORD_ONES;
+
+			// go a byte at a time until Position is word aligned
+			while (NumberOfBytes != 0 && ((uintptr_t)Position & (sizeof(UINT32) - 1)) != 0)
+			{
+				if (*Position++ == Character)
+					Count++;
+
+				NumberOfBytes--;
+			}
+
+			while (NumberOfBytes >= sizeof(UINT32))
+			{
+				// each matching byte is now 0x01, adding them all up lands in the top byte
+				Count += (UINT32)(((BufferWordZeroBytes(BufferLoadWord(Position) ^ Pattern) >> 7) * BUFFER_WORD_ONES) >> ((sizeof(UINT32) - 1) * 8));
+
+				Position += sizeof(UINT32);
+				NumberOfBytes -= sizeof(UINT32);
+			}
+		#endif // end of GENERIC_BUFFER_WORD_SCAN
+
+		while (NumberOfBytes-- != 0)
+		{
+			if (*Position++ == Character)
+				Count++;
+		}
+
+		return Count;
+	}
+
 	UINT32 GenericBufferContains(GENERIC_BUFFER *GenericBuffer, BYTE Character)
 	{
-		BYTE *TempReadPtr;
-		UINT32 i, ReturnValue = 0;
+		UINT32 BytesUntilEnd;
 
 		#if (GENERIC_BUFFER_SAFE_MODE == 1)
 			if (GenericBufferIsNull(GenericBuffer))
 				return (BOOL)FALSE;
 		#endif // end of GENERIC_BUFFER_SAFE_MODE
 
-		TempReadPtr = GenericBuffer->CurrentReadPosition;
+		BytesUntilEnd = (UINT32)((GenericBuffer->Buffer + GenericBuffer->BufferCapacity) - GenericBuffer->CurrentReadPosition);
 
-		for(i = 0; i < GenericBuffer->BufferSize; i++)
-		{
-			if (*TempReadPtr++ == Character)
-				ReturnValue++;
+		if (GenericBuffer->BufferSize <= BytesUntilEnd)
+			return BufferCountInRun(GenericBuffer->CurrentReadPosition, GenericBuffer->BufferSize, Character);
 
-			/*
-			If we're 1 byte past the end of the Buffer, then go back to the beginning.
-			*/
-			if ((UINT32)TempReadPtr == ((UINT32)(GenericBuffer->Buffer) + (UINT32)(GenericBuffer->BufferCapacity)))
-				TempReadPtr = (BYTE*)(GenericBuffer->Buffer);
-		}
-
-		return (UINT32)ReturnValue;
+		// the data wraps around the end of the Buffer
+		return BufferCountInRun(GenericBuffer->CurrentReadPosition, BytesUntilEnd, Character) + 
+			BufferCountInRun(GenericBuffer->Buffer, GenericBuffer->BufferSize - BytesUntilEnd, Character);
 	}
 #endif // end of USING_GENERIC_BUFFER_CONTAINS_METHOD
 
@@ -340,7 +548,7 @@ UINT32 GenericBufferRead(GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes, BY
 				/*
 				If we're 1 byte past the end of the Buffer, then go back to the beginning.
 				*/
-				if ((UINT32)BufferPosition == ((UINT32)(GenericBuffer->Buffer) + (UINT32)(GenericBuffer->BufferCapacity)))
+				if (BufferPosition == GenericBuffer->Buffer + GenericBuffer->BufferCapacity)
 					BufferPosition = (BYTE*)(GenericBuffer->Buffer);
 
 				// check to see if they're the same
@@ -394,7 +602,7 @@ UINT32 GenericBufferRead(GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes, BY
 			/*
 			If we're 1 byte past the end of the Buffer, then go back to the beginning.
 			*/
-			if ((UINT32)BufferIndexer == ((UINT32)(GenericBuffer->Buffer) + (UINT32)(GenericBuffer->BufferCapacity)))
+			if (BufferIndexer == GenericBuffer->Buffer + GenericBuffer->BufferCapacity)
 				BufferIndexer = (BYTE*)(GenericBuffer->Buffer);
 		}
 
@@ -403,31 +611,67 @@ UINT32 GenericBufferRead(GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes, BY
 #endif // end of USING_GENERIC_BUFFER_CONTAINS_SEQUENCE_METHOD
 
 #if (USING_GENERIC_BUFFER_SEEK_METHOD == 1)
+	/*
+		Returns how many bytes into the run Character is (1 based), or 0 if it isn't there.
+	*/
+	static UINT32 BufferSeekInRun(const BYTE *Position, UINT32 NumberOfBytes, BYTE Character)
+	{
+		const BYTE *RunStart = Position;
+
+		#if (GENERIC_BUFFER_WORD_SCAN == 1)
+			UINT32 Pattern = (UINT32)Character * BUFFER_WORD_ONES;
+
+			while (NumberOfBytes != 0 && ((uintptr_t)Position & (sizeof(UINT32) - 1)) != 0)
+			{
+				if (*Position++ == Character)
+					return (UINT32)(Position - RunStart);
+
+				NumberOfBytes--;
+			}
+
+			/*
+				Skip whole words until one has the Character in it.  Which byte of the
+				word comes first depends on the endianness, the byte loop below finds it.
+			*/
+			while (NumberOfBytes >= sizeof(UINT32))
+			{
+				if (BufferWordZeroBytes(BufferLoadWord(Position) ^ Pattern) != 0)
+					break;
+
+				Position += sizeof(UINT32);
+				NumberOfBytes -= sizeof(UINT32);
+			}
+		#endif // end of GENERIC_BUFFER_WORD_SCAN
+
+		while (NumberOfBytes-- != 0)
+		{
+			if (*Position++ == Character)
+				return (UINT32)(Position - RunStart);
+		}
+
+		return (UINT32)0;
+	}
+
 	UINT32 GenericBufferSeek(GENERIC_BUFFER *GenericBuffer, BYTE Character)
 	{
-		BYTE *TempReadPtr;
-		UINT32 i, ReturnValue = 1;
+		UINT32 BytesUntilEnd, ReturnValue;
 
 		#if (GENERIC_BUFFER_SAFE_MODE == 1)
 			if (GenericBufferIsNull(GenericBuffer))
 				return (BOOL)FALSE;
 		#endif // end of GENERIC_BUFFER_SAFE_MODE
 
-		TempReadPtr = GenericBuffer->CurrentReadPosition;
+		BytesUntilEnd = (UINT32)((GenericBuffer->Buffer + GenericBuffer->BufferCapacity) - GenericBuffer->CurrentReadPosition);
 
-		for (i = 0; i < GenericBuffer->BufferSize; i++)
-		{
-			if (*TempReadPtr++ == Character)
-				return ReturnValue;
+		if (GenericBuffer->BufferSize <= BytesUntilEnd)
+			return BufferSeekInRun(GenericBuffer->CurrentReadPosition, GenericBuffer->BufferSize, Character);
 
-			ReturnValue++;
+		if ((ReturnValue = BufferSeekInRun(GenericBuffer->CurrentReadPosition, BytesUntilEnd, Character)) != 0)
+			return ReturnValue;
 
-			/*
-			If we're 1 byte past the end of the Buffer, then go back to the beginning.
-			*/
-			if ((UINT32)TempReadPtr == ((UINT32)(GenericBuffer->Buffer) + (UINT32)(GenericBuffer->BufferCapacity)))
-				TempReadPtr = (BYTE*)(GenericBuffer->Buffer);
-		}
+		// the data wraps around the end of the Buffer, keep going from the start of it
+		if ((ReturnValue = BufferSeekInRun(GenericBuffer->Buffer, GenericBuffer->BufferSize - BytesUntilEnd, Character)) != 0)
+			return ReturnValue + BytesUntilEnd;
 
 		return (UINT32)0;
 	}
@@ -447,6 +691,10 @@ UINT32 GenericBufferRead(GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes, BY
 			there, it's just that the size is now 0 so the GENIER_BUFFER library
 			will think it shouldn't access it.
 		*/
+		#if (USING_GENERIC_BUFFER_SEARCH_METHODS == 1)
+			GenericBuffer->TotalBytesRead += GenericBuffer->BufferSize;
+		#endif // end of USING_GENERIC_BUFFER_SEARCH_METHODS
+
 		GenericBuffer->CurrentReadPosition = GenericBuffer->CurrentWritePosition = (BYTE*)(GenericBuffer->Buffer);
 		GenericBuffer->BufferSize = (UINT32)0;
 
@@ -527,9 +775,634 @@ UINT32 GenericBufferRead(GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes, BY
 	}
 #endif // end of USING_GENERIC_BUFFER_GET_REMAINING_BYTES_METHOD
 
+#if (USING_GENERIC_BUFFER_SPAN_METHODS == 1)
+	static UINT32 BufferGetWriteSpanSize(GENERIC_BUFFER *GenericBuffer)
+	{
+		UINT32 BytesFree = (UINT32)(GenericBuffer->BufferCapacity) - (UINT32)(GenericBuffer->BufferSize);
+		UINT32 BytesUntilEnd = (UINT32)((GenericBuffer->Buffer + GenericBuffer->BufferCapacity) - GenericBuffer->CurrentWritePosition);
+
+		/*
+			The free space starts at the write position and runs until either the
+			read position or the end of the Buffer, whichever comes first.
+		*/
+		if(BytesFree < BytesUntilEnd)
+			return BytesFree;
+
+		return BytesUntilEnd;
+	}
+
+	static UINT32 BufferGetReadSpanSize(GENERIC_BUFFER *GenericBuffer)
+	{
+		UINT32 BytesUntilEnd = (UINT32)((GenericBuffer->Buffer + GenericBuffer->BufferCapacity) - GenericBuffer->CurrentReadPosition);
+
+		if(GenericBuffer->BufferSize < BytesUntilEnd)
+			return (UINT32)(GenericBuffer->BufferSize);
+
+		return BytesUntilEnd;
+	}
+
+	BYTE *GenericBufferGetWriteSpan(GENERIC_BUFFER *GenericBuffer, UINT32 *SpanSizeInBytes)
+	{
+		#if (GENERIC_BUFFER_SAFE_MODE == 1)
+			if(SpanSizeInBytes == (UINT32*)NULL)
+				return (BYTE*)NULL;
+
+			*SpanSizeInBytes = 0;
+
+			if(GenericBufferIsNull(GenericBuffer))
+				return (BYTE*)NULL;
+		#endif // end of GENERIC_BUFFER_SAFE_MODE
+
+		if((*SpanSizeInBytes = BufferGetWriteSpanSize(GenericBuffer)) == 0)
+			return (BYTE*)NULL;
+
+		return (BYTE*)(GenericBuffer->CurrentWritePosition);
+	}
+
+	UINT32 GenericBufferCommitWrite(GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes)
+	{
+		UINT32 SpanSize;
+
+		#if (GENERIC_BUFFER_SAFE_MODE == 1)
+			if(GenericBufferIsNull(GenericBuffer))
+				return (UINT32)0;
+		#endif // end of GENERIC_BUFFER_SAFE_MODE
+
+		/*
+			Only the span handed out by GenericBufferGetWriteSpan() could have been
+			written to, anything past it was never filled in.
+		*/
+		SpanSize = BufferGetWriteSpanSize(GenericBuffer);
+
+		if(NumberOfBytes > SpanSize)
+			NumberOfBytes = SpanSize;
+
+		GenericBuffer->CurrentWritePosition = BufferAdvancePosition(GenericBuffer, GenericBuffer->CurrentWritePosition, NumberOfBytes);
+
+		GenericBuffer->BufferSize += NumberOfBytes;
+
+		return (UINT32)NumberOfBytes;
+	}
+
+	BYTE *GenericBufferGetReadSpan(GENERIC_BUFFER *GenericBuffer, UINT32 *SpanSizeInBytes)
+	{
+		#if (GENERIC_BUFFER_SAFE_MODE == 1)
+			if(SpanSizeInBytes == (UINT32*)NULL)
+				return (BYTE*)NULL;
+
+			*SpanSizeInBytes = 0;
+
+			if(GenericBufferIsNull(GenericBuffer))
+				return (BYTE*)NULL;
+		#endif // end of GENERIC_BUFFER_SAFE_MODE
+
+		if((*SpanSizeInBytes = BufferGetReadSpanSize(GenericBuffer)) == 0)
+			return (BYTE*)NULL;
+
+		return (BYTE*)(GenericBuffer->CurrentReadPosition);
+	}
+
+	UINT32 GenericBufferConsume(GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes)
+	{
+		#if (GENERIC_BUFFER_SAFE_MODE == 1)
+			if(GenericBufferIsNull(GenericBuffer))
+				return (UINT32)0;
+		#endif // end of GENERIC_BUFFER_SAFE_MODE
+
+		/*
+			Unlike a commit, consuming can run past the first span since
+			the bytes are just being thrown away.
+		*/
+		if(NumberOfBytes > GenericBuffer->BufferSize)
+			NumberOfBytes = GenericBuffer->BufferSize;
+
+		GenericBuffer->CurrentReadPosition = BufferAdvancePosition(GenericBuffer, GenericBuffer->CurrentReadPosition, NumberOfBytes);
+
+		GenericBuffer->BufferSize -= NumberOfBytes;
+
+		#if (USING_GENERIC_BUFFER_SEARCH_METHODS == 1)
+			GenericBuffer->TotalBytesRead += NumberOfBytes;
+		#endif // end of USING_GENERIC_BUFFER_SEARCH_METHODS
+
+		return (UINT32)NumberOfBytes;
+	}
+#endif // end of USING_GENERIC_BUFFER_SPAN_METHODS
+
+#if (USING_GENERIC_BUFFER_OVERWRITE_MODE == 1)
+	UINT32 GenericBufferGetBytesDropped(GENERIC_BUFFER *GenericBuffer)
+	{
+		#if (GENERIC_BUFFER_SAFE_MODE == 1)
+			if(GenericBufferIsNull(GenericBuffer))
+				return (UINT32)0;
+		#endif // end of GENERIC_BUFFER_SAFE_MODE
+
+		return (UINT32)(GenericBuffer->BytesDropped);
+	}
+#endif // end of USING_GENERIC_BUFFER_OVERWRITE_MODE
+
+#if (USING_GENERIC_BUFFER_VECTOR_METHODS == 1)
+	BOOL GenericBufferVectorFits(const GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, UINT32 Limit)
+	{
+		UINT32 i;
+
+		#if (GENERIC_BUFFER_SAFE_MODE == 1)
+			if(Vectors == (const GENERIC_BUFFER_VECTOR*)NULL)
+				return FALSE;
+		#endif // end of GENERIC_BUFFER_SAFE_MODE
+
+		// the total is never formed, each size is taken off of Limit so it can't wrap
+		for (i = 0; i < NumberOfVectors; i++)
+		{
+			if (Vectors[i].SizeInBytes > Limit)
+				return FALSE;
+
+			Limit -= Vectors[i].SizeInBytes;
+		}
+
+		return TRUE;
+	}
+
+	UINT32 GenericBufferWriteVector(GENERIC_BUFFER *GenericBuffer, const GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, BOOL AllOrNothing)
+	{
+		UINT32 i, BytesFree, BytesToWrite, BytesWritten = 0;
+
+		#if (GENERIC_BUFFER_SAFE_MODE == 1)
+			if(GenericBufferIsNull(GenericBuffer))
+				return (UINT32)0;
+
+			if(Vectors == (const GENERIC_BUFFER_VECTOR*)NULL)
+				return (UINT32)0;
+		#endif // end of GENERIC_BUFFER_SAFE_MODE
+
+		#if (USING_GENERIC_BUFFER_OVERWRITE_MODE == 1)
+			// every segment always goes in, so there is nothing to be all or nothing about
+			if(GenericBuffer->OverwriteOldest == TRUE)
+			{
+				for (i = 0; i < NumberOfVectors; i++)
+					BytesWritten += BufferOverwrite(GenericBuffer, Vectors[i].Data, Vectors[i].SizeInBytes);
+
+				return (UINT32)BytesWritten;
+			}
+		#endif // end of USING_GENERIC_BUFFER_OVERWRITE_MODE
+
+		BytesFree = (UINT32)(GenericBuffer->BufferCapacity) - (UINT32)(GenericBuffer->BufferSize);
+
+		if(AllOrNothing == TRUE && GenericBufferVectorFits(Vectors, NumberOfVectors, BytesFree) == FALSE)
+			return (UINT32)0;
+
+		for (i = 0; i < NumberOfVectors && BytesFree != 0; i++)
+		{
+			BytesToWrite = Vectors[i].SizeInBytes;
+
+			if(BytesToWrite > BytesFree)
+				BytesToWrite = BytesFree;
+
+			GenericBuffer->CurrentWritePosition = BufferCopyToRing(GenericBuffer, GenericBuffer->CurrentWritePosition, Vectors[i].Data, BytesToWrite);
+
+			BytesFree -= BytesToWrite;
+			BytesWritten += BytesToWrite;
+		}
+
+		GenericBuffer->BufferSize += BytesWritten;
+
+		return (UINT32)BytesWritten;
+	}
+
+	UINT32 GenericBufferReadVector(GENERIC_BUFFER *GenericBuffer, GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, BOOL AllOrNothing)
+	{
+		UINT32 i, BytesLeft, BytesToRead, BytesRead = 0;
+
+		#if (GENERIC_BUFFER_SAFE_MODE == 1)
+			if(GenericBufferIsNull(GenericBuffer))
+				return (UINT32)0;
+
+			if(Vectors == (GENERIC_BUFFER_VECTOR*)NULL)
+				return (UINT32)0;
+		#endif // end of GENERIC_BUFFER_SAFE_MODE
+
+		BytesLeft = GenericBuffer->BufferSize;
+
+		/*
+			All or nothing for a read means every segment gets filled, so
+			there has to be at least as much data as the segments hold.
+		*/
+		if(AllOrNothing == TRUE && GenericBufferVectorFits(Vectors, NumberOfVectors, BytesLeft) == FALSE)
+			return (UINT32)0;
+
+		for (i = 0; i < NumberOfVectors && BytesLeft != 0; i++)
+		{
+			BytesToRead = Vectors[i].SizeInBytes;
+
+			if(BytesToRead > BytesLeft)
+				BytesToRead = BytesLeft;
+
+			GenericBuffer->CurrentReadPosition = BufferCopyFromRing(GenericBuffer, GenericBuffer->CurrentReadPosition, Vectors[i].Data, BytesToRead);
+
+			BytesLeft -= BytesToRead;
+			BytesRead += BytesToRead;
+		}
+
+		GenericBuffer->BufferSize -= BytesRead;
+
+		#if (USING_GENERIC_BUFFER_SEARCH_METHODS == 1)
+			GenericBuffer->TotalBytesRead += BytesRead;
+		#endif // end of USING_GENERIC_BUFFER_SEARCH_METHODS
+
+		return (UINT32)BytesRead;
+	}
+#endif // end of USING_GENERIC_BUFFER_VECTOR_METHODS
+
+#if (USING_SPSC_GENERIC_BUFFER_METHODS == 1)
+	SPSC_GENERIC_BUFFER *CreateSPSCGenericBuffer(SPSC_GENERIC_BUFFER *GenericBuffer, UINT32 CapacityInBytes, BYTE *Buffer)
+	{
+		BYTE *TempBuffer = Buffer;
+
+		/*
+			The indexes are masked to find their place in the Buffer, which
+			only works if the capacity is a power of 2.
+		*/
+		if(CapacityInBytes < (UINT32)2 || (CapacityInBytes & (CapacityInBytes - 1)) != 0)
+			return (SPSC_GENERIC_BUFFER*)NULL;
+
+		if(TempBuffer == (BYTE*)NULL)
+		{
+			if((TempBuffer = (BYTE*)BufferMemAlloc(CapacityInBytes)) == (BYTE*)NULL)
+				return (SPSC_GENERIC_BUFFER*)NULL;
+		}
+
+		if(GenericBuffer == (SPSC_GENERIC_BUFFER*)NULL)
+		{
+			if((GenericBuffer = (SPSC_GENERIC_BUFFER*)BufferMemAlloc(sizeof(SPSC_GENERIC_BUFFER))) == (SPSC_GENERIC_BUFFER*)NULL)
+			{
+				if(Buffer == (BYTE*)NULL)
+					BufferMemDealloc((void*)TempBuffer);
+
+				return (SPSC_GENERIC_BUFFER*)NULL;
+			}
+		}
+
+		GenericBuffer->Buffer = TempBuffer;
+		GenericBuffer->BufferCapacity = CapacityInBytes;
+		GenericBuffer->WriteIndex = GenericBuffer->ReadIndex = (UINT32)0;
+
+		return GenericBuffer;
+	}
+
+	UINT32 SPSCGenericBufferWrite(SPSC_GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes, const BYTE *DataToWrite)
+	{
+		UINT32 WriteIndex, BytesFree, Position, BytesUntilEnd;
+
+		#if (GENERIC_BUFFER_SAFE_MODE == 1)
+			if(GenericBuffer == (SPSC_GENERIC_BUFFER*)NULL)
+				return (UINT32)0;
+
+			if(DataToWrite == (BYTE*)NULL)
+				return (UINT32)0;
+		#endif // end of GENERIC_BUFFER_SAFE_MODE
+
+		/*
+			The write index is ours so it can't change under us.  The read index
+			only ever grows, so the free space we see here can only be too small.
+		*/
+		WriteIndex = GenericBuffer->WriteIndex;
+		BytesFree = GenericBuffer->BufferCapacity - (WriteIndex - GenericBuffer->ReadIndex);
+
+		if(NumberOfBytes > BytesFree)
+			NumberOfBytes = BytesFree;
+
+		if(NumberOfBytes == 0)
+			return (UINT32)0;
+
+		Position = WriteIndex & (GenericBuffer->BufferCapacity - 1);
+		BytesUntilEnd = GenericBuffer->BufferCapacity - Position;
+
+		if(NumberOfBytes <= BytesUntilEnd)
+		{
+			memcpy((void*)&GenericBuffer->Buffer[Position], (const void*)DataToWrite, (size_t)NumberOfBytes);
+		}
+		else
+		{
+			memcpy((void*)&GenericBuffer->Buffer[Position], (const void*)DataToWrite, (size_t)BytesUntilEnd);
+			memcpy((void*)GenericBuffer->Buffer, (const void*)(DataToWrite + BytesUntilEnd), (size_t)(NumberOfBytes - BytesUntilEnd));
+		}
+
+		// the data has to be in the Buffer before the consumer can see the new index
+		GenericBufferMemoryBarrier();
+
+		GenericBuffer->WriteIndex = WriteIndex + NumberOfBytes;
+
+		return NumberOfBytes;
+	}
+
+	UINT32 SPSCGenericBufferRead(SPSC_GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes, BYTE *DestinationBuffer)
+	{
+		UINT32 ReadIndex, BytesUsed, Position, BytesUntilEnd;
+
+		#if (GENERIC_BUFFER_SAFE_MODE == 1)
+			if(GenericBuffer == (SPSC_GENERIC_BUFFER*)NULL)
+				return (UINT32)0;
+
+			if(DestinationBuffer == (BYTE*)NULL)
+				return (UINT32)0;
+		#endif // end of GENERIC_BUFFER_SAFE_MODE
+
+		/*
+			The read index is ours so it can't change under us.  The write index
+			only ever grows, so the data we see here can only be too little.
+		*/
+		ReadIndex = GenericBuffer->ReadIndex;
+		BytesUsed = GenericBuffer->WriteIndex - ReadIndex;
+
+		if(NumberOfBytes > BytesUsed)
+			NumberOfBytes = BytesUsed;
+
+		if(NumberOfBytes == 0)
+			return (UINT32)0;
+
+		// don't read the data until after the index which says it is there
+		GenericBufferMemoryBarrier();
+
+		Position = ReadIndex & (GenericBuffer->BufferCapacity - 1);
+		BytesUntilEnd = GenericBuffer->BufferCapacity - Position;
+
+		if(NumberOfBytes <= BytesUntilEnd)
+		{
+			memcpy((void*)DestinationBuffer, (const void*)&GenericBuffer->Buffer[Position], (size_t)NumberOfBytes);
+		}
+		else
+		{
+			memcpy((void*)DestinationBuffer, (const void*)&GenericBuffer->Buffer[Position], (size_t)BytesUntilEnd);
+			memcpy((void*)(DestinationBuffer + BytesUntilEnd), (const void*)GenericBuffer->Buffer, (size_t)(NumberOfBytes - BytesUntilEnd));
+		}
+
+		// the data has to be copied out before the producer can reuse the space
+		GenericBufferMemoryBarrier();
+
+		GenericBuffer->ReadIndex = ReadIndex + NumberOfBytes;
+
+		return NumberOfBytes;
+	}
+
+	UINT32 SPSCGenericBufferGetSize(SPSC_GENERIC_BUFFER *GenericBuffer)
+	{
+		#if (GENERIC_BUFFER_SAFE_MODE == 1)
+			if(GenericBuffer == (SPSC_GENERIC_BUFFER*)NULL)
+				return (UINT32)0;
+		#endif // end of GENERIC_BUFFER_SAFE_MODE
+
+		/*
+			The caller is the producer or the consumer, so one of these
+			indexes is theirs and can't move while we look at the other.
+		*/
+		return (UINT32)(GenericBuffer->WriteIndex - GenericBuffer->ReadIndex);
+	}
+
+	UINT32 SPSCGenericBufferGetRemainingBytes(SPSC_GENERIC_BUFFER *GenericBuffer)
+	{
+		#if (GENERIC_BUFFER_SAFE_MODE == 1)
+			if(GenericBuffer == (SPSC_GENERIC_BUFFER*)NULL)
+				return (UINT32)0;
+		#endif // end of GENERIC_BUFFER_SAFE_MODE
+
+		return (UINT32)(GenericBuffer->BufferCapacity - (GenericBuffer->WriteIndex - GenericBuffer->ReadIndex));
+	}
+
+	BOOL SPSCGenericBufferDelete(SPSC_GENERIC_BUFFER *GenericBuffer, BOOL FreeBufferSpace)
+	{
+		#if (GENERIC_BUFFER_SAFE_MODE == 1)
+			if(GenericBuffer == (SPSC_GENERIC_BUFFER*)NULL)
+				return (BOOL)FALSE;
+		#endif // end of GENERIC_BUFFER_SAFE_MODE
+
+		if(FreeBufferSpace)
+			BufferMemDealloc((void*)(GenericBuffer->Buffer));
+
+		BufferMemDealloc((void*)(GenericBuffer));
+
+		return (BOOL)TRUE;
+	}
+#endif // end of USING_SPSC_GENERIC_BUFFER_METHODS
+
+#if (USING_GENERIC_BUFFER_SEARCH_METHODS == 1)
+	static void BufferSearchRestart(GENERIC_BUFFER_SEARCH *Search)
+	{
+		UINT32 i;
+
+		for (i = 0; i < Search->NumberOfPatterns; i++)
+			Search->MatchedBytes[i] = 0;
+
+		Search->BytesSearched = 0;
+		Search->MatchedPattern = 0;
+	}
+
+	GENERIC_BUFFER_SEARCH *CreateGenericBufferSearch(GENERIC_BUFFER_SEARCH *Search)
+	{
+		if(Search == (GENERIC_BUFFER_SEARCH*)NULL)
+		{
+			if((Search = (GENERIC_BUFFER_SEARCH*)BufferMemAlloc(sizeof(GENERIC_BUFFER_SEARCH))) == (GENERIC_BUFFER_SEARCH*)NULL)
+				return (GENERIC_BUFFER_SEARCH*)NULL;
+		}
+
+		Search->NumberOfPatterns = 0;
+		Search->GenericBuffer = (GENERIC_BUFFER*)NULL;
+		Search->TotalBytesRead = 0;
+
+		BufferSearchRestart(Search);
+
+		return (GENERIC_BUFFER_SEARCH*)Search;
+	}
+
+	BOOL GenericBufferSearchAddPattern(GENERIC_BUFFER_SEARCH *Search, const BYTE *Pattern, UINT32 PatternSizeInBytes)
+	{
+		UINT32 i, Matched;
+		BYTE *NewPattern, *FailureTable;
+
+		#if (GENERIC_BUFFER_SAFE_MODE == 1)
+			if(Search == (GENERIC_BUFFER_SEARCH*)NULL)
+				return (BOOL)FALSE;
+
+			if(Pattern == (const BYTE*)NULL)
+				return (BOOL)FALSE;
+		#endif // end of GENERIC_BUFFER_SAFE_MODE
+
+		if(PatternSizeInBytes == 0 || PatternSizeInBytes > GENERIC_BUFFER_SEARCH_MAX_PATTERN_SIZE_IN_BYTES)
+			return (BOOL)FALSE;
+
+		if(Search->NumberOfPatterns == GENERIC_BUFFER_SEARCH_MAX_PATTERNS)
+			return (BOOL)FALSE;
+
+		NewPattern = Search->Pattern[Search->NumberOfPatterns];
+		FailureTable = Search->FailureTable[Search->NumberOfPatterns];
+
+		memcpy((void*)NewPattern, (const void*)Pattern, (size_t)PatternSizeInBytes);
+
+		/*
+			Build the KMP failure table, each entry is the length of the longest
+			proper prefix of the pattern which is also a suffix of its first i + 1 bytes.
+		*/
+		FailureTable[0] = 0;
+		Matched = 0;
+
+		for (i = 1; i < PatternSizeInBytes; i++)
+		{
+			while (Matched != 0 && NewPattern[i] != NewPattern[Matched])
+				Matched = FailureTable[Matched - 1];
+
+			if (NewPattern[i] == NewPattern[Matched])
+				Matched++;
+
+			FailureTable[i] = (BYTE)Matched;
+		}
+
+		Search->PatternSizeInBytes[Search->NumberOfPatterns] = (BYTE)PatternSizeInBytes;
+		Search->MatchedBytes[Search->NumberOfPatterns] = 0;
+		Search->NumberOfPatterns++;
+
+		// anything already searched was searched without this pattern
+		BufferSearchRestart(Search);
+
+		return (BOOL)TRUE;
+	}
+
+	UINT32 GenericBufferSearch(GENERIC_BUFFER *GenericBuffer, GENERIC_BUFFER_SEARCH *Search, UINT32 *PatternIndex)
+	{
+		UINT32 BytesRead, BytesLeft, BytesInRun, i, Matched;
+		BYTE *Position, Data;
+
+		#if (GENERIC_BUFFER_SAFE_MODE == 1)
+			if(GenericBufferIsNull(GenericBuffer))
+				return (UINT32)0;
+
+			if(Search == (GENERIC_BUFFER_SEARCH*)NULL)
+				return (UINT32)0;
+		#endif // end of GENERIC_BUFFER_SAFE_MODE
+
+		/*
+			Take off whatever was read out of the GENERIC_BUFFER since the last search.
+			Once all the searched bytes are gone (or this is a different GENERIC_BUFFER)
+			there is nothing left to remember.
+		*/
+		BytesRead = GenericBuffer->TotalBytesRead - Search->TotalBytesRead;
+
+		if(Search->GenericBuffer != GenericBuffer || BytesRead >= Search->BytesSearched)
+		{
+			BufferSearchRestart(Search);
+		}
+		else if(BytesRead != 0)
+		{
+			Search->BytesSearched -= BytesRead;
+			Search->MatchedPattern = 0;
+
+			/*
+				A match can't start in bytes which were read, so drop each pattern back
+				to the longest part of it that is still in the GENERIC_BUFFER.  A match
+				which is still all there is kept.
+			*/
+			for (i = 0; i < Search->NumberOfPatterns; i++)
+			{
+				Matched = Search->MatchedBytes[i];
+
+				while (Matched > Search->BytesSearched)
+					Matched = Search->FailureTable[i][Matched - 1];
+
+				Search->MatchedBytes[i] = (BYTE)Matched;
+
+				if (Matched == Search->PatternSizeInBytes[i] && Search->MatchedPattern == 0)
+					Search->MatchedPattern = i + 1;
+			}
+		}
+
+		Search->GenericBuffer = GenericBuffer;
+		Search->TotalBytesRead = GenericBuffer->TotalBytesRead;
+
+		/*
+			Only the bytes past BytesSearched are new, they are in at most two
+			contiguous runs since the data can wrap around the end of the Buffer.
+		*/
+		if(Search->MatchedPattern == 0 && Search->BytesSearched < GenericBuffer->BufferSize)
+		{
+			Position = BufferAdvancePosition(GenericBuffer, GenericBuffer->CurrentReadPosition, Search->BytesSearched);
+			BytesLeft = GenericBuffer->BufferSize - Search->BytesSearched;
+
+			while (BytesLeft != 0 && Search->MatchedPattern == 0)
+			{
+				BytesInRun = (UINT32)((GenericBuffer->Buffer + GenericBuffer->BufferCapacity) - Position);
+
+				if(BytesInRun > BytesLeft)
+					BytesInRun = BytesLeft;
+
+				BytesLeft -= BytesInRun;
+
+				while (BytesInRun-- != 0)
+				{
+					Data = *Position++;
+
+					Search->BytesSearched++;
+
+					for (i = 0; i < Search->NumberOfPatterns; i++)
+					{
+						Matched = Search->MatchedBytes[i];
+
+						while (Matched != 0 && Search->Pattern[i][Matched] != Data)
+							Matched = Search->FailureTable[i][Matched - 1];
+
+						if (Search->Pattern[i][Matched] == Data)
+							Matched++;
+
+						Search->MatchedBytes[i] = (BYTE)Matched;
+
+						// the first pattern to finish wins
+						if (Matched == Search->PatternSizeInBytes[i] && Search->MatchedPattern == 0)
+							Search->MatchedPattern = i + 1;
+					}
+
+					if (Search->MatchedPattern != 0)
+						break;
+				}
+
+				Position = GenericBuffer->Buffer;
+			}
+		}
+
+		if(Search->MatchedPattern == 0)
+			return (UINT32)0;
+
+		if(PatternIndex != (UINT32*)NULL)
+			*PatternIndex = Search->MatchedPattern - 1;
+
+		return (UINT32)(Search->BytesSearched);
+	}
+
+	BOOL GenericBufferSearchReset(GENERIC_BUFFER_SEARCH *Search)
+	{
+		#if (GENERIC_BUFFER_SAFE_MODE == 1)
+			if(Search == (GENERIC_BUFFER_SEARCH*)NULL)
+				return (BOOL)FALSE;
+		#endif // end of GENERIC_BUFFER_SAFE_MODE
+
+		Search->GenericBuffer = (GENERIC_BUFFER*)NULL;
+
+		BufferSearchRestart(Search);
+
+		return (BOOL)TRUE;
+	}
+
+	BOOL GenericBufferSearchDelete(GENERIC_BUFFER_SEARCH *Search)
+	{
+		#if (GENERIC_BUFFER_SAFE_MODE == 1)
+			if(Search == (GENERIC_BUFFER_SEARCH*)NULL)
+				return (BOOL)FALSE;
+		#endif // end of GENERIC_BUFFER_SAFE_MODE
+
+		BufferMemDealloc((void*)Search);
+
+		return (BOOL)TRUE;
+	}
+#endif // end of USING_GENERIC_BUFFER_SEARCH_METHODS
+
 #if (USING_GENERIC_BUFFER_GET_LIBRARY_VERSION == 1)
 
-	const BYTE GenericBufferLibraryVersion[] = {"Generic Buffer Lib v1.06\0"};
+	const BYTE GenericBufferLibraryVersion[] = {"Generic Buffer Lib v1.07\0"};
 
 	const BYTE *GenericBufferGetLibraryVersion(void)
 	{
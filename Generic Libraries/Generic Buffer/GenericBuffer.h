@@ -2,7 +2,7 @@
 	Developer: brodie
 	Date: July 9, 2015
 	File Name: GenericBuffer.h
-	Version: 1.06
+	Version: 1.07
 	IDE: Visual Studio 2010 Professional
 	Compiler: C89
 
@@ -16,7 +16,7 @@
 /*! \mainpage GenericBuffer Library
  *  \brief This is a Library written in C for manipulating a GenericBuffer Data Structure.
  *  \author brodie
- *  \version 1.06
+ *  \version 1.07
  *  \date   July 9, 2015
  */
 
@@ -44,6 +44,10 @@
 		will use CapacityInBytes to determine how big of a buffer in RAM to 
 		create through a call to BufferMemAlloc().
 
+		BOOL OverwriteOldest - If TRUE a write which does not fit drops the oldest data
+		to make room instead of being cut short.  Only present if
+		USING_GENERIC_BUFFER_OVERWRITE_MODE is defined as 1.
+
 	Returns:
 		GENERIC_BUFFER* - The address at which the newly initialized GENERIC_BUFFER resides
 		in memory.  If a new GENERIC_BUFFER could not be created then (GENERIC_BUFFER*)NULL is returned.
@@ -66,11 +70,19 @@
 		and pass in the size from CapacityInBytes.
 		* @return *GENERIC_BUFFER - The address of the GENERIC_BUFFER in memory.  If a GENERIC_BUFFER could
 		not be allocated, returns a NULL GENERIC_BUFFER pointer.
+		* @param OverwriteOldest - TRUE to drop the oldest data when a write does not fit.  Only
+		present if USING_GENERIC_BUFFER_OVERWRITE_MODE is defined as 1.
 		* @note None.
 		* @sa BufferMemAlloc()
 		* @since v1.0
 */
-GENERIC_BUFFER *CreateGenericBuffer(GENERIC_BUFFER *GenericBuffer, UINT32 CapacityInBytes, BYTE *Buffer);
+GENERIC_BUFFER *CreateGenericBuffer(GENERIC_BUFFER *GenericBuffer, UINT32 CapacityInBytes, BYTE *Buffer
+
+									#if (USING_GENERIC_BUFFER_OVERWRITE_MODE == 1)
+										, BOOL OverwriteOldest
+									#endif // end of USING_GENERIC_BUFFER_OVERWRITE_MODE
+
+									);
 
 /*
 	Function: UINT32 GenericBufferWrite(GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes, const BYTE *DataToWrite)
@@ -90,7 +102,9 @@ GENERIC_BUFFER *CreateGenericBuffer(GENERIC_BUFFER *GenericBuffer, UINT32 Capaci
 
 	Description: Writes the specified number of bytes from the user buffer to the GENERIC_BUFFER.
 
-	Notes: None
+	Notes: If the GENERIC_BUFFER was created with OverwriteOldest as TRUE the oldest data is
+	dropped to make room and NumberOfBytes is always returned.  If NumberOfBytes is more than
+	the capacity only the newest bytes are kept.
 */
 /**
 		* @brief Writes to a GENERIC_BUFFER.
@@ -423,6 +437,645 @@ UINT32 GenericBufferRead(GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes, BY
 	UINT32 GenericBufferGetRemainingBytes(GENERIC_BUFFER *GenericBuffer);
 #endif // end of USING_GENERIC_BUFFER_GET_REMAINING_BYTES_METHOD
 
+/*
+	Function: BYTE *GenericBufferGetWriteSpan(GENERIC_BUFFER *GenericBuffer, UINT32 *SpanSizeInBytes)
+
+	Parameters:
+		GENERIC_BUFFER *GenericBuffer - A pointer to the GENENERIC_BUFFER.
+
+		UINT32 *SpanSizeInBytes - The number of bytes which can be written starting at
+		the returned address is stored here.
+
+	Returns:
+		BYTE* - The address inside the GENERIC_BUFFER where the next byte written will go.
+		(BYTE*)NULL is returned if the GENERIC_BUFFER is full.
+
+	Description: Returns the largest run of free space inside the GENERIC_BUFFER which
+	does not wrap around the end of the Buffer.  The caller can fill this space directly
+	(from a DMA engine for example) and then call GenericBufferCommitWrite() to add the
+	bytes to the GENERIC_BUFFER.  The free space may be split in two, so once the first
+	span is committed a second call may return the rest of it.
+
+	Notes: USING_GENERIC_BUFFER_SPAN_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+	The span is only ever free space, even if the GENERIC_BUFFER was created with OverwriteOldest as TRUE.
+*/
+/**
+		* @brief Returns the largest contiguous run of free space in a GENERIC_BUFFER.
+		* @param *GenericBuffer- A pointer to a GENERIC_BUFFER.
+		* @param *SpanSizeInBytes - Where the number of bytes that can be written is stored.
+		* @return BYTE* - The address of the free space, (BYTE*)NULL if the GENERIC_BUFFER is full.
+		* @note USING_GENERIC_BUFFER_SPAN_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+		* @sa GenericBufferCommitWrite()
+		* @since v1.07
+*/
+#if (USING_GENERIC_BUFFER_SPAN_METHODS == 1)
+	BYTE *GenericBufferGetWriteSpan(GENERIC_BUFFER *GenericBuffer, UINT32 *SpanSizeInBytes);
+#endif // end of USING_GENERIC_BUFFER_SPAN_METHODS
+
+/*
+	Function: UINT32 GenericBufferCommitWrite(GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes)
+
+	Parameters:
+		GENERIC_BUFFER *GenericBuffer - A pointer to the GENENERIC_BUFFER.
+
+		UINT32 NumberOfBytes - The number of bytes which were placed in the span returned
+		by GenericBufferGetWriteSpan().
+
+	Returns:
+		UINT32 - The number of bytes added to the GENERIC_BUFFER.
+
+	Description: Adds bytes which were written directly into the GENERIC_BUFFER to it.  No
+	more than the span returned by GenericBufferGetWriteSpan() can be committed at once.
+
+	Notes: USING_GENERIC_BUFFER_SPAN_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+*/
+/**
+		* @brief Adds the bytes written into a write span to a GENERIC_BUFFER.
+		* @param *GenericBuffer- A pointer to a GENERIC_BUFFER.
+		* @param NumberOfBytes - The number of bytes written into the span.
+		* @return UINT32 - The number of bytes added to the GENERIC_BUFFER.
+		* @note USING_GENERIC_BUFFER_SPAN_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+		* @sa GenericBufferGetWriteSpan()
+		* @since v1.07
+*/
+#if (USING_GENERIC_BUFFER_SPAN_METHODS == 1)
+	UINT32 GenericBufferCommitWrite(GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes);
+#endif // end of USING_GENERIC_BUFFER_SPAN_METHODS
+
+/*
+	Function: BYTE *GenericBufferGetReadSpan(GENERIC_BUFFER *GenericBuffer, UINT32 *SpanSizeInBytes)
+
+	Parameters:
+		GENERIC_BUFFER *GenericBuffer - A pointer to the GENENERIC_BUFFER.
+
+		UINT32 *SpanSizeInBytes - The number of bytes which can be read starting at
+		the returned address is stored here.
+
+	Returns:
+		BYTE* - The address inside the GENERIC_BUFFER of the next byte to be read.
+		(BYTE*)NULL is returned if the GENERIC_BUFFER is empty.
+
+	Description: Returns the largest run of data inside the GENERIC_BUFFER which does not
+	wrap around the end of the Buffer.  The caller can use the data in place and then call
+	GenericBufferConsume() to remove it.  The data may be split in two, so once the first
+	span is consumed a second call may return the rest of it.
+
+	Notes: USING_GENERIC_BUFFER_SPAN_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+*/
+/**
+		* @brief Returns the largest contiguous run of data in a GENERIC_BUFFER.
+		* @param *GenericBuffer- A pointer to a GENERIC_BUFFER.
+		* @param *SpanSizeInBytes - Where the number of bytes that can be read is stored.
+		* @return BYTE* - The address of the data, (BYTE*)NULL if the GENERIC_BUFFER is empty.
+		* @note USING_GENERIC_BUFFER_SPAN_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+		* @sa GenericBufferConsume()
+		* @since v1.07
+*/
+#if (USING_GENERIC_BUFFER_SPAN_METHODS == 1)
+	BYTE *GenericBufferGetReadSpan(GENERIC_BUFFER *GenericBuffer, UINT32 *SpanSizeInBytes);
+#endif // end of USING_GENERIC_BUFFER_SPAN_METHODS
+
+/*
+	Function: UINT32 GenericBufferConsume(GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes)
+
+	Parameters:
+		GENERIC_BUFFER *GenericBuffer - A pointer to the GENENERIC_BUFFER.
+
+		UINT32 NumberOfBytes - The number of bytes to remove from the GENERIC_BUFFER.
+
+	Returns:
+		UINT32 - The number of bytes removed from the GENERIC_BUFFER.
+
+	Description: Removes bytes from the GENERIC_BUFFER without copying them anywhere.  This
+	is used after working on a span from GenericBufferGetReadSpan(), but can also skip
+	data which is not wanted.
+
+	Notes: USING_GENERIC_BUFFER_SPAN_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+*/
+/**
+		* @brief Removes bytes from a GENERIC_BUFFER without copying them.
+		* @param *GenericBuffer- A pointer to a GENERIC_BUFFER.
+		* @param NumberOfBytes - The number of bytes to remove.
+		* @return UINT32 - The number of bytes removed from the GENERIC_BUFFER.
+		* @note USING_GENERIC_BUFFER_SPAN_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+		* @sa GenericBufferGetReadSpan()
+		* @since v1.07
+*/
+#if (USING_GENERIC_BUFFER_SPAN_METHODS == 1)
+	UINT32 GenericBufferConsume(GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes);
+#endif // end of USING_GENERIC_BUFFER_SPAN_METHODS
+
+/*
+	Function: UINT32 GenericBufferGetBytesDropped(GENERIC_BUFFER *GenericBuffer)
+
+	Parameters: 
+		GENERIC_BUFFER *GenericBuffer - A pointer to the GENERIC_BUFFER to get the
+		dropped byte count of.
+
+	Returns:
+		UINT32 - The total number of bytes dropped to make room for newer data.  This
+		wraps back around to 0 once it passes the largest UINT32.
+
+	Description: Returns how many bytes a GENERIC_BUFFER created with OverwriteOldest
+	as TRUE has thrown away.  Take the difference of two calls to see how many were
+	dropped in between.
+
+	Notes: USING_GENERIC_BUFFER_OVERWRITE_MODE in GenericBufferConfig.h must be defined as 1 to use method.
+*/
+/**
+		* @brief Gets the number of bytes a GENERIC_BUFFER dropped to make room for newer data.
+		* @param *GenericBuffer- A pointer to a GENERIC_BUFFER.
+		* @return UINT32 - The total number of bytes dropped.
+		* @note USING_GENERIC_BUFFER_OVERWRITE_MODE in GenericBufferConfig.h must be defined as 1 to use method.
+		* @sa CreateGenericBuffer(), GenericBufferWrite()
+		* @since v1.07
+*/
+#if (USING_GENERIC_BUFFER_OVERWRITE_MODE == 1)
+	UINT32 GenericBufferGetBytesDropped(GENERIC_BUFFER *GenericBuffer);
+#endif // end of USING_GENERIC_BUFFER_OVERWRITE_MODE
+
+/*
+	Function: UINT32 GenericBufferWriteVector(GENERIC_BUFFER *GenericBuffer, const GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, BOOL AllOrNothing)
+
+	Parameters: 
+		GENERIC_BUFFER *GenericBuffer - A pointer to the GENERIC_BUFFER that will be
+		written to.
+
+		const GENERIC_BUFFER_VECTOR *Vectors - An array of the segments to write, they are
+		written in order.
+
+		UINT32 NumberOfVectors - The number of segments in Vectors.
+
+		BOOL AllOrNothing - If TRUE nothing is written unless every segment fits.  If FALSE
+		as many bytes as there is room for are written.  This is ignored if the GENERIC_BUFFER
+		was created with OverwriteOldest as TRUE, every segment is written then.
+
+	Returns:
+		UINT32 - The number of bytes successfully written to the GENERIC_BUFFER.
+
+	Description: Writes several separate segments to the GENERIC_BUFFER as if they were
+	one piece of data.  A header and a payload can be written without first copying them
+	together.
+
+	Notes: USING_GENERIC_BUFFER_VECTOR_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+*/
+/**
+		* @brief Writes several segments to a GENERIC_BUFFER in one call.
+		* @param *GenericBuffer- A pointer to a GENERIC_BUFFER.
+		* @param *Vectors - The segments to write.
+		* @param NumberOfVectors - The number of segments.
+		* @param AllOrNothing - TRUE to write nothing unless all the segments fit.
+		* @return UINT32 - The number of bytes successfully written.
+		* @note USING_GENERIC_BUFFER_VECTOR_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+		* @sa GenericBufferReadVector(), GenericBufferWrite()
+		* @since v1.07
+*/
+#if (USING_GENERIC_BUFFER_VECTOR_METHODS == 1)
+	UINT32 GenericBufferWriteVector(GENERIC_BUFFER *GenericBuffer, const GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, BOOL AllOrNothing);
+#endif // end of USING_GENERIC_BUFFER_VECTOR_METHODS
+
+/*
+	Function: UINT32 GenericBufferReadVector(GENERIC_BUFFER *GenericBuffer, GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, BOOL AllOrNothing)
+
+	Parameters: 
+		GENERIC_BUFFER *GenericBuffer - A pointer to the GENERIC_BUFFER that will be
+		read from.
+
+		GENERIC_BUFFER_VECTOR *Vectors - An array of the segments to read into, they are
+		filled in order.
+
+		UINT32 NumberOfVectors - The number of segments in Vectors.
+
+		BOOL AllOrNothing - If TRUE nothing is read unless there is enough data to fill every
+		segment.  If FALSE as many bytes as there are are read.
+
+	Returns:
+		UINT32 - The number of bytes read from the GENERIC_BUFFER.
+
+	Description: Reads from the GENERIC_BUFFER into several separate segments, filling each
+	one before moving on to the next.
+
+	Notes: USING_GENERIC_BUFFER_VECTOR_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+*/
+/**
+		* @brief Reads from a GENERIC_BUFFER into several segments in one call.
+		* @param *GenericBuffer- A pointer to a GENERIC_BUFFER.
+		* @param *Vectors - The segments to read into.
+		* @param NumberOfVectors - The number of segments.
+		* @param AllOrNothing - TRUE to read nothing unless all the segments can be filled.
+		* @return UINT32 - The number of bytes read.
+		* @note USING_GENERIC_BUFFER_VECTOR_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+		* @sa GenericBufferWriteVector(), GenericBufferRead()
+		* @since v1.07
+*/
+#if (USING_GENERIC_BUFFER_VECTOR_METHODS == 1)
+	UINT32 GenericBufferReadVector(GENERIC_BUFFER *GenericBuffer, GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, BOOL AllOrNothing);
+#endif // end of USING_GENERIC_BUFFER_VECTOR_METHODS
+
+/*
+	Function: BOOL GenericBufferVectorFits(const GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, UINT32 Limit)
+
+	Parameters: 
+		const GENERIC_BUFFER_VECTOR *Vectors - An array of segments.
+
+		UINT32 NumberOfVectors - The number of segments in Vectors.
+
+		UINT32 Limit - The number of bytes the segments are checked against.
+
+	Returns:
+		BOOL - TRUE if all the segments together hold no more than Limit bytes, FALSE otherwise.
+
+	Description: Checks the total size of a set of segments without adding them up, so a
+	total past 4GB can't wrap and look small.  GenericBufferWriteVector() and
+	GenericBufferReadVector() use this for AllOrNothing, and a caller can use it to tell if
+	a vector call moved every segment.
+
+	Notes: USING_GENERIC_BUFFER_VECTOR_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+*/
+/**
+		* @brief Checks if a set of segments holds no more than a given number of bytes.
+		* @param *Vectors - The segments.
+		* @param NumberOfVectors - The number of segments.
+		* @param Limit - The number of bytes to check against.
+		* @return BOOL - TRUE if the segments add up to no more than Limit.
+		* @note USING_GENERIC_BUFFER_VECTOR_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+		* @sa GenericBufferWriteVector(), GenericBufferReadVector()
+		* @since v1.07
+*/
+#if (USING_GENERIC_BUFFER_VECTOR_METHODS == 1)
+	BOOL GenericBufferVectorFits(const GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, UINT32 Limit);
+#endif // end of USING_GENERIC_BUFFER_VECTOR_METHODS
+
+#if (USING_SPSC_GENERIC_BUFFER_METHODS == 1)
+	#ifndef GenericBufferMemoryBarrier
+		#error "GenericBufferMemoryBarrier() must be defined in GenericBufferConfig.h to use the SPSC_GENERIC_BUFFER methods"
+	#endif // end of #ifndef GenericBufferMemoryBarrier
+#endif // end of USING_SPSC_GENERIC_BUFFER_METHODS
+
+/*
+	Function: SPSC_GENERIC_BUFFER *CreateSPSCGenericBuffer(SPSC_GENERIC_BUFFER *GenericBuffer, UINT32 CapacityInBytes, BYTE *Buffer)
+
+	Parameters: 
+		SPSC_GENERIC_BUFFER *GenericBuffer - The address at which the SPSC_GENERIC_BUFFER
+		will be initialized.  If NULL is passed in then this method will 
+		create a SPSC_GENERIC_BUFFER out of a the heap with a call to
+		BufferMemAlloc()(User Supplied Define).
+
+		UINT32 CapacityInBytes - The number of bytes that the SPSC_GENERIC_BUFFER can
+		store.  This must be a power of 2.
+
+		BYTE *Buffer - The address of the pre-determined area in RAM at which
+		the SPSC_GENERIC_BUFFER will store it's data.  If this is NULL then this method
+		will use CapacityInBytes to determine how big of a buffer in RAM to 
+		create through a call to BufferMemAlloc().
+
+	Returns:
+		SPSC_GENERIC_BUFFER* - The address at which the newly initialized SPSC_GENERIC_BUFFER resides
+		in memory.  If a new SPSC_GENERIC_BUFFER could not be created then (SPSC_GENERIC_BUFFER*)NULL is returned.
+
+	Description: Creates a new SPSC_GENERIC_BUFFER in memory.  A SPSC_GENERIC_BUFFER is
+	for exactly one producer (an ISR for example) and one consumer (a TASK for example).
+	The producer only writes the write index and the consumer only writes the read index,
+	so neither side needs a critical section.
+
+	Notes: USING_SPSC_GENERIC_BUFFER_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+*/
+/**
+		* @brief Initializes a SPSC_GENERIC_BUFFER, and can create a SPSC_GENERIC_BUFFER.
+		* @param *GenericBuffer- A pointer to an already allocated SPSC_GENERIC_BUFFER or a NULL
+		pointer to create a SPSC_GENERIC_BUFFER from BufferMemAlloc().
+		* @param CapacityInBytes - This is how big the Buffer will be in bytes.  This must be a power of 2.
+		* @param *Buffer - This is a pointer to a spot in RAM that the SPSC_GENERIC_BUFFER will use for Buffering
+		the data.  If this parameter is equal to (BYTE*)NULL, then BufferMemAlloc() is called.
+		* @return *SPSC_GENERIC_BUFFER - The address of the SPSC_GENERIC_BUFFER in memory, NULL on failure.
+		* @note USING_SPSC_GENERIC_BUFFER_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+		* @sa SPSCGenericBufferDelete()
+		* @since v1.07
+*/
+#if (USING_SPSC_GENERIC_BUFFER_METHODS == 1)
+	SPSC_GENERIC_BUFFER *CreateSPSCGenericBuffer(SPSC_GENERIC_BUFFER *GenericBuffer, UINT32 CapacityInBytes, BYTE *Buffer);
+#endif // end of USING_SPSC_GENERIC_BUFFER_METHODS
+
+/*
+	Function: UINT32 SPSCGenericBufferWrite(SPSC_GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes, const BYTE *DataToWrite)
+
+	Parameters: 
+		SPSC_GENERIC_BUFFER *GenericBuffer - A pointer to the SPSC_GENERIC_BUFFER that 
+		will be written to.
+
+		UINT32 NumberOfBytes - The number of bytes from const BYTE *DataToWrite that will
+		be written to the SPSC_GENERIC_BUFFER.
+
+		const BYTE *DataToWrite - A pointer to the data that will be written.
+
+	Returns:
+		UINT32 - The number of bytes successfully written to the SPSC_GENERIC_BUFFER.
+
+	Description: Writes as many of the bytes as there is room for to the SPSC_GENERIC_BUFFER.
+
+	Notes: USING_SPSC_GENERIC_BUFFER_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+	Only the producer can call this method.
+*/
+/**
+		* @brief Writes to a SPSC_GENERIC_BUFFER from the producer side.
+		* @param *GenericBuffer- A pointer to a SPSC_GENERIC_BUFFER.
+		* @param NumberOfBytes - The number of bytes from const BYTE *DataToWrite to write.
+		* @param *DataToWrite - A pointer to the data that will be written.
+		* @return UINT32 - The number of bytes successfully written.
+		* @note USING_SPSC_GENERIC_BUFFER_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+		* @sa SPSCGenericBufferRead()
+		* @since v1.07
+*/
+#if (USING_SPSC_GENERIC_BUFFER_METHODS == 1)
+	UINT32 SPSCGenericBufferWrite(SPSC_GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes, const BYTE *DataToWrite);
+#endif // end of USING_SPSC_GENERIC_BUFFER_METHODS
+
+/*
+	Function: UINT32 SPSCGenericBufferRead(SPSC_GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes, BYTE *DestinationBuffer)
+
+	Parameters: 
+		SPSC_GENERIC_BUFFER *GenericBuffer - A pointer to the SPSC_GENERIC_BUFFER that 
+		will be read from.
+
+		UINT32 NumberOfBytes - The most bytes to read into DestinationBuffer.
+
+		BYTE *DestinationBuffer - A pointer to the area in RAM that will have the
+		bytes copied to it.
+
+	Returns:
+		UINT32 - The number of bytes read from the SPSC_GENERIC_BUFFER.
+
+	Description: Reads up to the specified number of bytes from the SPSC_GENERIC_BUFFER.
+
+	Notes: USING_SPSC_GENERIC_BUFFER_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+	Only the consumer can call this method.
+*/
+/**
+		* @brief Reads from a SPSC_GENERIC_BUFFER from the consumer side.
+		* @param *GenericBuffer- A pointer to a SPSC_GENERIC_BUFFER.
+		* @param NumberOfBytes - The most bytes to read.
+		* @param *DestinationBuffer - Where the bytes are copied to.
+		* @return UINT32 - The number of bytes read.
+		* @note USING_SPSC_GENERIC_BUFFER_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+		* @sa SPSCGenericBufferWrite()
+		* @since v1.07
+*/
+#if (USING_SPSC_GENERIC_BUFFER_METHODS == 1)
+	UINT32 SPSCGenericBufferRead(SPSC_GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes, BYTE *DestinationBuffer);
+#endif // end of USING_SPSC_GENERIC_BUFFER_METHODS
+
+/*
+	Function: UINT32 SPSCGenericBufferGetSize(SPSC_GENERIC_BUFFER *GenericBuffer)
+
+	Parameters: 
+		SPSC_GENERIC_BUFFER *GenericBuffer - A pointer to the SPSC_GENERIC_BUFFER.
+
+	Returns:
+		UINT32 - The number of bytes in the SPSC_GENERIC_BUFFER.
+
+	Description: Returns how many bytes are in the SPSC_GENERIC_BUFFER.  The other side
+	can change this right after it is read.  The consumer can only see fewer bytes than
+	there really are, and the producer can only see more.
+
+	Notes: USING_SPSC_GENERIC_BUFFER_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+	Only the producer or the consumer can call this method.
+*/
+/**
+		* @brief Returns the number of bytes in a SPSC_GENERIC_BUFFER.
+		* @param *GenericBuffer- A pointer to a SPSC_GENERIC_BUFFER.
+		* @return UINT32 - The number of bytes in the SPSC_GENERIC_BUFFER.
+		* @note USING_SPSC_GENERIC_BUFFER_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+		* @sa SPSCGenericBufferGetRemainingBytes()
+		* @since v1.07
+*/
+#if (USING_SPSC_GENERIC_BUFFER_METHODS == 1)
+	UINT32 SPSCGenericBufferGetSize(SPSC_GENERIC_BUFFER *GenericBuffer);
+#endif // end of USING_SPSC_GENERIC_BUFFER_METHODS
+
+/*
+	Function: UINT32 SPSCGenericBufferGetRemainingBytes(SPSC_GENERIC_BUFFER *GenericBuffer)
+
+	Parameters: 
+		SPSC_GENERIC_BUFFER *GenericBuffer - A pointer to the SPSC_GENERIC_BUFFER.
+
+	Returns:
+		UINT32 - The number of bytes which can currently be written.
+
+	Description: Returns how many bytes can be written to the SPSC_GENERIC_BUFFER.  The
+	same caveat as SPSCGenericBufferGetSize() applies.
+
+	Notes: USING_SPSC_GENERIC_BUFFER_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+	Only the producer or the consumer can call this method.
+*/
+/**
+		* @brief Returns the number of bytes which can be written to a SPSC_GENERIC_BUFFER.
+		* @param *GenericBuffer- A pointer to a SPSC_GENERIC_BUFFER.
+		* @return UINT32 - The number of bytes which can currently be written.
+		* @note USING_SPSC_GENERIC_BUFFER_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+		* @sa SPSCGenericBufferGetSize()
+		* @since v1.07
+*/
+#if (USING_SPSC_GENERIC_BUFFER_METHODS == 1)
+	UINT32 SPSCGenericBufferGetRemainingBytes(SPSC_GENERIC_BUFFER *GenericBuffer);
+#endif // end of USING_SPSC_GENERIC_BUFFER_METHODS
+
+/*
+	Function: BOOL SPSCGenericBufferDelete(SPSC_GENERIC_BUFFER *GenericBuffer, BOOL FreeBufferSpace)
+
+	Parameters: 
+		SPSC_GENERIC_BUFFER *GenericBuffer - A pointer to the SPSC_GENERIC_BUFFER that will
+		be deleted.
+
+		BOOL FreeBufferSpace - Set this to TRUE if the SPSC_GENERIC_BUFFER's buffer space
+		was allocated when CreateSPSCGenericBuffer was called.  FALSE otherwise.
+
+	Returns:
+		BOOL - TRUE if the deletion was successfull, otherwise FALSE.
+
+	Description: Frees the specified SPSC_GENERIC_BUFFER and the buffer space inside it
+	if the user desires.  Neither side can be using it when this is called.
+
+	Notes: USING_SPSC_GENERIC_BUFFER_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+*/
+/**
+		* @brief Deletes the specified SPSC_GENERIC_BUFFER and its buffer if the user wishes.
+		* @param *GenericBuffer- A pointer to a SPSC_GENERIC_BUFFER.
+		* @param FreeBufferSpace - Set to TRUE if the buffer that holds the data should be freed.
+		* @return BOOL - TRUE if the SPSC_GENERIC_BUFFER was successfully deleted, FALSE otherwise.
+		* @note USING_SPSC_GENERIC_BUFFER_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+		* @sa CreateSPSCGenericBuffer()
+		* @since v1.07
+*/
+#if (USING_SPSC_GENERIC_BUFFER_METHODS == 1)
+	BOOL SPSCGenericBufferDelete(SPSC_GENERIC_BUFFER *GenericBuffer, BOOL FreeBufferSpace);
+#endif // end of USING_SPSC_GENERIC_BUFFER_METHODS
+
+#if (USING_GENERIC_BUFFER_SEARCH_METHODS == 1)
+	#if (GENERIC_BUFFER_SEARCH_MAX_PATTERN_SIZE_IN_BYTES > 255)
+		#error "GENERIC_BUFFER_SEARCH_MAX_PATTERN_SIZE_IN_BYTES cannot be larger than 255"
+	#endif // end of GENERIC_BUFFER_SEARCH_MAX_PATTERN_SIZE_IN_BYTES > 255
+#endif // end of USING_GENERIC_BUFFER_SEARCH_METHODS
+
+/*
+	Function: GENERIC_BUFFER_SEARCH *CreateGenericBufferSearch(GENERIC_BUFFER_SEARCH *Search)
+
+	Parameters: 
+		GENERIC_BUFFER_SEARCH *Search - The address at which the GENERIC_BUFFER_SEARCH
+		will be initialized.  If NULL is passed in then this method will 
+		create a GENERIC_BUFFER_SEARCH out of the heap with a call to
+		BufferMemAlloc()(User Supplied Define).
+
+	Returns:
+		GENERIC_BUFFER_SEARCH* - The address at which the newly initialized GENERIC_BUFFER_SEARCH
+		resides in memory.  If a new GENERIC_BUFFER_SEARCH could not be created then
+		(GENERIC_BUFFER_SEARCH*)NULL is returned.
+
+	Description: Creates a new GENERIC_BUFFER_SEARCH with no patterns in it.  Add the
+	patterns with GenericBufferSearchAddPattern().
+
+	Notes: USING_GENERIC_BUFFER_SEARCH_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+*/
+/**
+		* @brief Initializes a GENERIC_BUFFER_SEARCH, and can create a GENERIC_BUFFER_SEARCH.
+		* @param *Search - A pointer to an already allocated GENERIC_BUFFER_SEARCH or a NULL
+		pointer to create a GENERIC_BUFFER_SEARCH from BufferMemAlloc().
+		* @return *GENERIC_BUFFER_SEARCH - The address of the GENERIC_BUFFER_SEARCH in memory, NULL on failure.
+		* @note USING_GENERIC_BUFFER_SEARCH_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+		* @sa GenericBufferSearchAddPattern(), GenericBufferSearchDelete()
+		* @since v1.07
+*/
+#if (USING_GENERIC_BUFFER_SEARCH_METHODS == 1)
+	GENERIC_BUFFER_SEARCH *CreateGenericBufferSearch(GENERIC_BUFFER_SEARCH *Search);
+#endif // end of USING_GENERIC_BUFFER_SEARCH_METHODS
+
+/*
+	Function: BOOL GenericBufferSearchAddPattern(GENERIC_BUFFER_SEARCH *Search, const BYTE *Pattern, UINT32 PatternSizeInBytes)
+
+	Parameters: 
+		GENERIC_BUFFER_SEARCH *Search - A pointer to the GENERIC_BUFFER_SEARCH.
+
+		const BYTE *Pattern - The pattern to search for.  This is copied into the
+		GENERIC_BUFFER_SEARCH.
+
+		UINT32 PatternSizeInBytes - The size of the pattern in bytes.
+
+	Returns:
+		BOOL - TRUE if the pattern was added, FALSE if the pattern is empty, longer than
+		GENERIC_BUFFER_SEARCH_MAX_PATTERN_SIZE_IN_BYTES or there are already
+		GENERIC_BUFFER_SEARCH_MAX_PATTERNS patterns.
+
+	Description: Adds a pattern to the GENERIC_BUFFER_SEARCH.  The pattern's index is the
+	number of patterns added before it.  Adding a pattern starts the search over.
+
+	Notes: USING_GENERIC_BUFFER_SEARCH_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+*/
+/**
+		* @brief Adds a pattern to a GENERIC_BUFFER_SEARCH.
+		* @param *Search - A pointer to a GENERIC_BUFFER_SEARCH.
+		* @param *Pattern - The pattern to search for.
+		* @param PatternSizeInBytes - The size of the pattern in bytes.
+		* @return BOOL - TRUE if the pattern was added, FALSE otherwise.
+		* @note USING_GENERIC_BUFFER_SEARCH_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+		* @sa GenericBufferSearch()
+		* @since v1.07
+*/
+#if (USING_GENERIC_BUFFER_SEARCH_METHODS == 1)
+	BOOL GenericBufferSearchAddPattern(GENERIC_BUFFER_SEARCH *Search, const BYTE *Pattern, UINT32 PatternSizeInBytes);
+#endif // end of USING_GENERIC_BUFFER_SEARCH_METHODS
+
+/*
+	Function: UINT32 GenericBufferSearch(GENERIC_BUFFER *GenericBuffer, GENERIC_BUFFER_SEARCH *Search, UINT32 *PatternIndex)
+
+	Parameters: 
+		GENERIC_BUFFER *GenericBuffer - A pointer to the GENERIC_BUFFER to search.
+
+		GENERIC_BUFFER_SEARCH *Search - A pointer to the GENERIC_BUFFER_SEARCH.
+
+		UINT32 *PatternIndex - The index of the pattern that was found is stored here.  This
+		can be NULL.
+
+	Returns:
+		UINT32 - How many bytes from the read position of the GENERIC_BUFFER up to and including
+		the last byte of the first pattern found.  0 if no pattern was found.
+
+	Description: Searches the GENERIC_BUFFER for the patterns in the GENERIC_BUFFER_SEARCH.
+	Only the bytes which were not searched by the last call are looked at, so calling this
+	every time a few bytes arrive costs no more than searching the data once.  Reading
+	from the GENERIC_BUFFER between calls is fine, once the match is read the search carries
+	on with the bytes after it.  Calling this again before the match is read returns
+	the same match.
+
+	Notes: USING_GENERIC_BUFFER_SEARCH_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+	Only patterns which are entirely in the GENERIC_BUFFER are found.  Searching a different
+	GENERIC_BUFFER starts the search over.
+*/
+/**
+		* @brief Incrementally searches a GENERIC_BUFFER for one or more patterns.
+		* @param *GenericBuffer- A pointer to a GENERIC_BUFFER.
+		* @param *Search - A pointer to a GENERIC_BUFFER_SEARCH.
+		* @param *PatternIndex - Where the index of the pattern found is stored, can be NULL.
+		* @return UINT32 - The number of bytes up to and including the end of the match, 0 if none.
+		* @note USING_GENERIC_BUFFER_SEARCH_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+		* @sa GenericBufferSearchAddPattern(), GenericBufferSearchReset()
+		* @since v1.07
+*/
+#if (USING_GENERIC_BUFFER_SEARCH_METHODS == 1)
+	UINT32 GenericBufferSearch(GENERIC_BUFFER *GenericBuffer, GENERIC_BUFFER_SEARCH *Search, UINT32 *PatternIndex);
+#endif // end of USING_GENERIC_BUFFER_SEARCH_METHODS
+
+/*
+	Function: BOOL GenericBufferSearchReset(GENERIC_BUFFER_SEARCH *Search)
+
+	Parameters: 
+		GENERIC_BUFFER_SEARCH *Search - A pointer to the GENERIC_BUFFER_SEARCH.
+
+	Returns:
+		BOOL - TRUE if the GENERIC_BUFFER_SEARCH was reset, FALSE otherwise.
+
+	Description: Forgets everything searched so far, the patterns are kept.  The next
+	call to GenericBufferSearch() starts from the read position of the GENERIC_BUFFER.
+
+	Notes: USING_GENERIC_BUFFER_SEARCH_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+*/
+/**
+		* @brief Starts a GENERIC_BUFFER_SEARCH over.
+		* @param *Search - A pointer to a GENERIC_BUFFER_SEARCH.
+		* @return BOOL - TRUE if the GENERIC_BUFFER_SEARCH was reset, FALSE otherwise.
+		* @note USING_GENERIC_BUFFER_SEARCH_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+		* @sa GenericBufferSearch()
+		* @since v1.07
+*/
+#if (USING_GENERIC_BUFFER_SEARCH_METHODS == 1)
+	BOOL GenericBufferSearchReset(GENERIC_BUFFER_SEARCH *Search);
+#endif // end of USING_GENERIC_BUFFER_SEARCH_METHODS
+
+/*
+	Function: BOOL GenericBufferSearchDelete(GENERIC_BUFFER_SEARCH *Search)
+
+	Parameters: 
+		GENERIC_BUFFER_SEARCH *Search - A pointer to the GENERIC_BUFFER_SEARCH that will
+		be deleted.
+
+	Returns:
+		BOOL - TRUE if the deletion was successfull, otherwise FALSE.
+
+	Description: Frees a GENERIC_BUFFER_SEARCH which was created out of the heap by
+	CreateGenericBufferSearch().
+
+	Notes: USING_GENERIC_BUFFER_SEARCH_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+*/
+/**
+		* @brief Deletes the specified GENERIC_BUFFER_SEARCH.
+		* @param *Search - A pointer to a GENERIC_BUFFER_SEARCH.
+		* @return BOOL - TRUE if the GENERIC_BUFFER_SEARCH was successfully deleted, FALSE otherwise.
+		* @note USING_GENERIC_BUFFER_SEARCH_METHODS in GenericBufferConfig.h must be defined as 1 to use method.
+		* @sa CreateGenericBufferSearch()
+		* @since v1.07
+*/
+#if (USING_GENERIC_BUFFER_SEARCH_METHODS == 1)
+	BOOL GenericBufferSearchDelete(GENERIC_BUFFER_SEARCH *Search);
+#endif // end of USING_GENERIC_BUFFER_SEARCH_METHODS
+
 /*
 	Function: const BYTE *GenericBufferGetLibraryVersion(void)
 
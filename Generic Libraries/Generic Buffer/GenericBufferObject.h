@@ -24,7 +24,7 @@
 	Developer: brodie
 	Date: July 9, 2015
 	File Name: GenericBufferObject.h
-	Version: 1.06
+	Version: 1.07
 	IDE: Visual Studio 2010 Professional
 	Compiler: C89
 
@@ -38,6 +38,7 @@
 	#define GENERIC_BUFFER_OBJECT_H
 
 #include "GenericTypes.h"
+#include "GenericBufferConfig.h"
 
 /*
 	The following struct is the definition
@@ -77,9 +78,142 @@ struct _GenericBuffer
 		that the GENERIC_BUFFER can write and read.
 	*/
 	BYTE *Buffer;
+
+	#if (USING_GENERIC_BUFFER_SEARCH_METHODS == 1)
+		/*
+			The total number of bytes ever read out of the GENERIC_BUFFER.  This
+			is allowed to wrap and lets a GENERIC_BUFFER_SEARCH work out how much
+			of what it already searched has been read since.
+		*/
+		UINT32 TotalBytesRead;
+	#endif // end of USING_GENERIC_BUFFER_SEARCH_METHODS
+
+	#if (USING_GENERIC_BUFFER_OVERWRITE_MODE == 1)
+		/*
+			If TRUE a write which does not fit drops the oldest data in the
+			GENERIC_BUFFER to make room instead of being cut short.
+		*/
+		BOOL OverwriteOldest;
+
+		/*
+			The total number of bytes dropped to make room for newer data.
+			This is allowed to wrap.
+		*/
+		UINT32 BytesDropped;
+	#endif // end of USING_GENERIC_BUFFER_OVERWRITE_MODE
 };
 
 typedef struct _GenericBuffer GENERIC_BUFFER;
 
+/*
+	The following struct is the definition of the SPSC_GENERIC_BUFFER.
+	This is a GENERIC_BUFFER for exactly one producer and one consumer
+	which needs no critical section on either side.  The producer is
+	the only one to write WriteIndex and the consumer is the only one
+	to write ReadIndex.
+*/
+struct _SPSCGenericBuffer
+{
+	/*
+		The total number of bytes ever written to the SPSC_GENERIC_BUFFER.  This
+		is allowed to wrap and is masked with BufferCapacity - 1 to find the 
+		location inside of Buffer.  Only the producer changes this.
+	*/
+	volatile UINT32 WriteIndex;
+
+	/*
+		The total number of bytes ever read from the SPSC_GENERIC_BUFFER.  The
+		number of bytes in use is always WriteIndex - ReadIndex.  Only the
+		consumer changes this.
+	*/
+	volatile UINT32 ReadIndex;
+
+	/*
+		This variable denotes how many bytes at most a SPSC_GENERIC_BUFFER can
+		hold.  This must be a power of 2.
+	*/
+	UINT32 BufferCapacity;
+
+	/*
+		This is a pointer to the area in RAM that will actually hold the data
+		that the SPSC_GENERIC_BUFFER can write and read.
+	*/
+	BYTE *Buffer;
+};
+
+typedef struct _SPSCGenericBuffer SPSC_GENERIC_BUFFER;
+
+#if (USING_GENERIC_BUFFER_VECTOR_METHODS == 1)
+	/*
+		The following struct is one segment of a vectored write or read.
+		An array of these lets several separate pieces of RAM be moved
+		in or out of a GENERIC_BUFFER in one call.
+	*/
+	struct _GenericBufferVector
+	{
+		/*
+			The data to write, or where the data read is stored.
+		*/
+		BYTE *Data;
+
+		/*
+			How many bytes are in Data.
+		*/
+		UINT32 SizeInBytes;
+	};
+
+	typedef struct _GenericBufferVector GENERIC_BUFFER_VECTOR;
+#endif // end of USING_GENERIC_BUFFER_VECTOR_METHODS
+
+#if (USING_GENERIC_BUFFER_SEARCH_METHODS == 1)
+	/*
+		The following struct is the definition of the GENERIC_BUFFER_SEARCH.
+		This looks for one or more patterns in a GENERIC_BUFFER and remembers
+		how far it got, so each call only looks at the bytes which arrived
+		since the last one.  Every pattern is run through its own KMP matcher.
+	*/
+	struct _GenericBufferSearch
+	{
+		/*
+			The patterns being searched for and how long each one is.
+		*/
+		BYTE Pattern[GENERIC_BUFFER_SEARCH_MAX_PATTERNS][GENERIC_BUFFER_SEARCH_MAX_PATTERN_SIZE_IN_BYTES];
+		BYTE PatternSizeInBytes[GENERIC_BUFFER_SEARCH_MAX_PATTERNS];
+
+		/*
+			The KMP failure table of each pattern.  FailureTable[i][j] is how many
+			bytes of the pattern are still matched after a mismatch following
+			j + 1 matched bytes.
+		*/
+		BYTE FailureTable[GENERIC_BUFFER_SEARCH_MAX_PATTERNS][GENERIC_BUFFER_SEARCH_MAX_PATTERN_SIZE_IN_BYTES];
+
+		/*
+			How many bytes of each pattern the last searched bytes matched.
+		*/
+		BYTE MatchedBytes[GENERIC_BUFFER_SEARCH_MAX_PATTERNS];
+
+		UINT32 NumberOfPatterns;
+
+		/*
+			The GENERIC_BUFFER last searched, and its TotalBytesRead at the time.
+		*/
+		GENERIC_BUFFER *GenericBuffer;
+		UINT32 TotalBytesRead;
+
+		/*
+			How many bytes from the read position have already been searched.
+		*/
+		UINT32 BytesSearched;
+
+		/*
+			The index + 1 of the pattern which ended at BytesSearched, or 0 if
+			no match has been found yet.
+		*/
+		UINT32 MatchedPattern;
+	};
+
+	typedef struct _GenericBufferSearch GENERIC_BUFFER_SEARCH;
+#endif // end of USING_GENERIC_BUFFER_SEARCH_METHODS
+
 
 #endif // end of GENERIC_BUFFER_OBJECT_H
@@ -32,7 +32,7 @@
 //----------------------------------------------------------------------------------------------------
 
 // This is version v1.02.01 release of the RTOSConfig.h file.
-#define RTOS_CONFIG_H_VERSION                                   0x00000009
+#define RTOS_CONFIG_H_VERSION                                   0x0000000A
 
 // OS_PRIORITY is the priority of the OS compared to interrupts.  When an OS call is made the
 // interrupt priority will be set to OS_PRIORITY so that interrupts of OS_PRIORITY level or lower
@@ -146,12 +146,45 @@
 // USING_REALLOC_MEMORY_METHOD must be defined as a 1 to use the ReallocMemory() method.
 #define USING_REALLOC_MEMORY_METHOD								0
 
+// USING_ALLOCATE_ALIGNED_MEMORY_METHOD must be defined as a 1 to use the AllocateAlignedMemory() method.
+#define USING_ALLOCATE_ALIGNED_MEMORY_METHOD                    0
+
 // USING_GET_HEAP_USED_IN_BYTES_METHOD must be defined as a 1 to use the GetHeapUsedInBytes() method.
 #define USING_GET_HEAP_USED_IN_BYTES_METHOD                     0
 
 // USING_GET_HEAP_REMAINING_IN_BYTES_METHOD must be defined as a 1 to use the GetHeapRemainingInBytes() method.
 #define USING_GET_HEAP_REMAINING_IN_BYTES_METHOD                0
 
+// USING_GET_HEAP_STATISTICS_METHOD must be defined as a 1 to use the GetHeapStatistics() method.
+#define USING_GET_HEAP_STATISTICS_METHOD                        0
+
+// HEAP_STATISTICS_SIZE_CLASSES is how many size classes GetHeapStatistics() sorts free
+// blocks into.  The first class is blocks under 32 bytes and each class after it is twice
+// as large, the last class holds everything bigger.
+#define HEAP_STATISTICS_SIZE_CLASSES                            8
+
+// HEAP_STATISTICS_BLOCKS_PER_CHUNK is how many blocks GetHeapStatistics() looks at
+// before it leaves the critical section to let interrupts and other TASKs run.
+#define HEAP_STATISTICS_BLOCKS_PER_CHUNK                        16
+
+// HEAP_STATISTICS_MAXIMUM_RESTARTS is how many times GetHeapStatistics() will start over
+// because the heap changed while it was walking it before giving up.
+#define HEAP_STATISTICS_MAXIMUM_RESTARTS                        4
+
+// USING_CHECK_HEAP_INTEGRITY_METHOD must be defined as a 1 to use the CheckHeapIntegrity() method.
+#define USING_CHECK_HEAP_INTEGRITY_METHOD                       0
+
+// USING_MEMORY_TRACE if set to a 1 will record every allocation, release and resize of
+// the OS heap into a ring buffer.  Each record holds the OS tick, the TASK, the address
+// of the code which called into the heap, the size and the pointer.  Read the records
+// with MemoryTraceRead() or IOBufferWriteMemoryTrace() and feed them to
+// Tools/MemoryTraceAnalyzer.py to find leaks and allocation hotspots.
+#define USING_MEMORY_TRACE                                      0
+
+// MEMORY_TRACE_SIZE_IN_RECORDS is how many records the memory trace ring buffer holds.
+// Once it is full the oldest record is dropped for each new one.  Each record is 24 bytes.
+#define MEMORY_TRACE_SIZE_IN_RECORDS                            64
+
 // MEMORY_WARNING_LEVEL_IN_BYTES when MEMORY_WARNING_LEVEL_IN_BYTES are used the
 // USING_MEMORY_WARNING_EVENT is raised if enabled and the USING_MEMORY_WARNING_USER_CALLBACK
 // is called if enabled.
@@ -161,12 +194,91 @@
 // CallocMemory() use the memory from the OS heap.
 #define OS_HEAP_SIZE_IN_BYTES                                   50000
 
+// USING_TLSF_MEMORY_ALLOCATOR if set to a 1 will manage the OS heap with a two level
+// segregated fit allocator instead of the first fit allocator.  Free blocks are kept on
+// lists sorted by size class so AllocateMemory() and ReleaseMemory() take the same amount
+// of time no matter how fragmented the heap is.  The cost is a small table of free lists
+// and requests being rounded up to the next size class when searching, so a single
+// allocation of nearly the whole heap will not succeed.
+#define USING_TLSF_MEMORY_ALLOCATOR                             0
+
+// TLSF_SECOND_LEVEL_INDEX_COUNT_LOG2 is how many size classes each power of 2 is split
+// into by the TLSF allocator, as a power of 2.  More classes waste less memory per
+// allocation but make the free list table larger.  This cannot exceed 5.
+#define TLSF_SECOND_LEVEL_INDEX_COUNT_LOG2                      4
+
+// TLSF_MAXIMUM_BLOCK_SIZE_LOG2 is the power of 2 that every block in the OS heap must be
+// smaller than when using the TLSF allocator.  2 raised to this must be larger than
+// OS_HEAP_SIZE_IN_BYTES.
+#define TLSF_MAXIMUM_BLOCK_SIZE_LOG2                            16
+
+// USING_HEAP_REGIONS if set to a 1 allows more areas of RAM to be handed to the OS with
+// AddHeapRegion() before the OS is started, like uncached RAM for DMA buffers, external
+// RAM or a small fast RAM for TASK stacks.  AllocateMemoryFromRegion() allocates from one
+// region only, AllocateMemory() tries the default region first then every other region
+// that was added as general purpose.  Each region keeps its own statistics, read them with
+// GetHeapRegionStatistics().  With the TLSF allocator each region has its own table of
+// free lists.
+#define USING_HEAP_REGIONS                                      0
+
+// NUMBER_OF_HEAP_REGIONS is how many heap regions there can be, including the OS heap
+// which is always region OS_HEAP_REGION_ID.
+#define NUMBER_OF_HEAP_REGIONS                                  4
+
+// USING_TASK_STACK_ARENA if set to a 1 will allocate TASK stacks from an area of RAM
+// set aside for them instead of the heap, so a TASK being deleted and created again does
+// not leave holes between the small blocks of the heap.  The arena is a buddy allocator,
+// every stack is rounded up to a power of 2 and a released stack merges back with its
+// buddy.  A stack which does not fit in the arena is allocated from the heap instead.
+#define USING_TASK_STACK_ARENA                                  0
+
+// TASK_STACK_ARENA_SIZE_LOG2 is the size of the TASK stack arena in bytes as a power of 2.
+#define TASK_STACK_ARENA_SIZE_LOG2                              14
+
+// TASK_STACK_ARENA_MINIMUM_BLOCK_SIZE_LOG2 is the smallest block the TASK stack arena
+// hands out in bytes as a power of 2.  A smaller stack still takes a block this size.
+#define TASK_STACK_ARENA_MINIMUM_BLOCK_SIZE_LOG2                9
+
+// USING_TASK_HEAP_ACCOUNTING if set to a 1 will tag every block allocated with
+// AllocateMemory() with the TASK that asked for it, and keep how many bytes of the heap
+// each TASK has and the most it has ever had.  Memory the OS allocates for itself, like
+// TASK stacks, is not counted against any TASK.  This makes the memory header 4 bytes larger.
+#define USING_TASK_HEAP_ACCOUNTING                              0
+
+// USING_TASK_HEAP_QUOTA if set to a 1 allows a limit to be put on how many bytes of the
+// heap a TASK can have.  AllocateMemory() fails for a TASK that would go over its limit.
+// USING_TASK_HEAP_ACCOUNTING must be set to a 1 to use this.
+#define USING_TASK_HEAP_QUOTA                                   0
+
+// USING_TASK_HEAP_RECLAIM if set to a 1 will release every block a TASK still has in
+// the heap when the TASK is deleted or restarted.  That is every block the TASK allocated,
+// including blocks it handed to an ISR or another TASK which are still in use.  Only use
+// this if TASKs never hand memory, or objects they created in the heap, over to anyone
+// else.  Memory an ISR allocates with AllocateMemoryFromISR() is owned by no TASK and is
+// never reclaimed.  USING_TASK_HEAP_ACCOUNTING must be set to a 1 to use this.
+#define USING_TASK_HEAP_RECLAIM                                 0
+
+// TASK_HEAP_RECLAIM_BLOCKS_PER_CHUNK is how many blocks are looked at while reclaiming
+// the heap of a TASK before the critical section is left to let interrupts and other TASKs run.
+#define TASK_HEAP_RECLAIM_BLOCKS_PER_CHUNK                      16
+
+// TASK_HEAP_RECLAIM_MAXIMUM_RESTARTS is how many times the reclaim will start over because
+// the heap changed while it was out of the critical section.  After that the rest of the
+// heap is walked without leaving the critical section, so the reclaim always finishes.
+#define TASK_HEAP_RECLAIM_MAXIMUM_RESTARTS                      4
+
 // OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES is the size of the memory header in the heap.
 // This allows the system to know how big of a jump to take to get to the data of an
 // allocated section in the heap.  The memory header always has the first bit to denote
-// if it is free or not, and the remaining bits denote how large the section is.  Until
-// further notice this should always be 4.
-#define OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES   					4
+// if it is free or not, the remaining bits denote how large the section is, and the next
+// word denotes how large the section before it is.  With USING_TASK_HEAP_ACCOUNTING the
+// word after that points to the TASK which owns the section.  Until further notice this
+// should be left as is.
+#if (USING_TASK_HEAP_ACCOUNTING == 1)
+    #define OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES                12
+#else
+    #define OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES                8
+#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
 
 // CLEAR_HEAP_AT_START_UP if set to 1 will initialize the OS heap with the value located
 // inside of HEAP_INITIALIZATION_VALUE.
@@ -175,11 +287,46 @@
 // HEAP_INITIALIZATION_VALUE is the value the OS will put in the OS heap at startup.
 // CLEAR_HEAP_AT_START_UP must be set to a 1 for this to have any meaning.  At startup
 // the OS will call the following function to set the values in the heap:
-// memset(&gKernelManagedMemory[1], HEAP_INITIALIZATION_VALUE, (OS_HEAP_SIZE_IN_BYTES / OS_WORD_SIZE_IN_BYTES));
+// memset(&gKernelManagedMemory[OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES / 4], HEAP_INITIALIZATION_VALUE, OS_HEAP_SIZE_IN_BYTES);
 #define HEAP_INITIALIZATION_VALUE								(OS_WORD)0
 //----------------------------------------------------------------------------------------------------
 
 
+// Memory Pool Configurations
+//----------------------------------------------------------------------------------------------------
+
+// USING_CHECK_MEMORY_POOL_PARAMETERS if set to 1 will enable the code 
+// which checks the parameters of data coming into any method in MemoryPool.c.  
+// This is useful for debugging code to make sure junk isn't being put into
+// the system.  It is up to you if you want to use it during runtime.
+#define USING_CHECK_MEMORY_POOL_PARAMETERS                      0
+
+// USING_MEMORY_POOL_ALLOCATE_METHOD if set to a 1 will allow the user to take
+// a block out of a MEMORY_POOL from a TASK.
+#define USING_MEMORY_POOL_ALLOCATE_METHOD                       0
+
+// USING_MEMORY_POOL_RELEASE_METHOD if set to a 1 will allow the user to return
+// a block to a MEMORY_POOL from a TASK.
+#define USING_MEMORY_POOL_RELEASE_METHOD                        0
+
+// USING_MEMORY_POOL_WAIT_FOR_BLOCK_METHOD if set to a 1 will allow a TASK to
+// block on an empty MEMORY_POOL until a block is released back to it.
+#define USING_MEMORY_POOL_WAIT_FOR_BLOCK_METHOD                 0
+
+// USING_MEMORY_POOL_GET_BLOCKS_FREE_METHOD if set to a 1 will allow the user to
+// get how many blocks are left in a MEMORY_POOL.
+#define USING_MEMORY_POOL_GET_BLOCKS_FREE_METHOD                0
+
+// USING_MEMORY_POOL_STATISTICS if set to a 1 will make each MEMORY_POOL record
+// the most blocks it ever had out at once and how many requests it could not fill.
+#define USING_MEMORY_POOL_STATISTICS                            0
+
+// USING_DELETE_MEMORY_POOL_METHOD if set to a 1 will allow the user to delete a
+// MEMORY_POOL and give back anything it took from the OS heap.
+#define USING_DELETE_MEMORY_POOL_METHOD                         0
+//----------------------------------------------------------------------------------------------------
+
+
 // Idle Task Configurations
 //----------------------------------------------------------------------------------------------------
 
@@ -221,10 +368,6 @@
 
 // These are the arguments passed to the Maintenance Task at startup.
 #define MAINTENANCE_TASK_ARGS									(void*)NULL
-
-// This is how many OS Ticks the Maintenance Task will delay for, before it 
-// runs again to see if any TASKS need deleting or restarting.
-#define MAINTENANCE_TASK_DELAY_TICKS                            200
 //----------------------------------------------------------------------------------------------------
 
 
@@ -244,8 +387,10 @@
 // These are the arguments passed to the IO Buffer Task at startup.
 #define IO_BUFFER_TASK_ARGS                                     (void*)NULL
 
-// This is how many OS Ticks the Buffer Task will delay for, before it 
-// runs again to see if any data can be read or written in from or out to a peripheral port.
+// The Buffer Task blocks until an interrupt flags an IO_BUFFER which still has data in
+// the hardware.  It also wakes up after this many OS Ticks to check every peripheral port
+// for data that is sitting below the RX interrupt trigger level.  That data never raises
+// an interrupt, so only set this to 0 if every RX trigger level is a single byte.
 #define IO_BUFFER_TASK_PERIODICITY_IN_OS_TICKS                  100
 //----------------------------------------------------------------------------------------------------
 
@@ -263,6 +408,8 @@
 // task check in.  WHen a TASK registers for check in it lets the OS
 // know how often it needs to check in.  If the TASK does not check in
 // at the alloted time the OS will either delete or restart the TASK.
+// USING_INSERT_NODE_IN_ORDER_OF_DOUBLE_LINKED_LIST_METHOD in
+// DoubleLinkedListConfig.h must also be 1 to keep the check ins in order.
 #define USING_TASK_CHECK_IN										0
 
 // USING_DELETE_TASK if set to 1 allows the user to delete a TASK.
@@ -360,6 +507,34 @@
 // This is the value to fill the TASK stack with if ANALYZE_TASK_STACK_USAGE
 // is set to a 1.  This is done at TASK creation time.
 #define TASK_STACK_FILL_VALUE                                   0xDEADBEEF
+
+// USING_TASK_STACK_HIGH_WATER_MARK if set to a 1 will have the OS record
+// the lowest stack pointer seen for each TASK at every context switch.
+// This allows the stack usage of every TASK to be reported without
+// scanning the TASK stacks.
+#define USING_TASK_STACK_HIGH_WATER_MARK                        0
+
+// TASK_STACK_HIGH_WATER_MARK_GUARD_WORDS is how many words below the
+// recorded high water mark are sampled at each context switch for
+// values other than TASK_STACK_FILL_VALUE.  This catches stack usage
+// that happened between context switches.  Set to 0 to disable the
+// sampling.  ANALYZE_TASK_STACK_USAGE must be 1 to use this.
+#define TASK_STACK_HIGH_WATER_MARK_GUARD_WORDS                  0
+
+// USING_TASK_STACK_GUARD_WORD if set to a 1 will write TASK_STACK_GUARD_WORD_VALUE into
+// the lowest word of each TASK stack, and check it is still there at every context switch.
+// This catches an overflow even if the stack pointer is back in bounds by the time the
+// TASK is switched out.  The guard word comes out of the stack size given to CreateTask().
+// USING_CHECK_TASK_STACK_FOR_OVERFLOW must be 1 to use this.
+#define USING_TASK_STACK_GUARD_WORD                             0
+
+// TASK_STACK_GUARD_WORD_VALUE is the value of the TASK stack guard word.  It should be
+// different from TASK_STACK_FILL_VALUE.
+#define TASK_STACK_GUARD_WORD_VALUE                             0xFEEDFACE
+
+// USING_TASK_STACK_REPORT_TO_STRING_METHOD if set to a 1 will enable
+// the method TaskStackReportToString().
+#define USING_TASK_STACK_REPORT_TO_STRING_METHOD                0
 //----------------------------------------------------------------------------------------------------
 
 
@@ -823,6 +998,17 @@
 // to specify a method for freeing data which a MESSAGE_QUEUE additional data pointer
 // points to.
 #define USING_MESSAGE_QUEUE_ADDITIONAL_DATA_FREE_METHOD			1
+
+// USING_MESSAGE_QUEUE_MEMORY_POOL if set to a 1 will make every MESSAGE_QUEUE take
+// its nodes from a MEMORY_POOL shared by all MESSAGE_QUEUEs instead of the OS heap.
+// Adding and removing messages is then constant time and never fragments the heap,
+// but the total number of messages in all MESSAGE_QUEUEs is limited.
+#define USING_MESSAGE_QUEUE_MEMORY_POOL                         0
+
+// MESSAGE_QUEUE_MEMORY_POOL_SIZE_IN_NODES is how many messages all MESSAGE_QUEUEs
+// can hold at once.  USING_MESSAGE_QUEUE_MEMORY_POOL must be set to a 1 for this to
+// have any meaning.
+#define MESSAGE_QUEUE_MEMORY_POOL_SIZE_IN_NODES                 32
 //----------------------------------------------------------------------------------------------------
 
 
@@ -851,6 +1037,10 @@
 // to check a PIPE for a sequence of bytes from an ISR.
 #define USING_PIPE_CONTAINS_SEQUENCE_FROM_ISR_METHOD			0
 
+// USING_PIPE_SEARCH_FROM_ISR_METHOD if set to a 1 will allow the user to search
+// a PIPE with a GENERIC_BUFFER_SEARCH from an ISR.
+#define USING_PIPE_SEARCH_FROM_ISR_METHOD						0
+
 // USING_PIPE_SEEK_FROM_ISR_METHOD if set to a 1 will allow the user to find how
 // deep in the PIPE a particular value is from an ISR.
 #define USING_PIPE_SEEK_FROM_ISR_METHOD							0
@@ -867,6 +1057,14 @@
 // to get how many bytes left in the PIPE there are for writing until full from an ISR.
 #define USING_PIPE_GET_REMAINING_BYTES_FROM_ISR_METHOD			0
 
+// USING_PIPE_SPAN_FROM_ISR_METHODS if set to a 1 will allow the user to write
+// and read data in place inside of a PIPE from an ISR.
+#define USING_PIPE_SPAN_FROM_ISR_METHODS						0
+
+// USING_PIPE_VECTOR_FROM_ISR_METHODS if set to a 1 will allow the user to write
+// and read several separate segments of data to and from a PIPE at once from an ISR.
+#define USING_PIPE_VECTOR_FROM_ISR_METHODS						0
+
 // USING_PIPE_DELETE_FROM_ISR_METHOD if set to a 1 will allow the user to delete a
 // PIPE that was previously allocated in the OS heap from an ISR.
 #define USING_PIPE_DELETE_FROM_ISR_METHOD						0
@@ -875,6 +1073,12 @@
 // starvation protection enabled on all PIPEs.
 #define USING_PIPE_STARVATION_PROTECTION                        0
 
+// USING_PIPE_OVERWRITE_MODE if set to a 1 will allow the user to create a PIPE
+// which drops its oldest data to make room for a write instead of blocking the
+// writer.  This adds a parameter to CreatePipe() and enables PipeGetBytesDropped()
+// and PipeGetBytesDroppedFromISR().
+#define USING_PIPE_OVERWRITE_MODE                               0
+
 // USING_PIPE_PEEK_METHOD if set to a 1 will allow the user to peek at data
 // in the PIPE.
 #define USING_PIPE_PEEK_METHOD                                  0
@@ -891,6 +1095,10 @@
 // if a PIPE has a sequence of bytes in it.
 #define USING_PIPE_CONTAINS_SEQUENCE_METHOD						0
 
+// USING_PIPE_SEARCH_METHOD if set to a 1 will allow the user to search a PIPE
+// for one or more patterns, only looking at bytes not searched by the last call.
+#define USING_PIPE_SEARCH_METHOD								0
+
 // USING_PIPE_SEEK_METHOD if set to a 1 will allow the user to see how many bytes
 // deep a particular value is in the PIPE.
 #define USING_PIPE_SEEK_METHOD									0
@@ -907,6 +1115,14 @@
 // get how many remaining bytes are left in the PIPE until it is full.
 #define USING_PIPE_GET_REMAINING_BYTES_METHOD					0
 
+// USING_PIPE_SPAN_METHODS if set to a 1 will allow the user to write and read
+// data in place inside of a PIPE without copying it through a buffer of their own.
+#define USING_PIPE_SPAN_METHODS									0
+
+// USING_PIPE_VECTOR_METHODS if set to a 1 will allow the user to write and read
+// several separate segments of data to and from a PIPE in one critical section.
+#define USING_PIPE_VECTOR_METHODS								0
+
 // USING_PIPE_DELETE_METHOD if set to a 1 will allow the user to delete a 
 // PIPE which was created in the OS heap.
 #define USING_PIPE_DELETE_METHOD								0
@@ -950,6 +1166,10 @@
 // All data will be transmitted.
 #define USING_IO_BUFFER_WRITE_UNTIL_METHOD                      0
 
+// USING_IO_BUFFER_WRITE_MEMORY_TRACE_METHOD if set to a 1 will allow the user
+// to write the records of the memory trace to an IO_BUFFER as lines of text.
+#define USING_IO_BUFFER_WRITE_MEMORY_TRACE_METHOD               0
+
 // USING_IO_BUFFER_WRITE_LINE_METHOD if set to a 1 will allow the user to write
 // a specified number of bytes to an IO_BUFFER.  Then the end of line sequence
 // is written to the IO_BUFFER.  All data will be transmitted.
@@ -967,6 +1187,11 @@
 // if an IO_BUFFER has a certain byte sequence in it.
 #define USING_IO_BUFFER_CONTAINS_SEQUENCE_METHOD                0
 
+// USING_IO_BUFFER_SEARCH_METHODS if set to a 1 will allow the user to search
+// an IO_BUFFER with a GENERIC_BUFFER_SEARCH.  IOBufferReadUntil() and IOBufferReadLine()
+// will also remember how far they searched instead of searching the IO_BUFFER again.
+#define USING_IO_BUFFER_SEARCH_METHODS                          0
+
 // USING_IO_BUFFER_PEEK_METHOD if set to a 1 will allow the user to peek at
 // data within the IO_BUFFER.
 #define USING_IO_BUFFER_PEEK_METHOD                             0
@@ -987,6 +1212,14 @@
 // the user to get the number of bytes an IO_BUFFER can store overall.
 #define USING_IO_BUFFER_GET_CAPACITY_METHOD                     0
 
+// USING_IO_BUFFER_SPAN_METHODS if set to a 1 will allow the user to parse
+// received data and build data to transmit in place inside of an IO_BUFFER.
+#define USING_IO_BUFFER_SPAN_METHODS                            0
+
+// USING_IO_BUFFER_VECTOR_METHODS if set to a 1 will allow the user to read
+// and write several separate segments of data in one critical section.
+#define USING_IO_BUFFER_VECTOR_METHODS                          0
+
 // USING_IO_BUFFER_GET_NEW_LINE_METHOD if set to a 1 will allow the user
 // to get the new line sequence associated with the IO_BUFFER.
 #define USING_IO_BUFFER_GET_NEW_LINE_METHOD                     0
@@ -1274,6 +1507,84 @@
         #error "If USING_TASK_RUNTIME_HISTORY == 1, TASK_RUNTIME_HISTORY_SIZE_IN_TASKS must be greater than 2!"
     #endif // end of #if (TASK_RUNTIME_HISTORY_SIZE_IN_TASKS < 3)
 #endif // end of #if (USING_TASK_RUNTIME_HISTORY == 1)
+
+#if (TASK_STACK_HIGH_WATER_MARK_GUARD_WORDS > 0)
+    #if (USING_TASK_STACK_HIGH_WATER_MARK != 1 || ANALYZE_TASK_STACK_USAGE != 1)
+        #error "If TASK_STACK_HIGH_WATER_MARK_GUARD_WORDS > 0, USING_TASK_STACK_HIGH_WATER_MARK and ANALYZE_TASK_STACK_USAGE must be 1!"
+    #endif // end of #if (USING_TASK_STACK_HIGH_WATER_MARK != 1 || ANALYZE_TASK_STACK_USAGE != 1)
+#endif // end of #if (TASK_STACK_HIGH_WATER_MARK_GUARD_WORDS > 0)
+
+#if (USING_TASK_STACK_GUARD_WORD == 1 && USING_CHECK_TASK_STACK_FOR_OVERFLOW != 1)
+    #error "If USING_TASK_STACK_GUARD_WORD == 1, USING_CHECK_TASK_STACK_FOR_OVERFLOW must be 1!"
+#endif // end of #if (USING_TASK_STACK_GUARD_WORD == 1 && USING_CHECK_TASK_STACK_FOR_OVERFLOW != 1)
+
+#if (USING_TASK_STACK_REPORT_TO_STRING_METHOD == 1 && USING_TASK_STACK_HIGH_WATER_MARK != 1)
+    #error "If USING_TASK_STACK_REPORT_TO_STRING_METHOD == 1, USING_TASK_STACK_HIGH_WATER_MARK must be 1!"
+#endif // end of #if (USING_TASK_STACK_REPORT_TO_STRING_METHOD == 1 && USING_TASK_STACK_HIGH_WATER_MARK != 1)
+
+#if (USING_TASK_HEAP_ACCOUNTING == 1)
+    #if (OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES != 12)
+        #error "OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES must be 12 if USING_TASK_HEAP_ACCOUNTING == 1!"
+    #endif // end of #if (OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES != 12)
+#else
+    #if (OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES != 8)
+        #error "OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES must be 8!"
+    #endif // end of #if (OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES != 8)
+#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
+
+#if ((USING_TASK_HEAP_QUOTA == 1 || USING_TASK_HEAP_RECLAIM == 1) && USING_TASK_HEAP_ACCOUNTING != 1)
+    #error "If USING_TASK_HEAP_QUOTA == 1 or USING_TASK_HEAP_RECLAIM == 1, USING_TASK_HEAP_ACCOUNTING must be 1!"
+#endif // end of #if ((USING_TASK_HEAP_QUOTA == 1 || USING_TASK_HEAP_RECLAIM == 1) && USING_TASK_HEAP_ACCOUNTING != 1)
+
+#if (USING_TASK_HEAP_RECLAIM == 1 && TASK_HEAP_RECLAIM_BLOCKS_PER_CHUNK == 0)
+    #error "If USING_TASK_HEAP_RECLAIM == 1, TASK_HEAP_RECLAIM_BLOCKS_PER_CHUNK cannot be 0!"
+#endif // end of #if (USING_TASK_HEAP_RECLAIM == 1 && TASK_HEAP_RECLAIM_BLOCKS_PER_CHUNK == 0)
+
+#if (USING_GET_HEAP_STATISTICS_METHOD == 1)
+    #if (HEAP_STATISTICS_SIZE_CLASSES == 0)
+        #error "If USING_GET_HEAP_STATISTICS_METHOD == 1, HEAP_STATISTICS_SIZE_CLASSES cannot be 0!"
+    #endif // end of #if (HEAP_STATISTICS_SIZE_CLASSES == 0)
+
+    #if (HEAP_STATISTICS_BLOCKS_PER_CHUNK == 0)
+        #error "If USING_GET_HEAP_STATISTICS_METHOD == 1, HEAP_STATISTICS_BLOCKS_PER_CHUNK cannot be 0!"
+    #endif // end of #if (HEAP_STATISTICS_BLOCKS_PER_CHUNK == 0)
+#endif // end of #if (USING_GET_HEAP_STATISTICS_METHOD == 1)
+
+#if (USING_MEMORY_TRACE == 1 && MEMORY_TRACE_SIZE_IN_RECORDS == 0)
+    #error "If USING_MEMORY_TRACE == 1, MEMORY_TRACE_SIZE_IN_RECORDS cannot be 0!"
+#endif // end of #if (USING_MEMORY_TRACE == 1 && MEMORY_TRACE_SIZE_IN_RECORDS == 0)
+
+#if (USING_IO_BUFFER_WRITE_MEMORY_TRACE_METHOD == 1 && (USING_MEMORY_TRACE != 1 || USING_IO_BUFFER_WRITE_BYTES_METHOD != 1))
+    #error "If USING_IO_BUFFER_WRITE_MEMORY_TRACE_METHOD == 1, USING_MEMORY_TRACE and USING_IO_BUFFER_WRITE_BYTES_METHOD must be 1!"
+#endif // end of #if (USING_IO_BUFFER_WRITE_MEMORY_TRACE_METHOD == 1 && (USING_MEMORY_TRACE != 1 || USING_IO_BUFFER_WRITE_BYTES_METHOD != 1))
+
+#if (USING_HEAP_REGIONS == 1 && NUMBER_OF_HEAP_REGIONS < 2)
+    #error "If USING_HEAP_REGIONS == 1, NUMBER_OF_HEAP_REGIONS must be at least 2!"
+#endif // end of #if (USING_HEAP_REGIONS == 1 && NUMBER_OF_HEAP_REGIONS < 2)
+
+#if (USING_TASK_STACK_ARENA == 1)
+    #if (TASK_STACK_ARENA_MINIMUM_BLOCK_SIZE_LOG2 < 3 || TASK_STACK_ARENA_MINIMUM_BLOCK_SIZE_LOG2 > TASK_STACK_ARENA_SIZE_LOG2)
+        #error "If USING_TASK_STACK_ARENA == 1, TASK_STACK_ARENA_MINIMUM_BLOCK_SIZE_LOG2 must be from 3 to TASK_STACK_ARENA_SIZE_LOG2!"
+    #endif // end of #if (TASK_STACK_ARENA_MINIMUM_BLOCK_SIZE_LOG2 < 3 || TASK_STACK_ARENA_MINIMUM_BLOCK_SIZE_LOG2 > TASK_STACK_ARENA_SIZE_LOG2)
+
+    #if (TASK_STACK_ARENA_SIZE_LOG2 - TASK_STACK_ARENA_MINIMUM_BLOCK_SIZE_LOG2 > 16)
+        #error "If USING_TASK_STACK_ARENA == 1, the TASK stack arena can hold at most 65536 minimum sized blocks!"
+    #endif // end of #if (TASK_STACK_ARENA_SIZE_LOG2 - TASK_STACK_ARENA_MINIMUM_BLOCK_SIZE_LOG2 > 16)
+#endif // end of #if (USING_TASK_STACK_ARENA == 1)
+
+#if (USING_MESSAGE_QUEUE_MEMORY_POOL == 1 && MESSAGE_QUEUE_MEMORY_POOL_SIZE_IN_NODES == 0)
+    #error "If USING_MESSAGE_QUEUE_MEMORY_POOL == 1, MESSAGE_QUEUE_MEMORY_POOL_SIZE_IN_NODES cannot be 0!"
+#endif // end of #if (USING_MESSAGE_QUEUE_MEMORY_POOL == 1 && MESSAGE_QUEUE_MEMORY_POOL_SIZE_IN_NODES == 0)
+
+#if (USING_TLSF_MEMORY_ALLOCATOR == 1)
+    #if (TLSF_SECOND_LEVEL_INDEX_COUNT_LOG2 < 1 || TLSF_SECOND_LEVEL_INDEX_COUNT_LOG2 > 5)
+        #error "TLSF_SECOND_LEVEL_INDEX_COUNT_LOG2 must be between 1 and 5!"
+    #endif // end of #if (TLSF_SECOND_LEVEL_INDEX_COUNT_LOG2 < 1 || TLSF_SECOND_LEVEL_INDEX_COUNT_LOG2 > 5)
+
+    #if (TLSF_MAXIMUM_BLOCK_SIZE_LOG2 > 31 || (1UL << TLSF_MAXIMUM_BLOCK_SIZE_LOG2) <= OS_HEAP_SIZE_IN_BYTES)
+        #error "2 raised to TLSF_MAXIMUM_BLOCK_SIZE_LOG2 must be larger than OS_HEAP_SIZE_IN_BYTES and TLSF_MAXIMUM_BLOCK_SIZE_LOG2 cannot exceed 31!"
+    #endif // end of #if (TLSF_MAXIMUM_BLOCK_SIZE_LOG2 > 31 || (1UL << TLSF_MAXIMUM_BLOCK_SIZE_LOG2) <= OS_HEAP_SIZE_IN_BYTES)
+#endif // end of #if (USING_TLSF_MEMORY_ALLOCATOR == 1)
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 #endif // end of #ifndef RTOS_CONFIG_H
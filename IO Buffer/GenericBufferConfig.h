@@ -99,6 +99,39 @@ GenericBufferContains() method.
 */
 #define USING_GENERIC_BUFFER_GET_REMAINING_BYTES_METHOD		1
 
+/**
+	*Set USING_GENERIC_BUFFER_SPAN_METHODS to 1 to enable the
+	GenericBufferGetWriteSpan(), GenericBufferCommitWrite(),
+	GenericBufferGetReadSpan() and GenericBufferConsume() methods.
+*/
+#define USING_GENERIC_BUFFER_SPAN_METHODS					1
+
+/**
+	*Set USING_SPSC_GENERIC_BUFFER_METHODS to 1 to enable the
+	SPSC_GENERIC_BUFFER methods.
+*/
+#define USING_SPSC_GENERIC_BUFFER_METHODS					1
+
+/**
+	*Set USING_GENERIC_BUFFER_SEARCH_METHODS to 1 to enable the
+	GENERIC_BUFFER_SEARCH methods.
+*/
+#define USING_GENERIC_BUFFER_SEARCH_METHODS					1
+
+/**
+	*Set USING_GENERIC_BUFFER_VECTOR_METHODS to 1 to enable the
+	GenericBufferWriteVector() and GenericBufferReadVector() methods.
+*/
+#define USING_GENERIC_BUFFER_VECTOR_METHODS					1
+
+/**
+	*Set USING_GENERIC_BUFFER_OVERWRITE_MODE to 1 to let a GENERIC_BUFFER drop
+	its oldest data to make room for a write instead of cutting the write short.
+	This adds a parameter to CreateGenericBuffer() and enables the
+	GenericBufferGetBytesDropped() method.
+*/
+#define USING_GENERIC_BUFFER_OVERWRITE_MODE					0
+
 /**
 	*Set USING_GENERIC_BUFFER_GET_LIBRARY_VERSION to 1 to endable the 
 	GenericBufferGetLibraryVersion() method.
@@ -113,6 +146,27 @@ GenericBufferContains() method.
 */
 #define GENERIC_BUFFER_SAFE_MODE							1
 
+/**
+	*Set GENERIC_BUFFER_WORD_SCAN to 1 to have GenericBufferContains() and
+	GenericBufferSeek() compare 4 bytes at a time.  Set it to 0 to compare
+	one byte at a time.
+*/
+#define GENERIC_BUFFER_WORD_SCAN							1
+
+/**
+	*This is used by the SPSC_GENERIC_BUFFER to keep the compiler (and CPU if
+	need be) from moving the data copies past the index updates.  On a single
+	core a compiler barrier is enough, for multiple cores use a real fence.
+*/
+#define GenericBufferMemoryBarrier()						__asm__ __volatile__("" ::: "memory")
+
+/**
+	*These size the GENERIC_BUFFER_SEARCH object.  Each pattern costs
+	2 bytes of RAM per byte of pattern, patterns are at most 255 bytes.
+*/
+#define GENERIC_BUFFER_SEARCH_MAX_PATTERNS					4
+#define GENERIC_BUFFER_SEARCH_MAX_PATTERN_SIZE_IN_BYTES		8
+
 /**
 	*This defines what method the GenericBuffer library will use to 
 	allocate memory and deallocate memory.  This allows the GenericBuffer 
@@ -124,4 +124,8 @@ void PortIOBufferSetRXInterruptTriggerLevel(IO_BUFFER_ID IOBufferID, UINT32 Numb
 
 BOOL PortIOBufferSetTXInterruptTriggerLevel(IO_BUFFER_ID IOBufferID, UINT32 NumberOfBytesToTransmit);
 
+// The RX interrupts only read one ISR buffers worth, if the hardware still has data this flags the
+// IO_BUFFER for the IO Buffer TASK.  It is TRUE if doing so readied a higher priority TASK.
+#define PortIOBufferSignalIfDataAvailable(IOBufferID)                       (PortIOBufferDataAvailable(IOBufferID) == TRUE && OS_SignalIOBufferTask(IOBufferID) == TRUE)
+
 #endif // end of #ifndef IO_BUFFER_PORT_H
\ No newline at end of file
@@ -29,5 +29,11 @@
 #define USING_DOUBLE_LINKED_LIST_HAS_DATA_METHOD                            1
 #define USING_DOUBLE_LINKED_LIST_GET_SIZE_METHOD                            0
 #define USING_DOUBLE_LINKED_LIST_ITERATE_TO_NEXT_NODE_METHOD                0
+#define USING_INSERT_NODE_AFTER_NODE_OF_DOUBLE_LINKED_LIST_METHOD           1
+#define USING_INSERT_NODE_IN_ORDER_OF_DOUBLE_LINKED_LIST_METHOD             1
+#define USING_DOUBLE_LINKED_LIST_SPLICE_METHODS                             1
+
+// if this is a 1 each DOUBLE_LINKED_LIST_HEAD keeps a count of its nodes
+#define USING_DOUBLE_LINKED_LIST_NODE_COUNT                                 0
 
 #endif // end of #ifndef DOUBLE_LINKED_LIST_CONFIG_H
\ No newline at end of file
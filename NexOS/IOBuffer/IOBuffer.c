@@ -595,7 +595,13 @@ OS_RESULT InitIOBuffer(IO_BUFFER_ID IOBufferID, BYTE *RXBuffer, UINT32 RXBufferS
     
     #if (USING_IO_BUFFER_READ_BYTES_METHOD == 1 || USING_IO_BUFFER_READ_UNTIL_METHOD == 1 || USING_IO_BUFFER_READ_LINE_METHOD == 1)
         // initialize the GENERIC_BUFFER for the RX
-        if(CreateGenericBuffer(&IOBuffer->RXGenericBuffer, RXBufferSizeInBytes, RXBuffer) == (GENERIC_BUFFER*)NULL)
+        if(CreateGenericBuffer(&IOBuffer->RXGenericBuffer, RXBufferSizeInBytes, RXBuffer
+
+                                #if (USING_GENERIC_BUFFER_OVERWRITE_MODE == 1)
+                                    , FALSE
+                                #endif // end of #if (USING_GENERIC_BUFFER_OVERWRITE_MODE == 1)
+
+                                ) == (GENERIC_BUFFER*)NULL)
             return OS_ALLOCATE_MEMORY_FAILED;
     #endif // end of #if (USING_IO_BUFFER_READ_BYTES_METHOD == 1 || USING_IO_BUFFER_READ_UNTIL_METHOD == 1 || USING_IO_BUFFER_READ_LINE_METHOD == 1)
     
@@ -604,7 +610,13 @@ OS_RESULT InitIOBuffer(IO_BUFFER_ID IOBufferID, BYTE *RXBuffer, UINT32 RXBufferS
             // initialize the GENERIC_BUFFER for the TX
             if(TXBufferSizeInBytes != 0)
             {
-                if(CreateGenericBuffer(IOBuffer->TXGenericBuffer, TXBufferSizeInBytes, TXBuffer) == (GENERIC_BUFFER*)NULL)
+                if(CreateGenericBuffer(IOBuffer->TXGenericBuffer, TXBufferSizeInBytes, TXBuffer
+
+                                        #if (USING_GENERIC_BUFFER_OVERWRITE_MODE == 1)
+                                            , FALSE
+                                        #endif // end of #if (USING_GENERIC_BUFFER_OVERWRITE_MODE == 1)
+
+                                        ) == (GENERIC_BUFFER*)NULL)
                     return OS_ALLOCATE_MEMORY_FAILED;
             }
             else
@@ -787,6 +799,26 @@ OS_RESULT GetIOBuffer(  IO_BUFFER_ID IOBufferID
     }
 #endif // end of #if (USING_IO_BUFFER_READ_BYTES_METHOD == 1)
 
+#if (USING_IO_BUFFER_SEARCH_METHODS == 1)
+    #if (USING_IO_BUFFER_READ_UNTIL_METHOD == 1 || USING_IO_BUFFER_READ_LINE_METHOD == 1)
+        static UINT32 OS_IOBufferSearchRX(IO_BUFFER *IOBuffer, BYTE *Pattern, UINT32 PatternSizeInBytes)
+        {
+            GENERIC_BUFFER_SEARCH *Search = &IOBuffer->RXSearch;
+
+            // the search is kept as long as it is for the same pattern, going
+            // between IOBufferReadUntil() and IOBufferReadLine() starts it over
+            if(Search->NumberOfPatterns != 1 || Search->PatternSizeInBytes[0] != PatternSizeInBytes || memcmp((const void*)Search->Pattern[0], (const void*)Pattern, PatternSizeInBytes) != 0)
+            {
+                CreateGenericBufferSearch(Search);
+
+                GenericBufferSearchAddPattern(Search, Pattern, PatternSizeInBytes);
+            }
+
+            return GenericBufferSearch(&IOBuffer->RXGenericBuffer, Search, (UINT32*)NULL);
+        }
+    #endif // end of #if (USING_IO_BUFFER_READ_UNTIL_METHOD == 1 || USING_IO_BUFFER_READ_LINE_METHOD == 1)
+#endif // end of #if (USING_IO_BUFFER_SEARCH_METHODS == 1)
+
 #if (USING_IO_BUFFER_READ_UNTIL_METHOD == 1)
     OS_RESULT IOBufferReadUntil(IO_BUFFER_ID IOBufferID, BYTE *UserBuffer, UINT32 UserBufferSizeInBytes, BYTE ReadUntil, UINT32 *BytesRead
 
@@ -829,7 +861,11 @@ OS_RESULT GetIOBuffer(  IO_BUFFER_ID IOBufferID
         OSUpdateIOBuffer(IOBufferID);
         
         // see if the terminating byte exists
-        BytePosition = GenericBufferSeek(&IOBuffer->RXGenericBuffer, ReadUntil);
+        #if (USING_IO_BUFFER_SEARCH_METHODS == 1)
+            BytePosition = OS_IOBufferSearchRX(IOBuffer, &ReadUntil, 1);
+        #else
+            BytePosition = GenericBufferSeek(&IOBuffer->RXGenericBuffer, ReadUntil);
+        #endif // end of #if (USING_IO_BUFFER_SEARCH_METHODS == 1)
         
         // if the data didn't exist, get how many bytes exist in the buffer
         if(BytePosition == 0)
@@ -937,6 +973,30 @@ OS_RESULT GetIOBuffer(  IO_BUFFER_ID IOBufferID
 #endif // end of #if (USING_IO_BUFFER_READ_UNTIL_METHOD == 1)
 
 #if (USING_IO_BUFFER_READ_LINE_METHOD == 1)
+    #if (USING_IO_BUFFER_SEARCH_METHODS == 1)
+    static OS_RESULT OS_IOBufferReadLinePresent(IO_BUFFER *IOBuffer, BYTE *UserBuffer, UINT32 UserBufferSizeInBytes, UINT32 *BytesRead)
+    {
+        UINT32 LineSizeInBytes, TempBytesRead;
+
+        // the search already found the line, this just gets how long it is
+        LineSizeInBytes = GenericBufferSearch(&IOBuffer->RXGenericBuffer, &IOBuffer->RXSearch, (UINT32*)NULL);
+
+        // read as much of the line as the user buffer can hold
+        if(LineSizeInBytes > UserBufferSizeInBytes)
+            TempBytesRead = GenericBufferRead(&IOBuffer->RXGenericBuffer, UserBufferSizeInBytes, UserBuffer, UserBufferSizeInBytes, FALSE);
+        else
+            TempBytesRead = GenericBufferRead(&IOBuffer->RXGenericBuffer, LineSizeInBytes, UserBuffer, UserBufferSizeInBytes, FALSE);
+
+        // update their bytes read pointer if passed in
+        if(BytesRead != (UINT32*)NULL)
+            *BytesRead = TempBytesRead;
+
+        if(TempBytesRead != LineSizeInBytes)
+            return OS_RESOURCE_INSUFFICIENT_SPACE;
+
+        return OS_SUCCESS;
+    }
+    #else
     static OS_RESULT OS_IOBufferReadLinePresent(IO_BUFFER *IOBuffer, BYTE *UserBuffer, UINT32 UserBufferSizeInBytes, UINT32 *BytesRead)
     {
         UINT32 TempBytesRead;
@@ -980,6 +1040,7 @@ OS_RESULT GetIOBuffer(  IO_BUFFER_ID IOBufferID
 
         return Result;
     }
+    #endif // end of #if (USING_IO_BUFFER_SEARCH_METHODS == 1)
 
     OS_RESULT IOBufferReadLine( IO_BUFFER_ID IOBufferID, BYTE *UserBuffer, UINT32 UserBufferSizeInBytes, UINT32 *BytesRead
 
@@ -1022,7 +1083,11 @@ OS_RESULT GetIOBuffer(  IO_BUFFER_ID IOBufferID
         OSUpdateIOBuffer(IOBufferID);
 
         // check, is the sequence in there already?
-        if(GenericBufferContainsSequence(&IOBuffer->RXGenericBuffer, IOBuffer->NewLineSequence, IOBuffer->NewLineSequenceSizeInBytes) == TRUE)
+        #if (USING_IO_BUFFER_SEARCH_METHODS == 1)
+            if(OS_IOBufferSearchRX(IOBuffer, IOBuffer->NewLineSequence, IOBuffer->NewLineSequenceSizeInBytes) != 0)
+        #else
+            if(GenericBufferContainsSequence(&IOBuffer->RXGenericBuffer, IOBuffer->NewLineSequence, IOBuffer->NewLineSequenceSizeInBytes) == TRUE)
+        #endif // end of #if (USING_IO_BUFFER_SEARCH_METHODS == 1)
         {
             // the sequence does exist, read it
             Result = OS_IOBufferReadLinePresent(IOBuffer, UserBuffer, UserBufferSizeInBytes, BytesRead);
@@ -1405,6 +1470,63 @@ OS_RESULT GetIOBuffer(  IO_BUFFER_ID IOBufferID
     }
 #endif // end of #if (USING_IO_BUFFER_WRITE_LINE_METHOD == 1)
 
+#if (USING_IO_BUFFER_WRITE_MEMORY_TRACE_METHOD == 1)
+    #include <stdio.h>
+
+    OS_RESULT IOBufferWriteMemoryTrace(IO_BUFFER_ID IOBufferID)
+    {
+        MEMORY_TRACE_RECORD Record;
+        UINT32 RecordsDropped, RecordsLeft;
+        BYTE Line[64];
+        OS_RESULT Result = OS_SUCCESS;
+
+        // only go through what is there now, the heap could keep adding records forever
+        for (RecordsLeft = MEMORY_TRACE_SIZE_IN_RECORDS; RecordsLeft != 0 && Result == OS_SUCCESS; RecordsLeft--)
+        {
+            if (MemoryTraceRead(&Record, 1, &RecordsDropped) == 0)
+                break;
+
+            // tell the analyzer there is a gap before this record
+            if (RecordsDropped != 0)
+            {
+                sprintf((char*)Line, "D %u\r\n", (unsigned int)RecordsDropped);
+
+                Result = IOBufferWriteBytes(IOBufferID, Line, (UINT32)strlen((const char*)Line), (UINT32*)NULL
+
+                                #if (USING_IO_BUFFER_ASYNC_WRITE == 1)
+                                    , FALSE
+                                #endif // end of #if (USING_IO_BUFFER_ASYNC_WRITE == 1)
+
+                                #if (USING_TASK_DELAY_TICKS_METHOD == 1)
+                                    , 0
+                                #endif // end of #if (USING_TASK_DELAY_TICKS_METHOD == 1)
+
+                                );
+
+                if (Result != OS_SUCCESS)
+                    break;
+            }
+
+            sprintf((char*)Line, "%c %u %08X %08X %08X %u\r\n", Record.Type, (unsigned int)Record.OSTickCount, (unsigned int)(OS_WORD)Record.Task,
+                    (unsigned int)(OS_WORD)Record.Caller, (unsigned int)(OS_WORD)Record.Ptr, (unsigned int)Record.SizeInBytes);
+
+            Result = IOBufferWriteBytes(IOBufferID, Line, (UINT32)strlen((const char*)Line), (UINT32*)NULL
+
+                            #if (USING_IO_BUFFER_ASYNC_WRITE == 1)
+                                , FALSE
+                            #endif // end of #if (USING_IO_BUFFER_ASYNC_WRITE == 1)
+
+                            #if (USING_TASK_DELAY_TICKS_METHOD == 1)
+                                , 0
+                            #endif // end of #if (USING_TASK_DELAY_TICKS_METHOD == 1)
+
+                            );
+        }
+
+        return Result;
+    }
+#endif // end of #if (USING_IO_BUFFER_WRITE_MEMORY_TRACE_METHOD == 1)
+
 #if (USING_IO_BUFFER_RELEASE_METHOD == 1)
     OS_RESULT IOBufferRelease(IO_BUFFER_ID IOBufferID)
     {
@@ -1524,6 +1646,39 @@ OS_RESULT GetIOBuffer(  IO_BUFFER_ID IOBufferID
     }
 #endif // end of #if (USING_IO_BUFFER_CONTAINS_SEQUENCE_METHOD == 1)
 
+#if (USING_IO_BUFFER_SEARCH_METHODS == 1)
+    OS_RESULT IOBufferSearch(IO_BUFFER_ID IOBufferID, GENERIC_BUFFER_SEARCH *Search, UINT32 *MatchSizeInBytes, UINT32 *PatternIndex)
+    {
+        IO_BUFFER *IOBuffer = OS_GetIOBufferHandle(IOBufferID);
+
+        #if (USING_CHECK_IO_BUFFER_PARAMETERS == 1)
+            if (RAMAddressValid((OS_WORD)IOBuffer) == FALSE)
+                return OS_INVALID_ARGUMENT;
+
+            if (RAMAddressValid((OS_WORD)Search) == FALSE)
+                return OS_INVALID_ARGUMENT_ADDRESS;
+
+            if (RAMAddressValid((OS_WORD)MatchSizeInBytes) == FALSE)
+                return OS_INVALID_ARGUMENT_ADDRESS;
+        #endif // end of #if (USING_CHECK_IO_BUFFER_PARAMETERS == 1)
+
+        EnterCritical();
+
+        // first read in any data from the hardware buffer
+        OSUpdateIOBuffer(IOBufferID);
+
+        // only the bytes that came in since the last search are looked at
+        *MatchSizeInBytes = GenericBufferSearch(&IOBuffer->RXGenericBuffer, Search, PatternIndex);
+
+        ExitCritical();
+
+        if(*MatchSizeInBytes == 0)
+            return OS_FALSE;
+
+        return OS_SUCCESS;
+    }
+#endif // end of #if (USING_IO_BUFFER_SEARCH_METHODS == 1)
+
 #if (USING_IO_BUFFER_PEEK_METHOD == 1)
     OS_RESULT IOBufferPeek(IO_BUFFER_ID IOBufferID, UINT32 NumberOfBytesToPeekAt, BYTE *UserBuffer, UINT32 UserBufferSizeInBytes, UINT32 *BytesPeekedAt
 
@@ -1793,6 +1948,253 @@ OS_RESULT GetIOBuffer(  IO_BUFFER_ID IOBufferID
         return Size;
     }
 #endif // end of #if (USING_IO_BUFFER_GET_CAPACITY_METHOD == 1)
+
+#if (USING_IO_BUFFER_SPAN_METHODS == 1)
+    #if (USING_IO_BUFFER_READ_BYTES_METHOD == 1 || USING_IO_BUFFER_READ_UNTIL_METHOD == 1 || USING_IO_BUFFER_READ_LINE_METHOD == 1)
+        OS_RESULT IOBufferGetReadSpan(IO_BUFFER_ID IOBufferID, BYTE **Span, UINT32 *SpanSizeInBytes)
+        {
+            IO_BUFFER *IOBuffer = OS_GetIOBufferHandle(IOBufferID);
+
+            #if (USING_CHECK_IO_BUFFER_PARAMETERS == 1)
+                if (RAMAddressValid((OS_WORD)IOBuffer) == FALSE)
+                    return OS_INVALID_ARGUMENT;
+
+                if (RAMAddressValid((OS_WORD)Span) == FALSE)
+                    return OS_INVALID_ARGUMENT_ADDRESS;
+
+                if (RAMAddressValid((OS_WORD)SpanSizeInBytes) == FALSE)
+                    return OS_INVALID_ARGUMENT_ADDRESS;
+            #endif // end of #if (USING_CHECK_IO_BUFFER_PARAMETERS == 1)
+
+            // are we the owner?
+            if(GetMutexOwner(&IOBuffer->IOBufferMutex) != gCurrentTask)
+                return OS_RESOURCE_INVALID_OWNER;
+
+            EnterCritical();
+
+            // first read in any data from the hardware buffer
+            OSUpdateIOBuffer(IOBufferID);
+
+            // the ISR only ever writes past the data, so the span stays valid after we leave
+            *Span = GenericBufferGetReadSpan(&IOBuffer->RXGenericBuffer, SpanSizeInBytes);
+
+            ExitCritical();
+
+            if(*SpanSizeInBytes == 0)
+                return OS_RESOURCE_HAS_NO_DATA;
+
+            return OS_SUCCESS;
+        }
+
+        OS_RESULT IOBufferConsume(IO_BUFFER_ID IOBufferID, UINT32 BytesToConsume)
+        {
+            UINT32 BytesConsumed;
+            IO_BUFFER *IOBuffer = OS_GetIOBufferHandle(IOBufferID);
+
+            #if (USING_CHECK_IO_BUFFER_PARAMETERS == 1)
+                if (RAMAddressValid((OS_WORD)IOBuffer) == FALSE)
+                    return OS_INVALID_ARGUMENT;
+            #endif // end of #if (USING_CHECK_IO_BUFFER_PARAMETERS == 1)
+
+            // are we the owner?
+            if(GetMutexOwner(&IOBuffer->IOBufferMutex) != gCurrentTask)
+                return OS_RESOURCE_INVALID_OWNER;
+
+            EnterCritical();
+
+            BytesConsumed = GenericBufferConsume(&IOBuffer->RXGenericBuffer, BytesToConsume);
+
+            ExitCritical();
+
+            if(BytesConsumed != BytesToConsume)
+                return OS_RESOURCE_INSUFFICIENT_DATA;
+
+            return OS_SUCCESS;
+        }
+    #endif // end of #if (USING_IO_BUFFER_READ_BYTES_METHOD == 1 || USING_IO_BUFFER_READ_UNTIL_METHOD == 1 || USING_IO_BUFFER_READ_LINE_METHOD == 1)
+
+    #if (USING_IO_BUFFER_ASYNC_WRITE == 1)
+        #if (USING_IO_BUFFER_WRITE_BYTES_METHOD == 1 || USING_IO_BUFFER_WRITE_UNTIL_METHOD == 1 || USING_IO_BUFFER_WRITE_LINE_METHOD == 1)
+            OS_RESULT IOBufferGetWriteSpan(IO_BUFFER_ID IOBufferID, BYTE **Span, UINT32 *SpanSizeInBytes)
+            {
+                IO_BUFFER *IOBuffer = OS_GetIOBufferHandle(IOBufferID);
+
+                #if (USING_CHECK_IO_BUFFER_PARAMETERS == 1)
+                    if (RAMAddressValid((OS_WORD)IOBuffer) == FALSE)
+                        return OS_INVALID_ARGUMENT;
+
+                    if (RAMAddressValid((OS_WORD)Span) == FALSE)
+                        return OS_INVALID_ARGUMENT_ADDRESS;
+
+                    if (RAMAddressValid((OS_WORD)SpanSizeInBytes) == FALSE)
+                        return OS_INVALID_ARGUMENT_ADDRESS;
+                #endif // end of #if (USING_CHECK_IO_BUFFER_PARAMETERS == 1)
+
+                if(IOBuffer->TXGenericBuffer == (GENERIC_BUFFER*)NULL)
+                    return OS_INVALID_OBJECT_USED;
+
+                // are we the owner?
+                if(GetMutexOwner(&IOBuffer->IOBufferMutex) != gCurrentTask)
+                    return OS_RESOURCE_INVALID_OWNER;
+
+                EnterCritical();
+
+                // the ISR only ever reads behind the free space, so the span stays valid after we leave
+                *Span = GenericBufferGetWriteSpan(IOBuffer->TXGenericBuffer, SpanSizeInBytes);
+
+                ExitCritical();
+
+                if(*SpanSizeInBytes == 0)
+                    return OS_RESOURCE_FULL;
+
+                return OS_SUCCESS;
+            }
+
+            OS_RESULT IOBufferCommitWrite(IO_BUFFER_ID IOBufferID, UINT32 BytesToCommit)
+            {
+                UINT32 BytesCommitted;
+                IO_BUFFER *IOBuffer = OS_GetIOBufferHandle(IOBufferID);
+
+                #if (USING_CHECK_IO_BUFFER_PARAMETERS == 1)
+                    if (RAMAddressValid((OS_WORD)IOBuffer) == FALSE)
+                        return OS_INVALID_ARGUMENT;
+                #endif // end of #if (USING_CHECK_IO_BUFFER_PARAMETERS == 1)
+
+                if(IOBuffer->TXGenericBuffer == (GENERIC_BUFFER*)NULL)
+                    return OS_INVALID_OBJECT_USED;
+
+                // are we the owner?
+                if(GetMutexOwner(&IOBuffer->IOBufferMutex) != gCurrentTask)
+                    return OS_RESOURCE_INVALID_OWNER;
+
+                EnterCritical();
+
+                // a committed span is an async write, it can't be mixed with a blocking one
+                if(IOBuffer->TXState == IO_BUFFER_WRITE)
+                {
+                    ExitCritical();
+
+                    return OS_IO_BUFFER_INVALID_STATE;
+                }
+
+                BytesCommitted = GenericBufferCommitWrite(IOBuffer->TXGenericBuffer, BytesToCommit);
+
+                if(BytesCommitted != 0)
+                {
+                    // set the buffer state
+                    IOBuffer->TXState = IO_BUFFER_ASYNC_WRITE;
+
+                    // set the TX interrupt level
+                    PortIOBufferSetTXInterruptTriggerLevel(IOBufferID, GenericBufferGetSize(IOBuffer->TXGenericBuffer));
+                }
+
+                ExitCritical();
+
+                if(BytesCommitted != BytesToCommit)
+                    return OS_RESOURCE_INSUFFICIENT_SPACE;
+
+                return OS_SUCCESS;
+            }
+        #endif // end of #if (USING_IO_BUFFER_WRITE_BYTES_METHOD == 1 || USING_IO_BUFFER_WRITE_UNTIL_METHOD == 1 || USING_IO_BUFFER_WRITE_LINE_METHOD == 1)
+    #endif // end of #if (USING_IO_BUFFER_ASYNC_WRITE == 1)
+#endif // end of #if (USING_IO_BUFFER_SPAN_METHODS == 1)
+
+#if (USING_IO_BUFFER_VECTOR_METHODS == 1)
+    #if (USING_IO_BUFFER_READ_BYTES_METHOD == 1 || USING_IO_BUFFER_READ_UNTIL_METHOD == 1 || USING_IO_BUFFER_READ_LINE_METHOD == 1)
+        OS_RESULT IOBufferReadVector(IO_BUFFER_ID IOBufferID, GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, BOOL AllOrNothing, UINT32 *BytesRead)
+        {
+            IO_BUFFER *IOBuffer = OS_GetIOBufferHandle(IOBufferID);
+
+            #if (USING_CHECK_IO_BUFFER_PARAMETERS == 1)
+                if (RAMAddressValid((OS_WORD)IOBuffer) == FALSE)
+                    return OS_INVALID_ARGUMENT;
+
+                if (RAMAddressValid((OS_WORD)Vectors) == FALSE)
+                    return OS_INVALID_ARGUMENT_ADDRESS;
+
+                if (RAMAddressValid((OS_WORD)BytesRead) == FALSE)
+                    return OS_INVALID_ARGUMENT_ADDRESS;
+            #endif // end of #if (USING_CHECK_IO_BUFFER_PARAMETERS == 1)
+
+            // are we the owner?
+            if(GetMutexOwner(&IOBuffer->IOBufferMutex) != gCurrentTask)
+                return OS_RESOURCE_INVALID_OWNER;
+
+            EnterCritical();
+
+            // first read in any data from the hardware buffer
+            OSUpdateIOBuffer(IOBufferID);
+
+            *BytesRead = GenericBufferReadVector(&IOBuffer->RXGenericBuffer, Vectors, NumberOfVectors, AllOrNothing);
+
+            ExitCritical();
+
+            // fewer bytes than the segments add up to were moved
+            if(GenericBufferVectorFits(Vectors, NumberOfVectors, *BytesRead) == FALSE)
+                return OS_RESOURCE_INSUFFICIENT_DATA;
+
+            return OS_SUCCESS;
+        }
+    #endif // end of #if (USING_IO_BUFFER_READ_BYTES_METHOD == 1 || USING_IO_BUFFER_READ_UNTIL_METHOD == 1 || USING_IO_BUFFER_READ_LINE_METHOD == 1)
+
+    #if (USING_IO_BUFFER_ASYNC_WRITE == 1)
+        #if (USING_IO_BUFFER_WRITE_BYTES_METHOD == 1 || USING_IO_BUFFER_WRITE_UNTIL_METHOD == 1 || USING_IO_BUFFER_WRITE_LINE_METHOD == 1)
+            OS_RESULT IOBufferWriteVector(IO_BUFFER_ID IOBufferID, const GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, BOOL AllOrNothing, UINT32 *BytesWritten)
+            {
+                IO_BUFFER *IOBuffer = OS_GetIOBufferHandle(IOBufferID);
+
+                #if (USING_CHECK_IO_BUFFER_PARAMETERS == 1)
+                    if (RAMAddressValid((OS_WORD)IOBuffer) == FALSE)
+                        return OS_INVALID_ARGUMENT;
+
+                    if (RAMAddressValid((OS_WORD)Vectors) == FALSE)
+                        return OS_INVALID_ARGUMENT_ADDRESS;
+
+                    if (RAMAddressValid((OS_WORD)BytesWritten) == FALSE)
+                        return OS_INVALID_ARGUMENT_ADDRESS;
+                #endif // end of #if (USING_CHECK_IO_BUFFER_PARAMETERS == 1)
+
+                if(IOBuffer->TXGenericBuffer == (GENERIC_BUFFER*)NULL)
+                    return OS_INVALID_OBJECT_USED;
+
+                // are we the owner?
+                if(GetMutexOwner(&IOBuffer->IOBufferMutex) != gCurrentTask)
+                    return OS_RESOURCE_INVALID_OWNER;
+
+                EnterCritical();
+
+                // the segments go through the TX buffer, it can't be mixed with a blocking write
+                if(IOBuffer->TXState == IO_BUFFER_WRITE)
+                {
+                    ExitCritical();
+
+                    *BytesWritten = 0;
+
+                    return OS_IO_BUFFER_INVALID_STATE;
+                }
+
+                *BytesWritten = GenericBufferWriteVector(IOBuffer->TXGenericBuffer, Vectors, NumberOfVectors, AllOrNothing);
+
+                if(*BytesWritten != 0)
+                {
+                    // set the buffer state
+                    IOBuffer->TXState = IO_BUFFER_ASYNC_WRITE;
+
+                    // one transmit for all of the segments
+                    PortIOBufferSetTXInterruptTriggerLevel(IOBufferID, GenericBufferGetSize(IOBuffer->TXGenericBuffer));
+                }
+
+                ExitCritical();
+
+                // fewer bytes than the segments add up to were moved
+                if(GenericBufferVectorFits(Vectors, NumberOfVectors, *BytesWritten) == FALSE)
+                    return OS_RESOURCE_INSUFFICIENT_SPACE;
+
+                return OS_SUCCESS;
+            }
+        #endif // end of #if (USING_IO_BUFFER_WRITE_BYTES_METHOD == 1 || USING_IO_BUFFER_WRITE_UNTIL_METHOD == 1 || USING_IO_BUFFER_WRITE_LINE_METHOD == 1)
+    #endif // end of #if (USING_IO_BUFFER_ASYNC_WRITE == 1)
+#endif // end of #if (USING_IO_BUFFER_VECTOR_METHODS == 1)
     
 #if (USING_IO_BUFFER_READ_LINE_METHOD == 1 || USING_IO_BUFFER_WRITE_LINE_METHOD == 1)
     #if(USING_IO_BUFFER_GET_NEW_LINE_METHOD == 1)
@@ -1830,6 +2232,12 @@ OS_RESULT GetIOBuffer(  IO_BUFFER_ID IOBufferID
             if(GetMutexOwner(&IOBuffer->IOBufferMutex) != gCurrentTask)
                 return OS_RESOURCE_INVALID_OWNER;
 
+            #if (USING_IO_BUFFER_SEARCH_METHODS == 1 && USING_IO_BUFFER_READ_LINE_METHOD == 1)
+                // IOBufferReadLine() searches for the new line sequence with a GENERIC_BUFFER_SEARCH
+                if(NewLineSequenceSizeInBytes > GENERIC_BUFFER_SEARCH_MAX_PATTERN_SIZE_IN_BYTES)
+                    return OS_INVALID_ARGUMENT;
+            #endif // end of #if (USING_IO_BUFFER_SEARCH_METHODS == 1 && USING_IO_BUFFER_READ_LINE_METHOD == 1)
+
             // are we currently transmitting?
             EnterCritical();
 
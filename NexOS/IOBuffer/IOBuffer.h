@@ -46,6 +46,24 @@
 	#error "USING_IO_BUFFERS must be defined as a 1 in RTOSConfig.h to use IO Buffers"
 #endif // end of #if (USING_IO_BUFFERS != 1)
 
+#if (USING_IO_BUFFER_SPAN_METHODS == 1 && USING_GENERIC_BUFFER_SPAN_METHODS != 1)
+	#error "USING_GENERIC_BUFFER_SPAN_METHODS must be defined as a 1 in GenericBufferConfig.h to use USING_IO_BUFFER_SPAN_METHODS"
+#endif // end of #if (USING_IO_BUFFER_SPAN_METHODS == 1 && USING_GENERIC_BUFFER_SPAN_METHODS != 1)
+
+#if (USING_IO_BUFFER_VECTOR_METHODS == 1 && USING_GENERIC_BUFFER_VECTOR_METHODS != 1)
+	#error "USING_GENERIC_BUFFER_VECTOR_METHODS must be defined as a 1 in GenericBufferConfig.h to use USING_IO_BUFFER_VECTOR_METHODS"
+#endif // end of #if (USING_IO_BUFFER_VECTOR_METHODS == 1 && USING_GENERIC_BUFFER_VECTOR_METHODS != 1)
+
+#if (USING_IO_BUFFER_SEARCH_METHODS == 1)
+	#if (USING_GENERIC_BUFFER_SEARCH_METHODS != 1)
+		#error "USING_GENERIC_BUFFER_SEARCH_METHODS must be defined as a 1 in GenericBufferConfig.h to use USING_IO_BUFFER_SEARCH_METHODS"
+	#endif // end of #if (USING_GENERIC_BUFFER_SEARCH_METHODS != 1)
+
+	#if (USING_IO_BUFFER_READ_LINE_METHOD == 1 && GENERIC_BUFFER_SEARCH_MAX_PATTERN_SIZE_IN_BYTES < 2)
+		#error "GENERIC_BUFFER_SEARCH_MAX_PATTERN_SIZE_IN_BYTES must be at least 2 to hold the default new line sequence"
+	#endif // end of #if (USING_IO_BUFFER_READ_LINE_METHOD == 1 && GENERIC_BUFFER_SEARCH_MAX_PATTERN_SIZE_IN_BYTES < 2)
+#endif // end of #if (USING_IO_BUFFER_SEARCH_METHODS == 1)
+
 #define IO_BUFFER_HIGHEST_NUMBER_OF_BYTES_FOR_TRIGGER_LEVEL             0xFFFFFFFF
 #define IO_BUFFER_UNKNOWN_NUMBER_OF_BYTES_FOR_TRIGGER_LEVEL             0xFFFFFFFE
 
@@ -93,6 +111,9 @@ typedef enum
     NUMBER_OF_IO_BUFFER_STATES
 }IO_BUFFER_STATE;
 
+// this is NUMBER_OF_BUFFER_IDS in a form the preprocessor can check
+#define IO_BUFFER_NUMBER_OF_IDS                 (1 + USING_UART_1_IO_BUFFER + USING_UART_2_IO_BUFFER + USING_UART_3_IO_BUFFER + USING_UART_4_IO_BUFFER + USING_UART_5_IO_BUFFER + USING_UART_6_IO_BUFFER + USING_CAN_1_IO_BUFFER + USING_CAN_2_IO_BUFFER + USING_ADC_1_IO_BUFFER)
+
 typedef enum
 {
     INVALID_IO_BUFFER = 0,
@@ -176,6 +197,13 @@ typedef struct
         // only required for read until sequence method
         UINT32 UserBufferSizeInBytes;
     #endif // end of #if (USING_IO_BUFFER_READ_LINE_METHOD == 1 || USING_IO_BUFFER_READ_UNTIL_METHOD == 1)
+
+    #if (USING_IO_BUFFER_SEARCH_METHODS == 1)
+        #if (USING_IO_BUFFER_READ_LINE_METHOD == 1 || USING_IO_BUFFER_READ_UNTIL_METHOD == 1)
+            // the search for the read until byte or new line sequence, kept between calls
+            GENERIC_BUFFER_SEARCH RXSearch;
+        #endif // end of #if (USING_IO_BUFFER_READ_LINE_METHOD == 1 || USING_IO_BUFFER_READ_UNTIL_METHOD == 1)
+    #endif // end of #if (USING_IO_BUFFER_SEARCH_METHODS == 1)
     
 }IO_BUFFER;
 
@@ -183,6 +211,8 @@ typedef struct
 //-----------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 BOOL OSUpdateIOBuffer(IO_BUFFER_ID BufferID);
 
+BOOL OS_SignalIOBufferTask(IO_BUFFER_ID IOBufferID);
+
 BOOL OS_RemoveTaskFromIOBufferBlockedList(IO_BUFFER *IOBuffer);
 
 UINT32 OS_ReadFromIOBuffer(IO_BUFFER *IOBuffer, BYTE *DestinationBuffer, UINT32 DestinationBufferSize, UINT32 DataLength);
@@ -755,6 +785,44 @@ OS_RESULT IOBufferWriteLine(IO_BUFFER_ID IOBufferID, BYTE *UserBuffer, UINT32 Nu
 
                             );
 
+/*
+    OS_RESULT IOBufferWriteMemoryTrace(IO_BUFFER_ID IOBufferID)
+
+	Description: This method takes the records out of the memory trace ring buffer
+	and writes them to the TX buffer of the specified IO_BUFFER, one line of text per
+	record.  Each line is the record type (A, R or S), the OS tick count in decimal,
+	the TASK, the caller and the pointer in hex, and the size in bytes in decimal.
+	A line of D followed by a count means that many records were dropped before the
+	next line.  The output is meant to be saved on a host and fed to
+	Tools/MemoryTraceAnalyzer.py.
+
+	Blocking: Yes
+
+	User Callable: Yes
+
+	Arguments:
+		IO_BUFFER_ID IOBufferID - A valid IO_BUFFER_ID which represents the IO_BUFFER
+        to write the records to.
+
+	Returns:
+		OS_RESULT - OS_SUCCESS is returned if every record was written.  Otherwise
+		the error code from IOBufferWriteBytes() is returned.
+
+	Notes:
+		- USING_IO_BUFFER_WRITE_MEMORY_TRACE_METHOD inside of RTOSConfig.h must be
+          defined as a 1 to use this method.
+
+		- A TASK must own the IO_BUFFER with a call to GetIOBuffer()
+		  in order to call this method.
+
+		- At most MEMORY_TRACE_SIZE_IN_RECORDS records are written per call so a
+		  busy heap cannot keep the calling TASK here forever.
+
+	See Also:
+		- MemoryTraceRead(), IOBufferWriteBytes()
+*/
+OS_RESULT IOBufferWriteMemoryTrace(IO_BUFFER_ID IOBufferID);
+
 /*
 	OS_RESULT IOBufferRelease(IO_BUFFER_ID IOBufferID)
 
@@ -879,6 +947,51 @@ OS_RESULT IOBufferContainsSequence(IO_BUFFER_ID IOBufferID, BYTE *Sequence, UINT
 
                                   );
 
+/*
+    OS_RESULT IOBufferSearch(IO_BUFFER_ID IOBufferID, GENERIC_BUFFER_SEARCH *Search, UINT32 *MatchSizeInBytes, UINT32 *PatternIndex)
+
+	Description: This method will search the RX buffer of the IO_BUFFER for the
+	patterns in a GENERIC_BUFFER_SEARCH.  Only the bytes received since the last
+	search are looked at, so framing code can call this every time a few bytes
+	arrive without searching the whole IO_BUFFER again.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		IO_BUFFER_ID IOBufferID - A valid IO_BUFFER_ID which represents the IO_BUFFER
+        to search.
+
+		GENERIC_BUFFER_SEARCH *Search - A GENERIC_BUFFER_SEARCH which was set up with
+		CreateGenericBufferSearch() and GenericBufferSearchAddPattern().
+
+		UINT32 *MatchSizeInBytes - How many bytes from the start of the RX buffer up to
+		and including the end of the pattern found is stored here.  Reading this many
+		bytes reads through the pattern.  0 is stored if no pattern was found.
+
+		UINT32 *PatternIndex - The index of the pattern found is stored here, this can
+		be NULL.
+
+	Returns: 
+		OS_RESULT - OS_SUCCESS if a pattern was found, OS_FALSE if not, an error code otherwise.
+
+	Notes:
+        - USING_IO_BUFFER_SEARCH_METHODS inside of RTOSConfig.h must be 
+          defined as a 1 to use this method.
+ 
+		- This method will first read any data in the hardware buffers into the IO_BUFFER.
+
+		- A TASK does not need to own the IO_BUFFER with a call to GetIOBuffer()
+		  in order to call this method.
+
+	See Also:
+		- IOBufferContainsSequence(), IOBufferReadBytes()
+*/
+#if (USING_IO_BUFFER_SEARCH_METHODS == 1)
+    OS_RESULT IOBufferSearch(IO_BUFFER_ID IOBufferID, GENERIC_BUFFER_SEARCH *Search, UINT32 *MatchSizeInBytes, UINT32 *PatternIndex);
+#endif // end of #if (USING_IO_BUFFER_SEARCH_METHODS == 1)
+
 /*
     OS_RESULT IOBufferPeek(IO_BUFFER_ID IOBufferID, UINT32 NumberOfBytesToPeekAt, BYTE *UserBuffer, UINT32 UserBufferSizeInBytes, UINT32 *BytesPeekedAt, BOOL TXBuffer)
 
@@ -1109,6 +1222,235 @@ UINT32 IOBufferGetCapacity(IO_BUFFER_ID IOBufferID
 
                           );
 
+/*
+    OS_RESULT IOBufferGetReadSpan(IO_BUFFER_ID IOBufferID, BYTE **Span, UINT32 *SpanSizeInBytes)
+
+	Description: This method returns the largest run of received data inside the RX
+	buffer of the IO_BUFFER which does not wrap around the end of the buffer.  The
+	data can be parsed in place and then removed with IOBufferConsume().
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		IO_BUFFER_ID IOBufferID - A valid IO_BUFFER_ID which represents the IO_BUFFER
+        to get the received data of.
+
+		BYTE **Span - The address of the data is stored here.  If there is no data
+		(BYTE*)NULL is stored.
+
+		UINT32 *SpanSizeInBytes - The number of bytes in the span is stored here.
+
+	Returns: 
+		OS_RESULT - OS_SUCCESS if a span was returned, OS_RESOURCE_HAS_NO_DATA if the
+		RX buffer is empty, an error code otherwise.
+
+	Notes:
+		- USING_IO_BUFFER_SPAN_METHODS inside of RTOSConfig.h must be 
+          defined as a 1 to use this method.
+
+		- This method will first read any data in the hardware buffers into the IO_BUFFER.
+
+		- A TASK must own the IO_BUFFER with a call to GetIOBuffer()
+		  in order to call this method.
+
+	See Also:
+		- IOBufferConsume()
+*/
+OS_RESULT IOBufferGetReadSpan(IO_BUFFER_ID IOBufferID, BYTE **Span, UINT32 *SpanSizeInBytes);
+
+/*
+    OS_RESULT IOBufferConsume(IO_BUFFER_ID IOBufferID, UINT32 BytesToConsume)
+
+	Description: This method removes bytes from the RX buffer of the IO_BUFFER
+	without copying them.  It is used once the data from IOBufferGetReadSpan()
+	has been handled.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		IO_BUFFER_ID IOBufferID - A valid IO_BUFFER_ID which represents the IO_BUFFER
+        to remove the received data from.
+
+		UINT32 BytesToConsume - The number of bytes to remove.
+
+	Returns: 
+		OS_RESULT - OS_SUCCESS if all the bytes were removed, OS_RESOURCE_INSUFFICIENT_DATA
+		if the RX buffer held fewer bytes than BytesToConsume, an error code otherwise.
+
+	Notes:
+		- USING_IO_BUFFER_SPAN_METHODS inside of RTOSConfig.h must be 
+          defined as a 1 to use this method.
+
+		- A TASK must own the IO_BUFFER with a call to GetIOBuffer()
+		  in order to call this method.
+
+	See Also:
+		- IOBufferGetReadSpan()
+*/
+OS_RESULT IOBufferConsume(IO_BUFFER_ID IOBufferID, UINT32 BytesToConsume);
+
+/*
+    OS_RESULT IOBufferGetWriteSpan(IO_BUFFER_ID IOBufferID, BYTE **Span, UINT32 *SpanSizeInBytes)
+
+	Description: This method returns the largest run of free space inside the TX
+	buffer of the IO_BUFFER which does not wrap around the end of the buffer.  The
+	data to transmit can be built there directly and then sent with IOBufferCommitWrite().
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		IO_BUFFER_ID IOBufferID - A valid IO_BUFFER_ID which represents the IO_BUFFER
+        to get the free TX space of.
+
+		BYTE **Span - The address of the free space is stored here.  If the TX buffer
+		is full (BYTE*)NULL is stored.
+
+		UINT32 *SpanSizeInBytes - The number of bytes which can be written to the span
+		is stored here.
+
+	Returns: 
+		OS_RESULT - OS_SUCCESS if a span was returned, OS_RESOURCE_FULL if the TX buffer
+		is full, an error code otherwise.
+
+	Notes:
+		- USING_IO_BUFFER_SPAN_METHODS and USING_IO_BUFFER_ASYNC_WRITE inside of 
+		  RTOSConfig.h must be defined as a 1 to use this method.
+
+		- A TASK must own the IO_BUFFER with a call to GetIOBuffer()
+		  in order to call this method.
+
+	See Also:
+		- IOBufferCommitWrite()
+*/
+OS_RESULT IOBufferGetWriteSpan(IO_BUFFER_ID IOBufferID, BYTE **Span, UINT32 *SpanSizeInBytes);
+
+/*
+    OS_RESULT IOBufferCommitWrite(IO_BUFFER_ID IOBufferID, UINT32 BytesToCommit)
+
+	Description: This method adds the bytes placed in a span from IOBufferGetWriteSpan()
+	to the TX buffer and starts transmitting them.  This works the same as an 
+	asynchronous IOBufferWriteBytes().
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		IO_BUFFER_ID IOBufferID - A valid IO_BUFFER_ID which represents the IO_BUFFER
+        to transmit the data from.
+
+		UINT32 BytesToCommit - The number of bytes written into the span.
+
+	Returns: 
+		OS_RESULT - OS_SUCCESS if all the bytes were committed, OS_RESOURCE_INSUFFICIENT_SPACE
+		if BytesToCommit was larger than the span and only the span was committed, an
+		error code otherwise.
+
+	Notes:
+		- USING_IO_BUFFER_SPAN_METHODS and USING_IO_BUFFER_ASYNC_WRITE inside of 
+		  RTOSConfig.h must be defined as a 1 to use this method.
+
+		- A TASK must own the IO_BUFFER with a call to GetIOBuffer()
+		  in order to call this method.
+
+	See Also:
+		- IOBufferGetWriteSpan(), IOBufferWriteBytes()
+*/
+OS_RESULT IOBufferCommitWrite(IO_BUFFER_ID IOBufferID, UINT32 BytesToCommit);
+
+/*
+    OS_RESULT IOBufferReadVector(IO_BUFFER_ID IOBufferID, GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, BOOL AllOrNothing, UINT32 *BytesRead)
+
+	Description: This method reads the received data of the IO_BUFFER into several
+	separate segments, for example a fixed size header and its payload, filling each
+	segment before moving on to the next.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		IO_BUFFER_ID IOBufferID - A valid IO_BUFFER_ID which represents the IO_BUFFER
+        to read the received data of.
+
+		GENERIC_BUFFER_VECTOR *Vectors - The segments to read into, in order.
+
+		UINT32 NumberOfVectors - The number of segments in Vectors.
+
+		BOOL AllOrNothing - If TRUE nothing is read unless there is enough data to
+		fill all the segments.  If FALSE as many bytes as have been received are read.
+
+		UINT32 *BytesRead - The number of bytes read is stored here.
+
+	Returns: 
+		OS_RESULT - OS_SUCCESS if all the segments were filled, OS_RESOURCE_INSUFFICIENT_DATA
+		if they were not, an error code otherwise.
+
+	Notes:
+		- USING_IO_BUFFER_VECTOR_METHODS inside of RTOSConfig.h must be 
+          defined as a 1 to use this method.
+
+		- This method will first read any data in the hardware buffers into the IO_BUFFER.
+
+		- A TASK must own the IO_BUFFER with a call to GetIOBuffer()
+		  in order to call this method.
+
+	See Also:
+		- IOBufferWriteVector(), IOBufferReadBytes()
+*/
+#if (USING_IO_BUFFER_VECTOR_METHODS == 1)
+	OS_RESULT IOBufferReadVector(IO_BUFFER_ID IOBufferID, GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, BOOL AllOrNothing, UINT32 *BytesRead);
+#endif // end of #if (USING_IO_BUFFER_VECTOR_METHODS == 1)
+
+/*
+    OS_RESULT IOBufferWriteVector(IO_BUFFER_ID IOBufferID, const GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, BOOL AllOrNothing, UINT32 *BytesWritten)
+
+	Description: This method places several separate segments into the TX buffer of
+	the IO_BUFFER and starts transmitting them as one piece of data.  This works the
+	same as an asynchronous IOBufferWriteBytes() for each segment but only sets up
+	the transmit once.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		IO_BUFFER_ID IOBufferID - A valid IO_BUFFER_ID which represents the IO_BUFFER
+        to transmit the data from.
+
+		const GENERIC_BUFFER_VECTOR *Vectors - The segments to transmit, in order.
+
+		UINT32 NumberOfVectors - The number of segments in Vectors.
+
+		BOOL AllOrNothing - If TRUE nothing is written unless all the segments fit in
+		the TX buffer.  If FALSE as many bytes as there is room for are written.
+
+		UINT32 *BytesWritten - The number of bytes written is stored here.
+
+	Returns: 
+		OS_RESULT - OS_SUCCESS if all the segments were written, OS_RESOURCE_INSUFFICIENT_SPACE
+		if they were not, an error code otherwise.
+
+	Notes:
+		- USING_IO_BUFFER_VECTOR_METHODS and USING_IO_BUFFER_ASYNC_WRITE inside of 
+		  RTOSConfig.h must be defined as a 1 to use this method.
+
+		- A TASK must own the IO_BUFFER with a call to GetIOBuffer()
+		  in order to call this method.
+
+	See Also:
+		- IOBufferReadVector(), IOBufferWriteBytes()
+*/
+#if (USING_IO_BUFFER_VECTOR_METHODS == 1)
+	OS_RESULT IOBufferWriteVector(IO_BUFFER_ID IOBufferID, const GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, BOOL AllOrNothing, UINT32 *BytesWritten);
+#endif // end of #if (USING_IO_BUFFER_VECTOR_METHODS == 1)
+
 /*
     BYTE *IOBufferGetNewLine(IO_BUFFER_ID IOBufferID)
 
@@ -1180,6 +1522,10 @@ BYTE *IOBufferGetNewLine(IO_BUFFER_ID IOBufferID);
 		- A TASK needs to own the IO_BUFFER with a call to GetIOBuffer()
 		  in order to call this method.
 
+		- If USING_IO_BUFFER_SEARCH_METHODS and USING_IO_BUFFER_READ_LINE_METHOD are
+		  defined as a 1 the new line sequence cannot be longer than
+		  GENERIC_BUFFER_SEARCH_MAX_PATTERN_SIZE_IN_BYTES, OS_INVALID_ARGUMENT is returned.
+
 	See Also:
 		- IOBufferGetNewLine(), IOBufferReadLine(), IOBufferWriteLine()
 */
@@ -48,7 +48,15 @@
 	#include "../Event/Event.h"
 #endif // end of USING_EVENTS
 
-#if (RTOS_CONFIG_H_VERSION != 0x00000009)
+#if (USING_IO_BUFFERS == 1)
+	#include "../IOBuffer/IOBuffer.h"
+#endif // end of USING_IO_BUFFERS
+
+#if (USING_MESSAGE_QUEUE_MEMORY_POOL == 1)
+	#include "../Message Queue/MessageQueue.h"
+#endif // end of USING_MESSAGE_QUEUE_MEMORY_POOL
+
+#if (RTOS_CONFIG_H_VERSION != 0x0000000A)
     #error "Wrong RTOSConfig.h file version being used!"
 #endif // end of #if (RTOS_CONFIG_H_VERSION != 0xXXXXXXXX)
 
@@ -97,6 +105,10 @@ DOUBLE_LINKED_LIST_HEAD gCPUScheduler[CPU_SCHEDULER_QUEUE_SIZE]; // The main gut
     UINT32 gCurrentTaskRunTimeCounter, gKernelMiscRunTimeCounter;
 #endif // end of #if (USING_TASK_RUNTIME_EXECUTION_COUNTER == 1)
     
+#if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+    DOUBLE_LINKED_LIST_HEAD gTaskStackList; // this is of type TASK
+#endif // end of #if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+
 #if (USING_TASK_RUNTIME_HISTORY == 1)
     UINT32 gTaskRuntimeHistoryArrayCurrentIndex;
     TASK_RUNTIME_HISTORY gTaskRuntimeHistoryArray[TASK_RUNTIME_HISTORY_SIZE_IN_TASKS];
@@ -104,10 +116,17 @@ DOUBLE_LINKED_LIST_HEAD gCPUScheduler[CPU_SCHEDULER_QUEUE_SIZE]; // The main gut
 
 #if ((USING_DELETE_TASK == 1 && IDLE_TASK_PERFORM_DELETE_TASK == 0) || USING_RESTART_TASK == 1)
 	static TASK gMaintenanceTask;
+	DOUBLE_LINKED_LIST_HEAD gMaintenanceTaskBlockedList; // the Maintenance TASK waits here until there is work
 #endif // end of USING_DELETE_TASK == 1 || USING_RESTART_TASK == 1)
     
 #if (USING_IO_BUFFERS == 1)
+	#if (IO_BUFFER_NUMBER_OF_IDS > 32)
+		#error "gIOBufferPendingWorkMask has one bit per IO_BUFFER_ID, there cannot be more than 32 IO_BUFFER_IDs!"
+	#endif // end of #if (IO_BUFFER_NUMBER_OF_IDS > 32)
+
 	static TASK gIOBufferTask;
+	DOUBLE_LINKED_LIST_HEAD gIOBufferTaskBlockedList; // the IO Buffer TASK waits here until an IO_BUFFER has work
+	volatile UINT32 gIOBufferPendingWorkMask; // bit n is set when IO_BUFFER_ID n needs servicing
 #endif // end of USING_DELETE_TASK == 1 || USING_RESTART_TASK == 1)
     
 //--------------------------------------------------------------------------------------------------//
@@ -125,6 +144,10 @@ OS_RESULT InitOS(void)
 	if (OS_InitializeHeap() == FALSE)
 		return OS_HEAP_INITIALIZATION_FAILED;
 
+	#if (USING_MESSAGE_QUEUE_MEMORY_POOL == 1)
+		OS_InitializeMessageQueueMemoryPool();
+	#endif // end of #if (USING_MESSAGE_QUEUE_MEMORY_POOL == 1)
+
 	// initialize all needed global variables
 	memset((void*)gCPUScheduler, 0, sizeof(gCPUScheduler));
     
@@ -160,12 +183,20 @@ OS_RESULT InitOS(void)
 		InitializeDoubleLinkedListHead(&gRestartTaskList);
 	#endif // end of USING_RESTART_TASK
 
+	#if ((USING_DELETE_TASK == 1 && IDLE_TASK_PERFORM_DELETE_TASK == 0) || USING_RESTART_TASK == 1)
+		InitializeDoubleLinkedListHead(&gMaintenanceTaskBlockedList);
+	#endif // end of #if ((USING_DELETE_TASK == 1 && IDLE_TASK_PERFORM_DELETE_TASK == 0) || USING_RESTART_TASK == 1)
+
     #if (USING_TASK_RUNTIME_EXECUTION_COUNTER == 1)
         InitializeDoubleLinkedListHead(&gRuntimeExecutionList);
         
         gKernelMiscRunTimeCounter = 0;
     #endif // end of #if (USING_TASK_RUNTIME_EXECUTION_COUNTER == 1)
 
+    #if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+        InitializeDoubleLinkedListHead(&gTaskStackList);
+    #endif // end of #if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+
     #if (USING_TASK_RUNTIME_HISTORY == 1)
         gTaskRuntimeHistoryArrayCurrentIndex = 0;
         
@@ -237,6 +268,10 @@ OS_RESULT InitOS(void)
 	#endif // end of #if ((USING_DELETE_TASK == 1 && IDLE_TASK_PERFORM_DELETE_TASK == 0) || USING_RESTART_TASK == 1)
 
     #if (USING_IO_BUFFERS == 1)
+		InitializeDoubleLinkedListHead(&gIOBufferTaskBlockedList);
+
+		gIOBufferPendingWorkMask = 0;
+
 		if (CreateTask(	IOBufferTaskCode,
 						IO_BUFFER_TASK_STACK_SIZE_IN_BYTES,
 						IO_BUFFER_TASK_PRIORITY,
@@ -627,6 +662,49 @@ void StartOSScheduler(void)
         ExitCritical();
     }
 #endif // end of #if (USING_TASK_RUNTIME_HISTORY == 1)
+
+#if (USING_TASK_STACK_REPORT_TO_STRING_METHOD == 1)
+    #include <stdio.h>
+
+    void TaskStackReportToString(BYTE *ToStringBuffer)
+    {
+        TASK *Task;
+        UINT32 UsedBytes, SizeInBytes;
+        DOUBLE_LINKED_LIST_NODE *Node;
+
+        #if (USING_TASK_NAMES != 1 && USING_TASK_UNIQUE_ID != 1)
+            UINT32 i = 0;
+        #endif // end of #if (USING_TASK_NAMES != 1 && USING_TASK_UNIQUE_ID != 1)
+
+        EnterCritical();
+
+        Node = gTaskStackList.Beginning;
+
+        while(Node != (DOUBLE_LINKED_LIST_NODE*)NULL)
+        {
+            Task = (TASK*)Node->Data;
+
+            // no stack words are read here, only the recorded high water mark
+            SizeInBytes = Task->StartingTaskStackSizeInWords * OS_WORD_SIZE_IN_BYTES;
+            UsedBytes = SizeInBytes - (UINT32)(Task->LowestTaskStackPointer - Task->StartOfTaskStackPointer) * OS_WORD_SIZE_IN_BYTES;
+
+            #if (USING_TASK_NAMES == 1)
+                sprintf((char*)&ToStringBuffer[strlen((const char*)ToStringBuffer)], "%s: %u/%u\r\n", Task->TaskName, (unsigned int)UsedBytes, (unsigned int)SizeInBytes);
+            #else
+                #if (USING_TASK_UNIQUE_ID == 1)
+                    sprintf((char*)&ToStringBuffer[strlen((const char*)ToStringBuffer)], "TASK ID %u: %u/%u\r\n", (unsigned int)Task->UniqueID, (unsigned int)UsedBytes, (unsigned int)SizeInBytes);
+                #else
+                    sprintf((char*)&ToStringBuffer[strlen((const char*)ToStringBuffer)], "TASK %i: %u/%u\r\n", (int)i++, (unsigned int)UsedBytes, (unsigned int)SizeInBytes);
+                #endif // end of #if (USING_TASK_UNIQUE_ID == 1)
+            #endif // end of #if (USING_TASK_NAMES == 1)
+
+            // iterate to the next TASK in the list
+            Node = Node->NextNode;
+        }
+
+        ExitCritical();
+    }
+#endif // end of #if (USING_TASK_STACK_REPORT_TO_STRING_METHOD == 1)
     
 //--------------------------------------------------------------------------------------------------//
 //																									//
@@ -744,39 +822,57 @@ static void OS_RemoveTaskFromCPUScheduler(TASK *TaskToRemove)
 		#error "USING_DELETE_TASK in RTOSConfig.h must be defined as 1 if USING_TASK_CHECK_IN is defined as 1!"
 	#endif // end of USING_RESTART_TASK
 	
-	static void OS_UpdateTaskCheckIn(void)
+	#if (USING_INSERT_NODE_IN_ORDER_OF_DOUBLE_LINKED_LIST_METHOD != 1)
+		#error "USING_INSERT_NODE_IN_ORDER_OF_DOUBLE_LINKED_LIST_METHOD in DoubleLinkedListConfig.h must be defined as 1 if USING_TASK_CHECK_IN is defined as 1!"
+	#endif // end of #if (USING_INSERT_NODE_IN_ORDER_OF_DOUBLE_LINKED_LIST_METHOD != 1)
+
+	// orders the check in list by deadline, the tick count can wrap so only the difference is looked at
+	static INT32 OS_CompareTaskCheckInDeadline(DOUBLE_LINKED_LIST_NODE *Node1, DOUBLE_LINKED_LIST_NODE *Node2)
+	{
+		return (INT32)(((TASK*)Node1->Data)->TaskCheckIn->Deadline - ((TASK*)Node2->Data)->TaskCheckIn->Deadline);
+	}
+	
+	void OS_AddTaskToCheckInList(TASK *Task)
+	{
+		Task->TaskCheckIn->Deadline = gOSTickCount + Task->TaskCheckIn->Timeout;
+		
+		Task->TaskCheckIn->TaskCheckInNode.ListHead = &gTaskCheckInList;
+		
+		// a TASK checking in usually has the latest deadline, this searches from the end
+		InsertNodeInOrderOfDoubleLinkedList(&gTaskCheckInList, &Task->TaskCheckIn->TaskCheckInNode.ListNode, OS_CompareTaskCheckInDeadline);
+	}
+	
+	static void OS_UpdateTaskCheckIn(UINT32 CurrentOSTickCount)
 	{
         TASK *Task;
-		DOUBLE_LINKED_LIST_NODE *Node = gTaskCheckInList.Beginning;
 		
-		// Iterate through the task list and see if everyones checking in
-		while(Node != (DOUBLE_LINKED_LIST_NODE*)NULL)
+		// the list is in order of deadline, so only the beginning has to be looked at
+		while(gTaskCheckInList.Beginning != (DOUBLE_LINKED_LIST_NODE*)NULL)
 		{
-			Task = (TASK*)(Node->Data);
-	
-			Task->TaskCheckIn->CurrentCount++;
+			Task = (TASK*)(gTaskCheckInList.Beginning->Data);
 	
-			Node = (DOUBLE_LINKED_LIST_NODE*)(Node->NextNode);
-
-			if(Task->TaskCheckIn->CurrentCount == Task->TaskCheckIn->Timeout)
-			{
-				Task->TaskCheckIn->CurrentCount = 0;
-
-				// restart or delete the Task
-				#if (USING_TASK_CHECK_IN_USER_CALLBACK == 1)
-					if(TaskCheckInUserCallback(Task) == TRUE)
-                #endif // end of #if (USING_TASK_CHECK_IN_USER_CALLBACK == 1)
+			if((INT32)(CurrentOSTickCount - Task->TaskCheckIn->Deadline) < 0)
+				break;
+
+			// give the TASK another period before it is looked at again
+			OS_RemoveTaskFromList(&(Task->TaskCheckIn->TaskCheckInNode));
+			
+			OS_AddTaskToCheckInList(Task);
+
+			// restart or delete the Task
+			#if (USING_TASK_CHECK_IN_USER_CALLBACK == 1)
+				if(TaskCheckInUserCallback(Task) == TRUE)
+			#endif // end of #if (USING_TASK_CHECK_IN_USER_CALLBACK == 1)
+				{
+					if (Task->RestartInfo == (TASK_RESTART_INFO*)NULL)
 					{
-						if (Task->RestartInfo == (TASK_RESTART_INFO*)NULL)
-						{
-							OS_DeleteTask(Task);
-						}
-						else
-						{
-							OS_RestartTask(Task);
-						}
+						OS_DeleteTask(Task);
 					}
-			}
+					else
+					{
+						OS_RestartTask(Task);
+					}
+				}
 		}
 	}
 #endif // end of USING_TASK_CHECK_IN
@@ -843,7 +939,7 @@ static void UpdateOSTick(UINT32 CurrentOSTickCount)
 	#endif // end of USING_CALLBACK_TIMERS
 
 	#if (USING_TASK_CHECK_IN == 1)
-		OS_UpdateTaskCheckIn();
+		OS_UpdateTaskCheckIn(CurrentOSTickCount);
 	#endif // end of USING_TASK_CHECK_IN
 }
 
@@ -880,8 +976,34 @@ OS_WORD *OS_NextTask(OS_WORD *CurrentTaskStackPointer)
     #if (USING_CHECK_TASK_STACK_FOR_OVERFLOW == 1)
         if(PortIsStackOverflowed(CurrentTaskStackPointer, gCurrentTask->StartOfTaskStackPointer, gCurrentTask->StartingTaskStackSizeInWords) == TRUE)
             TaskStackOverflowUserCallback(gCurrentTask);
+        #if (USING_TASK_STACK_GUARD_WORD == 1)
+            // the stack pointer is back in bounds after an overflow between context switches, but the guard word remembers it
+            else if(*gCurrentTask->StartOfTaskStackPointer != (OS_WORD)TASK_STACK_GUARD_WORD_VALUE)
+                TaskStackOverflowUserCallback(gCurrentTask);
+        #endif // end of #if (USING_TASK_STACK_GUARD_WORD == 1)
     #endif // end of #if (USING_CHECK_TASK_STACK_FOR_OVERFLOW == 1)
 
+    #if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+        // the stack grows down, so the lowest stack pointer is the high water mark
+        if(CurrentTaskStackPointer < gCurrentTask->LowestTaskStackPointer)
+            gCurrentTask->LowestTaskStackPointer = CurrentTaskStackPointer;
+
+        #if (TASK_STACK_HIGH_WATER_MARK_GUARD_WORDS > 0)
+        {
+            UINT32 GuardWords = TASK_STACK_HIGH_WATER_MARK_GUARD_WORDS;
+
+            // sample a few words below the mark for usage between context switches
+            while(GuardWords-- != 0 && gCurrentTask->LowestTaskStackPointer > gCurrentTask->StartOfTaskStackPointer + TASK_STACK_GUARD_SIZE_IN_WORDS)
+            {
+                if(*(gCurrentTask->LowestTaskStackPointer - 1) == (OS_WORD)TASK_STACK_FILL_VALUE)
+                    break;
+
+                gCurrentTask->LowestTaskStackPointer--;
+            }
+        }
+        #endif // end of #if (TASK_STACK_HIGH_WATER_MARK_GUARD_WORDS > 0)
+    #endif // end of #if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+
 	// Save the Stack Pointer of the Task whose Context we saved in ContextSwitch().
 	gCurrentTask->TaskStackPointer = CurrentTaskStackPointer;
 
@@ -1080,20 +1202,33 @@ OS_WORD *OS_NextTask(OS_WORD *CurrentTaskStackPointer)
 
 OS_WORD *OS_InitializeTaskStack(TASK *Task, TASK_ENTRY_POINT StartingAddress, void *Args, UINT32 StackSizeInWords)
 {
-	OS_WORD *Stack = (OS_WORD*)AllocateMemory(StackSizeInWords * OS_WORD_SIZE_IN_BYTES);
+	// the stack belongs to the OS, not to whichever TASK created this one
+	OS_WORD *Stack = (OS_WORD*)OS_AllocateTaskStackMemory(StackSizeInWords * OS_WORD_SIZE_IN_BYTES);
+	OS_WORD *TaskStackPointer;
 
 	if(Stack == (OS_WORD*)NULL)
 		return (OS_WORD*)NULL;
 
-	#if (USING_RESTART_TASK == 1 || USING_DELETE_TASK == 1) || (ANALYZE_TASK_STACK_USAGE == 1) || (USING_CHECK_TASK_STACK_FOR_OVERFLOW == 1)
+	#if (USING_RESTART_TASK == 1 || USING_DELETE_TASK == 1) || (ANALYZE_TASK_STACK_USAGE == 1) || (USING_CHECK_TASK_STACK_FOR_OVERFLOW == 1) || (USING_TASK_STACK_HIGH_WATER_MARK == 1)
 		Task->StartOfTaskStackPointer = Stack;
-	#endif // end of #if (USING_RESTART_TASK == 1 || USING_DELETE_TASK == 1) || (ANALYZE_TASK_STACK_USAGE == 1) || (USING_CHECK_TASK_STACK_FOR_OVERFLOW == 1)
+	#endif // end of #if (USING_RESTART_TASK == 1 || USING_DELETE_TASK == 1) || (ANALYZE_TASK_STACK_USAGE == 1) || (USING_CHECK_TASK_STACK_FOR_OVERFLOW == 1) || (USING_TASK_STACK_HIGH_WATER_MARK == 1)
 
-    #if (ANALYZE_TASK_STACK_USAGE == 1) || (USING_CHECK_TASK_STACK_FOR_OVERFLOW == 1)
+    #if (ANALYZE_TASK_STACK_USAGE == 1) || (USING_CHECK_TASK_STACK_FOR_OVERFLOW == 1) || (USING_TASK_STACK_HIGH_WATER_MARK == 1)
         Task->StartingTaskStackSizeInWords = StackSizeInWords;
-    #endif // end of #if (ANALYZE_TASK_STACK_USAGE == 1) || (USING_CHECK_TASK_STACK_FOR_OVERFLOW == 1)
+    #endif // end of #if (ANALYZE_TASK_STACK_USAGE == 1) || (USING_CHECK_TASK_STACK_FOR_OVERFLOW == 1) || (USING_TASK_STACK_HIGH_WATER_MARK == 1)
 
-	return PortInitializeTaskStack(Stack, StackSizeInWords, StartingAddress, Args);
+    TaskStackPointer = PortInitializeTaskStack(Stack, StackSizeInWords, StartingAddress, Args);
+
+    #if (USING_TASK_STACK_GUARD_WORD == 1)
+        // the stack grows down, the lowest word is the first one an overflow writes over
+        Stack[0] = (OS_WORD)TASK_STACK_GUARD_WORD_VALUE;
+    #endif // end of #if (USING_TASK_STACK_GUARD_WORD == 1)
+
+    #if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+        Task->LowestTaskStackPointer = TaskStackPointer;
+    #endif // end of #if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+
+    return TaskStackPointer;
 }
 
 #if (USING_BINARY_SEMAPHORE_STARVATION_PROTECTION == 1)
@@ -1217,6 +1352,38 @@ OS_WORD *OS_InitializeTaskStack(TASK *Task, TASK_ENTRY_POINT StartingAddress, vo
 	}
 #endif // end of #if (USING_CHANGE_TASK_PRIORITY_METHOD == 1 || USING_MUTEXES == 1 || USING_BINARY_SEMAPHORE_STARVATION_PROTECTION == 1 || USING_PIPE_STARVATION_PROTECTION == 1)
 
+#if ((USING_DELETE_TASK == 1 && IDLE_TASK_PERFORM_DELETE_TASK == 0) || USING_RESTART_TASK == 1)
+	BOOL OS_SignalMaintenanceTask(void)
+	{
+		// if the Maintenance TASK isn't waiting, it will see the work before it waits again
+		if (gMaintenanceTask.TaskNodeArray[PRIMARY_TASK_NODE].ListHead != &gMaintenanceTaskBlockedList)
+			return FALSE;
+
+		OS_RemoveTaskFromList(&gMaintenanceTask.TaskNodeArray[PRIMARY_TASK_NODE]);
+
+		return OS_AddTaskToReadyQueue(&gMaintenanceTask);
+	}
+#endif // end of #if ((USING_DELETE_TASK == 1 && IDLE_TASK_PERFORM_DELETE_TASK == 0) || USING_RESTART_TASK == 1)
+
+#if (USING_IO_BUFFERS == 1)
+	BOOL OS_SignalIOBufferTask(IO_BUFFER_ID IOBufferID)
+	{
+		UINT32 i;
+
+		gIOBufferPendingWorkMask |= ((UINT32)1 << IOBufferID);
+
+		// if the IO Buffer TASK isn't waiting, it will see the work before it waits again
+		if (gIOBufferTask.TaskNodeArray[PRIMARY_TASK_NODE].ListHead != &gIOBufferTaskBlockedList)
+			return FALSE;
+
+		// it could also be on the delay queue waiting for its next sweep
+		for (i = 0; i < NUMBER_OF_INTERNAL_TASK_NODES; i++)
+			OS_RemoveTaskFromList(&gIOBufferTask.TaskNodeArray[i]);
+
+		return OS_AddTaskToReadyQueue(&gIOBufferTask);
+	}
+#endif // end of #if (USING_IO_BUFFERS == 1)
+
 #if (USING_DELETE_TASK == 1 || USING_RESTART_TASK == 1)
 	BOOL OS_PrepTaskForRemoval(TASK *Task)
 	{
@@ -1267,6 +1434,10 @@ OS_WORD *OS_InitializeTaskStack(TASK *Task, TASK_ENTRY_POINT StartingAddress, vo
             
 			OS_PlaceTaskOnBlockedList(Task, &gDeleteTaskList, &Task->TaskNodeArray[PRIMARY_TASK_NODE], DELETING, FALSE);
 
+			#if (IDLE_TASK_PERFORM_DELETE_TASK == 0)
+				OS_SignalMaintenanceTask();
+			#endif // end of #if (IDLE_TASK_PERFORM_DELETE_TASK == 0)
+
 			return TRUE;
 		}
 
@@ -1281,6 +1452,8 @@ OS_WORD *OS_InitializeTaskStack(TASK *Task, TASK_ENTRY_POINT StartingAddress, vo
 		{
 			OS_PlaceTaskOnBlockedList(Task, &gRestartTaskList, &Task->TaskNodeArray[PRIMARY_TASK_NODE], RESTARTING, FALSE);
 
+			OS_SignalMaintenanceTask();
+
 			return TRUE;
 		}
 
@@ -1388,24 +1561,62 @@ BOOL OS_AddTaskListToReadyQueue(DOUBLE_LINKED_LIST_HEAD *ListHead)
 	UINT32 i;
 	BOOL CallNextTask = FALSE;
 
+	#if (USING_DOUBLE_LINKED_LIST_SPLICE_METHODS == 1)
+		DOUBLE_LINKED_LIST_HEAD ReadyList;
+		DOUBLE_LINKED_LIST_NODE *NextNode;
+	#endif // end of #if (USING_DOUBLE_LINKED_LIST_SPLICE_METHODS == 1)
+
 	if (ListHead->Beginning == NULL)
 		return FALSE;
 
-	Iterator = ListHead->Beginning;
+	#if (USING_DOUBLE_LINKED_LIST_SPLICE_METHODS == 1)
+		// take every TASK off of the list in one step instead of unlinking them one at a time
+		InitializeDoubleLinkedListHead(&ReadyList);
 
-	while (Iterator != (DOUBLE_LINKED_LIST_NODE*)NULL)
-	{
-		TaskHandle = (TASK*)Iterator->Data;
+		DoubleLinkedListAppendList(&ReadyList, ListHead);
 
-		// remove all the nodes from any lists they were on
-		for (i = 0; i < NUMBER_OF_INTERNAL_TASK_NODES; i++)
-			OS_RemoveTaskFromList(&TaskHandle->TaskNodeArray[i]);
+		Iterator = ReadyList.Beginning;
+
+		while (Iterator != (DOUBLE_LINKED_LIST_NODE*)NULL)
+		{
+			TaskHandle = (TASK*)Iterator->Data;
+
+			// the node gets reused by the CPU scheduler, so hold onto the rest of the list
+			NextNode = Iterator->NextNode;
+
+			Iterator->NextNode = Iterator->PreviousNode = (DOUBLE_LINKED_LIST_NODE*)NULL;
+
+			// the node on ListHead is already off, remove any others from the lists they are on
+			for (i = 0; i < NUMBER_OF_INTERNAL_TASK_NODES; i++)
+			{
+				if (&TaskHandle->TaskNodeArray[i].ListNode == Iterator)
+					TaskHandle->TaskNodeArray[i].ListHead = (DOUBLE_LINKED_LIST_HEAD*)NULL;
+				else
+					OS_RemoveTaskFromList(&TaskHandle->TaskNodeArray[i]);
+			}
 
-		if (OS_AddTaskToReadyQueue(TaskHandle) == TRUE)
-			CallNextTask = TRUE;
+			if (OS_AddTaskToReadyQueue(TaskHandle) == TRUE)
+				CallNextTask = TRUE;
 
+			Iterator = NextNode;
+		}
+	#else
 		Iterator = ListHead->Beginning;
-	}
+
+		while (Iterator != (DOUBLE_LINKED_LIST_NODE*)NULL)
+		{
+			TaskHandle = (TASK*)Iterator->Data;
+
+			// remove all the nodes from any lists they were on
+			for (i = 0; i < NUMBER_OF_INTERNAL_TASK_NODES; i++)
+				OS_RemoveTaskFromList(&TaskHandle->TaskNodeArray[i]);
+
+			if (OS_AddTaskToReadyQueue(TaskHandle) == TRUE)
+				CallNextTask = TRUE;
+
+			Iterator = ListHead->Beginning;
+		}
+	#endif // end of #if (USING_DOUBLE_LINKED_LIST_SPLICE_METHODS == 1)
 
 	return CallNextTask;
 }
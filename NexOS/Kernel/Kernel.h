@@ -67,6 +67,13 @@
 // This is how many indexes the gCPUScheduler[] has.
 #define CPU_SCHEDULER_QUEUE_SIZE                                        (OS_HIGHEST_TASK_PRIORITY + 1)
 
+// the guard word takes the lowest word of each TASK stack
+#if (USING_TASK_STACK_GUARD_WORD == 1)
+	#define TASK_STACK_GUARD_SIZE_IN_WORDS                              1
+#else
+	#define TASK_STACK_GUARD_SIZE_IN_WORDS                              0
+#endif // end of #if (USING_TASK_STACK_GUARD_WORD == 1)
+
 /*
  * These define the current kernel version.  If KERNEL_TEST_VERSION_NUMBER is
  * anything other than 0x00, the OS is a test release and should not be in
@@ -311,6 +318,34 @@ void TaskRuntimeExecutionListToString(BYTE *ToStringBuffer, BOOL Percentage);
 */
 void TaskRuntimeHistoryListToString(BYTE *ToStringBuffer, BOOL PrintRuntime);
 
+/*
+	void TaskStackReportToString(BYTE *ToStringBuffer)
+
+	Description: This method will to string the stack usage of every TASK
+    in the system into a buffer.  Each line holds the TASK followed by the
+    bytes used at the high water mark and the size of the TASK stack.
+	
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+        BYTE *ToStringBuffer - The buffer to put the string in.
+
+	Returns:
+        None
+
+	Notes:
+        - USING_TASK_STACK_REPORT_TO_STRING_METHOD inside of RTOSConfig.h must be 
+          defined as 1 to use this method.
+        - The TASK stacks are not scanned, the high water mark recorded by the
+          OS at each context switch is used.
+
+	See Also:
+		- TaskStackHighWaterMark()
+*/
+void TaskStackReportToString(BYTE *ToStringBuffer);
+
 /*
 	void DeviceEnterSleepMode(void)
 
@@ -682,6 +717,10 @@ TASK *OS_RemoveTaskFromList(TASK_NODE *TaskNode);
 
 void OS_AddTaskToList(DOUBLE_LINKED_LIST_HEAD *Head, TASK_NODE *TaskNode);
 
+void OS_AddTaskToCheckInList(TASK *Task);
+
+BOOL OS_SignalMaintenanceTask(void);
+
 BOOL OS_PrepTaskForRemoval(TASK *Task);
 
 BOOL OS_DeleteTask(TASK *Task);
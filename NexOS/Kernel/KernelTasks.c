@@ -42,11 +42,16 @@
         extern DOUBLE_LINKED_LIST_HEAD gMiscellaneousBlockedQueueHead;
     #endif // end of #if (USING_TASK_HIBERNATION == 1)
 
+    #if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+        extern DOUBLE_LINKED_LIST_HEAD gTaskStackList;
+    #endif // end of #if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+
     #if (USING_DELETE_TASK == 1)
 		extern DOUBLE_LINKED_LIST_HEAD gDeleteTaskList;
 
         /*
-        * This method fully deletes the TASK passed to it.
+        * This method fully deletes the TASK passed to it.  It is called from inside of one
+        * critical section, which it leaves while the heap of the TASK is reclaimed.
         */
 		static void MaintenanceDeleteTask(TASK *Task)
 		{
@@ -60,6 +65,10 @@
 				if(Task->TaskCheckIn != (TASK_CHECK_IN*)NULL)
 					OS_ReleaseMemory((void*)Task->TaskCheckIn);
 			#endif // end of USING_TASK_CHECK_IN
+
+            #if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+                RemoveNodeFromDoubleLinkedList(&gTaskStackList, &Task->TaskStackNode);
+            #endif // end of #if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
                 
 			OS_ReleaseMemory((void*)Task->StartOfTaskStackPointer);
 	
@@ -67,6 +76,16 @@
 				if(Task->TaskExitMethod != (void(*)(void))NULL)
 					Task->TaskExitMethod();
 			#endif // end of USING_TASK_EXIT_METHOD_CALLBACK
+
+			#if (USING_TASK_HEAP_RECLAIM == 1)
+				// anything the TASK allocated and never released goes back to the heap, this
+				// walks the heap a chunk at a time so it has to be outside of our critical section
+				ExitCritical();
+
+				OS_ReleaseTaskMemory((void*)Task);
+
+				EnterCritical();
+			#endif // end of #if (USING_TASK_HEAP_RECLAIM == 1)
             
 			OS_ReleaseMemory((void*)Task);
             
@@ -113,19 +132,24 @@
 		{
 			UINT32 i;
 
-			OS_ReleaseMemory((void*)Task->StartOfTaskStackPointer);
-	
-			// re-initialize the TASK stack
-			//Task->TaskStackPointer = OS_InitializeTaskStack(Task, Task->RestartInfo->StartingAddress, (void*)NULL, Task->RestartInfo->StartingTaskSize);
+			// the TASK keeps its stack and TASK block, the stack is just re-initialized in place
             Task->TaskStackPointer = PortInitializeTaskStack(Task->StartOfTaskStackPointer, Task->RestartInfo->StartingTaskStackSizeInWords, Task->RestartInfo->StartingAddress, (void*)NULL);
+
+            #if (USING_TASK_STACK_GUARD_WORD == 1)
+                Task->StartOfTaskStackPointer[0] = (OS_WORD)TASK_STACK_GUARD_WORD_VALUE;
+            #endif // end of #if (USING_TASK_STACK_GUARD_WORD == 1)
+
+            #if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+                Task->LowestTaskStackPointer = Task->TaskStackPointer;
+            #endif // end of #if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
 	
 			// reset the critical count
 			Task->CriticalCount = 0;
 	
 			// shouldn't be anything but 0, but just to be sure
-			#if (USING_TASK_DELAY_METHOD == 1)
+			#if (USING_TASK_DELAY_TICKS_METHOD == 1)
 				Task->DelayInTicks = 0;
-			#endif // end of USING_TASK_DELAY_METHOD
+			#endif // end of #if (USING_TASK_DELAY_TICKS_METHOD == 1)
 	
 			Task->TaskInfo.bits.State = Task->RestartInfo->TaskState;
 			Task->TaskInfo.bits.Priority = Task->RestartInfo->TaskPriority;
@@ -136,9 +160,19 @@
 			// make sure to delete the task checking so no memory leaks occur
 			#if (USING_TASK_CHECK_IN == 1)
 				if (Task->TaskCheckIn != (TASK_CHECK_IN*)NULL)
+				{
 					OS_ReleaseMemory((void*)Task->TaskCheckIn);
+
+					// the restarted TASK must be able to call SetupTaskCheckIn() again
+					Task->TaskCheckIn = (TASK_CHECK_IN*)NULL;
+				}
 			#endif // end of USING_TASK_CHECK_IN
 
+			#if (USING_TASK_HEAP_RECLAIM == 1)
+				// the restarted TASK starts over, so anything it still had allocated is gone
+				OS_ReleaseTaskMemory((void*)Task);
+			#endif // end of #if (USING_TASK_HEAP_RECLAIM == 1)
+
 			#if (USING_MAILBOXES == 1)
 				// Delete any unread messages
 			#endif // end of USING_MAILBOXES
@@ -201,6 +235,27 @@ UINT32 IdleTaskCode(void *Args)
 }
 
 #if ((USING_DELETE_TASK == 1 && IDLE_TASK_PERFORM_DELETE_TASK == 0) || USING_RESTART_TASK == 1)
+    extern TASK * volatile gCurrentTask;
+    extern DOUBLE_LINKED_LIST_HEAD gMaintenanceTaskBlockedList;
+
+    /*
+     * This method returns TRUE if there are any TASKs waiting on the Maintenance TASK.
+     */
+    static BOOL MaintenanceWorkPending(void)
+    {
+        #if (USING_DELETE_TASK == 1 && IDLE_TASK_PERFORM_DELETE_TASK == 0)
+            if (DoubleLinkedListHasData(&gDeleteTaskList) == TRUE)
+                return TRUE;
+        #endif // end of #if (USING_DELETE_TASK == 1 && IDLE_TASK_PERFORM_DELETE_TASK == 0)
+
+        #if (USING_RESTART_TASK == 1)
+            if (DoubleLinkedListHasData(&gRestartTaskList) == TRUE)
+                return TRUE;
+        #endif // end of #if (USING_RESTART_TASK == 1)
+
+        return FALSE;
+    }
+
 	UINT32 MaintenanceTaskCode(void *Args)
 	{
         #if (USING_RESTART_TASK == 1)
@@ -210,7 +265,17 @@ UINT32 IdleTaskCode(void *Args)
 
 		while(1)
 		{
-			TaskDelayTicks(MAINTENANCE_TASK_DELAY_TICKS);
+			// wait until OS_DeleteTask() or OS_RestartTask() signals there is work
+			EnterCritical();
+			{
+				if (MaintenanceWorkPending() == FALSE)
+				{
+					OS_PlaceTaskOnBlockedList(gCurrentTask, &gMaintenanceTaskBlockedList, &gCurrentTask->TaskNodeArray[PRIMARY_TASK_NODE], BLOCKED, TRUE);
+
+					SurrenderCPU();
+				}
+			}
+			ExitCritical();
 
 			#if (USING_MAINTENANCE_TASK_USER_CALLBACK == 1)
 				MaintenanceTaskUserCallback(Args);
@@ -250,14 +315,53 @@ UINT32 IdleTaskCode(void *Args)
     #include "../IOBuffer/IOBuffer.h"
     #include "IOBufferPort.h"
 
+    extern TASK * volatile gCurrentTask;
+    extern DOUBLE_LINKED_LIST_HEAD gIOBufferTaskBlockedList;
+    extern volatile UINT32 gIOBufferPendingWorkMask;
+
 	UINT32 IOBufferTaskCode(void *Args)
 	{
 		IO_BUFFER_ID CurrentIOBuffer;
+        UINT32 PendingWork;
 
 		while(1)
 		{
+            EnterCritical();
+
+            // sleep until an interrupt flags a buffer that still has data in the hardware
+            if(gIOBufferPendingWorkMask == 0)
+            {
+                OS_PlaceTaskOnBlockedList(gCurrentTask, &gIOBufferTaskBlockedList, &gCurrentTask->TaskNodeArray[PRIMARY_TASK_NODE], BLOCKED, TRUE);
+
+                #if (IO_BUFFER_TASK_PERIODICITY_IN_OS_TICKS > 0)
+                    // wake up anyways to sweep for data sitting below the RX trigger level
+                    OS_AddTaskToDelayQueue(gCurrentTask, &gCurrentTask->TaskNodeArray[SECONDARY_TASK_NODE], IO_BUFFER_TASK_PERIODICITY_IN_OS_TICKS, FALSE);
+                #endif // end of #if (IO_BUFFER_TASK_PERIODICITY_IN_OS_TICKS > 0)
+
+                SurrenderCPU();
+            }
+
+            // take the work, any buffer flagged from here on will be seen the next time around
+            PendingWork = gIOBufferPendingWorkMask;
+            gIOBufferPendingWorkMask = 0;
+
+            #if (IO_BUFFER_TASK_PERIODICITY_IN_OS_TICKS > 0)
+                if (gCurrentTask->DelayInTicks == TASK_TIMEOUT_DONE_VALUE)
+                {
+                    gCurrentTask->DelayInTicks = 0;
+
+                    // nothing flagged us, so check every buffer
+                    PendingWork = 0xFFFFFFFF;
+                }
+            #endif // end of #if (IO_BUFFER_TASK_PERIODICITY_IN_OS_TICKS > 0)
+
+            ExitCritical();
+
             for(CurrentIOBuffer = INVALID_IO_BUFFER + 1; CurrentIOBuffer < NUMBER_OF_BUFFER_IDS; CurrentIOBuffer++)
             {
+                if((PendingWork & ((UINT32)1 << CurrentIOBuffer)) == 0)
+                    continue;
+
                 EnterCritical();
 
                 // update the CurrentIOBuffer here
@@ -269,8 +373,6 @@ UINT32 IdleTaskCode(void *Args)
 			#if (USING_IO_BUFFER_TASK_USER_CALLBACK == 1)
 				IOBufferTaskUserCallback(Args);
 			#endif // end of #if (USING_IO_BUFFER_TASK_USER_CALLBACK == 1)
-
-            TaskDelayTicks(IO_BUFFER_TASK_PERIODICITY_IN_OS_TICKS);
 		}
 	}
 #endif // end of #if (USING_IO_BUFFERS == 1)
@@ -52,7 +52,8 @@ UINT32 IdleTaskCode(void *Args);
 	UINT32 MaintenanceTaskCode(void *Args)
 
 	Description: This is the code that the Maintenance TASK executes.  It never returns
-    from this method.
+    from this method.  The Maintenance TASK blocks until OS_DeleteTask() or
+    OS_RestartTask() signals it that a TASK is waiting to be deleted or restarted.
 
 	Blocking: No
 
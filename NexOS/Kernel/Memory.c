@@ -34,9 +34,12 @@
 #endif // end of 
 
 #if (OS_HEAP_SIZE_IN_BYTES < (OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES + OS_WORD_SIZE_IN_BYTES))
-	#error "OS_HEAP_SIZE_IN_BYTES must be defined and be larger than 8 or 12 bytes!"
+	#error "OS_HEAP_SIZE_IN_BYTES must be defined and be larger than OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES plus a word, 12 bytes or 16 with USING_TASK_HEAP_ACCOUNTING!"
 #endif // end of OS_HEAP_SIZE_IN_BYTES < sizeof(OS_MEMORY_BLOCK_HEADER) + sizeof(WORD)
 
+// OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES is set by hand in RTOSConfig.h, this will not compile if it stops matching the real header
+typedef char OS_MEMORY_BLOCK_HEADER_SIZE_CHECK[(OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES == sizeof(OS_MEMORY_BLOCK_HEADER)) ? 1 : -1];
+
 #if (OS_HEAP_SIZE_IN_BYTES % OS_WORD_SIZE_IN_BYTES)
 	#error "OS_HEAP_SIZE_IN_BYTES must be word aligned!"
 #endif // end of OS_HEAP_SIZE_IN_BYTES % sizeof(WORD)
@@ -58,6 +61,11 @@
 #if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1 || USING_GET_HEAP_USED_IN_BYTES_METHOD == 1 || USING_GET_HEAP_REMAINING_IN_BYTES_METHOD == 1)
     static UINT32 gHeapUsedInBytes;
 #endif // end of #if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1 || USING_GET_HEAP_USED_IN_BYTES_METHOD == 1 || USING_GET_HEAP_REMAINING_IN_BYTES_METHOD == 1)
+
+#if (USING_GET_HEAP_STATISTICS_METHOD == 1 || USING_TASK_HEAP_RECLAIM == 1)
+	// bumped every time a block is split or merged so a chunked walk of the heap knows it went stale
+	static UINT32 gHeapModificationCount;
+#endif // end of #if (USING_GET_HEAP_STATISTICS_METHOD == 1 || USING_TASK_HEAP_RECLAIM == 1)
     
 OS_WORD gKernelManagedMemory[((OS_HEAP_SIZE_IN_BYTES + OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES) / OS_WORD_SIZE_IN_BYTES)];
 
@@ -68,7 +76,7 @@ OS_WORD gKernelManagedMemory[((OS_HEAP_SIZE_IN_BYTES + OS_MEMORY_BLOCK_HEADER_SI
 	{
 		OS_MEMORY_BLOCK_HEADER *MemoryBlockIterator = MemoryBlock;
 
-		MemoryBlockIterator += ((MemoryBlockIterator->SizeInWords * 4) / OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES + 1);
+		MemoryBlockIterator = (OS_MEMORY_BLOCK_HEADER*)((OS_WORD*)(MemoryBlockIterator + 1) + MemoryBlockIterator->SizeInWords);
 
 		if(MemoryBlockIterator >= (OS_MEMORY_BLOCK_HEADER*)&(gKernelManagedMemory[(OS_HEAP_SIZE_IN_BYTES / OS_WORD_SIZE_IN_BYTES)]))
 			return FALSE;
@@ -78,7 +86,7 @@ OS_WORD gKernelManagedMemory[((OS_HEAP_SIZE_IN_BYTES + OS_MEMORY_BLOCK_HEADER_SI
 
 	OS_MEMORY_BLOCK_HEADER *GetNextMemoryBlock(OS_MEMORY_BLOCK_HEADER *CurrentMemoryBlock)
 	{
-		CurrentMemoryBlock += ((CurrentMemoryBlock->SizeInWords * 4) / OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES + 1);
+		CurrentMemoryBlock = (OS_MEMORY_BLOCK_HEADER*)((OS_WORD*)(CurrentMemoryBlock + 1) + CurrentMemoryBlock->SizeInWords);
 
 		return CurrentMemoryBlock;
 	}
@@ -111,67 +119,431 @@ OS_WORD gKernelManagedMemory[((OS_HEAP_SIZE_IN_BYTES + OS_MEMORY_BLOCK_HEADER_SI
 		printf("OS HEAP USED: %i bytes\n\0", gHeapUsedInBytes);
 	}
 #endif // end of #if (MEMORY_TEST == 1)
-    
-static OS_MEMORY_BLOCK_HEADER *OS_IterateMemoryBlockHeader(OS_MEMORY_BLOCK_HEADER *MemoryBlock)
+
+#if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1)
+	static void OS_CheckMemoryWarning(void)
+	{
+		if (gMemoryWarning == FALSE)
+		{
+			if (gHeapUsedInBytes > MEMORY_WARNING_LEVEL_IN_BYTES)
+			{
+				gMemoryWarning = TRUE;
+
+				#if (USING_MEMORY_WARNING_USER_CALLBACK == 1)
+					MemoryWarningUserCallback(gHeapUsedInBytes);
+				#endif // end of USING_MEMORY_WARNING_USER_CALLBACK
+
+				#if (USING_MEMORY_WARNING_EVENT == 1)
+					OS_RaiseEvent(MEMORY_WARNING_EVENT);
+				#endif // end of USING_MEMORY_WARNING_EVENT == 1
+			}
+		}
+	}
+
+	static void OS_CheckMemoryWarningClear(void)
+	{
+		if (gMemoryWarning == TRUE)
+		{
+			if (gHeapUsedInBytes < MEMORY_WARNING_LEVEL_IN_BYTES)
+			{
+				gMemoryWarning = FALSE;
+
+				#if (USING_MEMORY_WARNING_CLEAR_USER_CALLBACK == 1)
+					MemoryWarningClearUserCallback();
+				#endif // end of USING_MEMORY_WARNING_CLEAR_USER_CALLBACK
+
+				#if (USING_MEMORY_WARNING_CLEAR_EVENT == 1)
+					OS_RaiseEvent(MEMORY_WARNING_CLEAR_EVENT);
+				#endif // end of USING_MEMORY_WARNING_CLEAR_EVENT == 1
+			}
+		}
+	}
+#endif // end of USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1
+
+#define OS_MEMORY_BLOCK_HEADER_SIZE_IN_WORDS				(OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES / OS_WORD_SIZE_IN_BYTES)
+
+// no heap can be 2GB, so anything bigger is turned away before rounding it up to words can wrap
+#define OS_MEMORY_MAXIMUM_REQUEST_SIZE_IN_BYTES				0x7FFFFFFF
+
+#if (USING_TLSF_MEMORY_ALLOCATOR == 1)
+	// a free block keeps its free list links where the user data would go, so every block needs room for them
+	#define TLSF_MINIMUM_BLOCK_SIZE_IN_WORDS				(sizeof(OS_MEMORY_FREE_BLOCK_LINKS) / OS_WORD_SIZE_IN_BYTES)
+
+	// every block below TLSF_SMALL_BLOCK_SIZE_IN_BYTES goes into the first level, split evenly into words
+	#define TLSF_SECOND_LEVEL_INDEX_COUNT					(1 << TLSF_SECOND_LEVEL_INDEX_COUNT_LOG2)
+	#define TLSF_FIRST_LEVEL_INDEX_SHIFT					(TLSF_SECOND_LEVEL_INDEX_COUNT_LOG2 + 2)
+	#define TLSF_FIRST_LEVEL_INDEX_COUNT					(TLSF_MAXIMUM_BLOCK_SIZE_LOG2 - TLSF_FIRST_LEVEL_INDEX_SHIFT + 1)
+	#define TLSF_SMALL_BLOCK_SIZE_IN_BYTES					(1 << TLSF_FIRST_LEVEL_INDEX_SHIFT)
+
+	#if (TLSF_MAXIMUM_BLOCK_SIZE_LOG2 <= TLSF_FIRST_LEVEL_INDEX_SHIFT)
+		#error "TLSF_MAXIMUM_BLOCK_SIZE_LOG2 must be larger than TLSF_SECOND_LEVEL_INDEX_COUNT_LOG2 + 2!"
+	#endif // end of #if (TLSF_MAXIMUM_BLOCK_SIZE_LOG2 <= TLSF_FIRST_LEVEL_INDEX_SHIFT)
+
+	typedef struct
+	{
+		OS_MEMORY_BLOCK_HEADER *NextFreeBlock;
+		OS_MEMORY_BLOCK_HEADER *PreviousFreeBlock;
+	}OS_MEMORY_FREE_BLOCK_LINKS;
+#endif // end of #if (USING_TLSF_MEMORY_ALLOCATOR == 1)
+
+// a heap region is one run of blocks, blocks are never split or merged across regions
+typedef struct
+{
+	OS_MEMORY_BLOCK_HEADER *StartOfRegion; // the first block
+	OS_MEMORY_BLOCK_HEADER *EndOfRegion; // just past the last block
+
+	#if (USING_TLSF_MEMORY_ALLOCATOR == 1)
+		// bit n of FirstLevelBitmap is set when any list in FreeBlockLists[n] has a block,
+		// bit m of SecondLevelBitmap[n] is set when FreeBlockLists[n][m] has a block
+		UINT32 FirstLevelBitmap;
+		UINT32 SecondLevelBitmap[TLSF_FIRST_LEVEL_INDEX_COUNT];
+		OS_MEMORY_BLOCK_HEADER *FreeBlockLists[TLSF_FIRST_LEVEL_INDEX_COUNT][TLSF_SECOND_LEVEL_INDEX_COUNT];
+	#endif // end of #if (USING_TLSF_MEMORY_ALLOCATOR == 1)
+
+	#if (USING_HEAP_REGIONS == 1)
+		UINT32 UsedInBytes;
+		UINT32 MaximumUsedInBytes;
+		UINT32 FailedAllocations;
+		BOOL General; // TRUE if AllocateMemory() can fall back to this region
+	#endif // end of #if (USING_HEAP_REGIONS == 1)
+}OS_HEAP_REGION;
+
+#if (USING_HEAP_REGIONS == 1)
+	// the OS heap is always the first region
+	static OS_HEAP_REGION gHeapRegions[NUMBER_OF_HEAP_REGIONS];
+	static UINT32 gHeapRegionCount;
+
+	static OS_HEAP_REGION *gDefaultHeapRegion;
+	static OS_HEAP_REGION *gTaskStackHeapRegion; // NULL if TASK stacks follow the default region
+
+	#define OS_IsOSHeapRegion(HeapRegion)				((HeapRegion) == &gHeapRegions[OS_HEAP_REGION_ID])
+#else
+	static OS_HEAP_REGION gHeapRegions[1];
+
+	#define gHeapRegionCount							1
+	#define OS_IsOSHeapRegion(HeapRegion)				TRUE
+#endif // end of #if (USING_HEAP_REGIONS == 1)
+
+static OS_MEMORY_BLOCK_HEADER *OS_GetNextPhysicalMemoryBlock(OS_HEAP_REGION *HeapRegion, OS_MEMORY_BLOCK_HEADER *MemoryBlock)
 {
 	// Iterate to the next memory block
-	MemoryBlock += ((MemoryBlock->SizeInWords * 4) / OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES + 1);
+	MemoryBlock = (OS_MEMORY_BLOCK_HEADER*)((OS_WORD*)(MemoryBlock + 1) + MemoryBlock->SizeInWords);
 
-	// check to see if we have reached the end of the heap, if so return (void*)NULL
-	if (MemoryBlock >= (OS_MEMORY_BLOCK_HEADER*)&(gKernelManagedMemory[(OS_HEAP_SIZE_IN_BYTES / OS_WORD_SIZE_IN_BYTES)]))
-	{
+	// check to see if we have reached the end of the region, if so return (OS_MEMORY_BLOCK_HEADER*)NULL
+	if (MemoryBlock >= HeapRegion->EndOfRegion)
 		return (OS_MEMORY_BLOCK_HEADER*)NULL;
-	}
 
 	return MemoryBlock;
 }
 
-BOOL OS_InitializeHeap(void)
+static OS_MEMORY_BLOCK_HEADER *OS_GetPreviousPhysicalMemoryBlock(OS_HEAP_REGION *HeapRegion, OS_MEMORY_BLOCK_HEADER *MemoryBlock)
 {
-	OS_MEMORY_BLOCK_HEADER *MemoryBlockIterator = (OS_MEMORY_BLOCK_HEADER*)gKernelManagedMemory;
+	// the first block has nothing before it
+	if (MemoryBlock == HeapRegion->StartOfRegion)
+		return (OS_MEMORY_BLOCK_HEADER*)NULL;
 
-	// make the first block not allocated
-	MemoryBlockIterator->Allocated = 0;
+	// the boundary tag tells us how far back the previous block starts
+	return (OS_MEMORY_BLOCK_HEADER*)((OS_WORD*)MemoryBlock - MemoryBlock->PreviousSizeInWords - OS_MEMORY_BLOCK_HEADER_SIZE_IN_WORDS);
+}
 
-	MemoryBlockIterator->SizeInWords = (OS_HEAP_SIZE_IN_BYTES / OS_WORD_SIZE_IN_BYTES);
+static OS_HEAP_REGION *OS_GetHeapRegion(void *Ptr)
+{
+	UINT32 i;
 
-	#if(CLEAR_HEAP_AT_START_UP == 1)
-		memset(&gKernelManagedMemory[1], HEAP_INITIALIZATION_VALUE, (OS_HEAP_SIZE_IN_BYTES / OS_WORD_SIZE_IN_BYTES));
-	#endif // end of #if(CLEAR_HEAP_AT_START_UP == 1)
+	// anything we handed out sits after a memory header and before the end of its region
+	for (i = 0; i < gHeapRegionCount; i++)
+		if ((OS_WORD)Ptr > (OS_WORD)gHeapRegions[i].StartOfRegion && (OS_WORD)Ptr < (OS_WORD)gHeapRegions[i].EndOfRegion)
+			return &gHeapRegions[i];
 
-    #if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1)
-        gMemoryWarning = FALSE;
-    #endif // end of USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1
+	return (OS_HEAP_REGION*)NULL;
+}
+
+static void OS_AddHeapUsage(OS_HEAP_REGION *HeapRegion, UINT32 SizeInBytes)
+{
+	#if (USING_HEAP_REGIONS == 1)
+		HeapRegion->UsedInBytes += SizeInBytes;
+
+		if (HeapRegion->UsedInBytes > HeapRegion->MaximumUsedInBytes)
+			HeapRegion->MaximumUsedInBytes = HeapRegion->UsedInBytes;
+	#endif // end of #if (USING_HEAP_REGIONS == 1)
 
     #if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1 || USING_GET_HEAP_USED_IN_BYTES_METHOD == 1 || USING_GET_HEAP_REMAINING_IN_BYTES_METHOD == 1)
-        gHeapUsedInBytes = 0;
+		// only the OS heap counts towards the heap used and the memory warning
+		if (OS_IsOSHeapRegion(HeapRegion))
+			gHeapUsedInBytes += SizeInBytes;
     #endif // end of #if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1 || USING_GET_HEAP_USED_IN_BYTES_METHOD == 1 || USING_GET_HEAP_REMAINING_IN_BYTES_METHOD == 1)
+}
 
-	return TRUE;
+static void OS_RemoveHeapUsage(OS_HEAP_REGION *HeapRegion, UINT32 SizeInBytes)
+{
+	#if (USING_HEAP_REGIONS == 1)
+		HeapRegion->UsedInBytes -= SizeInBytes;
+	#endif // end of #if (USING_HEAP_REGIONS == 1)
+
+    #if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1 || USING_GET_HEAP_USED_IN_BYTES_METHOD == 1 || USING_GET_HEAP_REMAINING_IN_BYTES_METHOD == 1)
+		if (OS_IsOSHeapRegion(HeapRegion))
+			gHeapUsedInBytes -= SizeInBytes;
+    #endif // end of #if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1 || USING_GET_HEAP_USED_IN_BYTES_METHOD == 1 || USING_GET_HEAP_REMAINING_IN_BYTES_METHOD == 1)
 }
 
-void *OS_AllocateMemory(UINT32 SizeInBytes)
+#if (USING_TASK_HEAP_ACCOUNTING == 1 || USING_MEMORY_TRACE == 1 || USING_HEAP_REGIONS == 1)
+	extern TASK * volatile gCurrentTask;
+	extern BOOL gCPUSchedulerRunning;
+
+	// until the scheduler is running nothing is executing as a TASK
+	#define OS_GetCurrentMemoryOwner()					(gCPUSchedulerRunning == TRUE ? (TASK*)gCurrentTask : (TASK*)NULL)
+#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1 || USING_MEMORY_TRACE == 1 || USING_HEAP_REGIONS == 1)
+
+#if (USING_MEMORY_TRACE == 1)
+	extern volatile UINT32 gOSTickCount;
+
+	static MEMORY_TRACE_RECORD gMemoryTrace[MEMORY_TRACE_SIZE_IN_RECORDS];
+	static UINT32 gMemoryTraceNextRecord;
+	static UINT32 gMemoryTraceRecordCount;
+	static UINT32 gMemoryTraceRecordsDropped;
+
+	// the user callable methods leave their caller here so the trace does not just point back at them
+	static void *gMemoryTraceCaller;
+
+	#define OS_SetMemoryTraceCaller()					if (gMemoryTraceCaller == (void*)NULL) gMemoryTraceCaller = __builtin_return_address(0)
+	#define OS_ClearMemoryTraceCaller()					gMemoryTraceCaller = (void*)NULL
+	#define OS_TraceMemory(Type, Ptr, SizeInBytes)		OS_RecordMemoryTrace(Type, Ptr, SizeInBytes, (gMemoryTraceCaller != (void*)NULL ? gMemoryTraceCaller : __builtin_return_address(0)))
+
+	static void OS_RecordMemoryTrace(BYTE Type, void *Ptr, UINT32 SizeInBytes, void *Caller)
+	{
+		MEMORY_TRACE_RECORD *Record = &gMemoryTrace[gMemoryTraceNextRecord];
+
+		Record->OSTickCount = gOSTickCount;
+		Record->Task = (void*)OS_GetCurrentMemoryOwner();
+		Record->Caller = Caller;
+		Record->Ptr = Ptr;
+		Record->SizeInBytes = SizeInBytes;
+		Record->Type = Type;
+
+		if (++gMemoryTraceNextRecord == MEMORY_TRACE_SIZE_IN_RECORDS)
+			gMemoryTraceNextRecord = 0;
+
+		// when the ring buffer is full the oldest record was just written over
+		if (gMemoryTraceRecordCount == MEMORY_TRACE_SIZE_IN_RECORDS)
+			gMemoryTraceRecordsDropped++;
+		else
+			gMemoryTraceRecordCount++;
+	}
+#else
+	#define OS_SetMemoryTraceCaller()
+	#define OS_ClearMemoryTraceCaller()
+	#define OS_TraceMemory(Type, Ptr, SizeInBytes)
+#endif // end of #if (USING_MEMORY_TRACE == 1)
+
+#if (USING_TASK_HEAP_ACCOUNTING == 1)
+
+	static void OS_AddTaskHeapUsage(TASK *Task, UINT32 SizeInBytes)
+	{
+		if (Task == (TASK*)NULL)
+			return;
+
+		Task->HeapUsedInBytes += SizeInBytes;
+
+		if (Task->HeapUsedInBytes > Task->MaximumHeapUsedInBytes)
+			Task->MaximumHeapUsedInBytes = Task->HeapUsedInBytes;
+	}
+
+	static void OS_RemoveTaskHeapUsage(TASK *Task, UINT32 SizeInBytes)
+	{
+		if (Task != (TASK*)NULL)
+			Task->HeapUsedInBytes -= SizeInBytes;
+	}
+
+	#if (USING_TASK_HEAP_QUOTA == 1)
+		static BOOL OS_TaskHeapQuotaAllows(TASK *Task, UINT32 SizeInBytes)
+		{
+			// a quota of 0 means the TASK has no limit
+			if (Task == (TASK*)NULL || Task->HeapQuotaInBytes == 0)
+				return TRUE;
+
+			// written so a huge request cannot wrap the sum back under the quota
+			return (BOOL)(Task->HeapUsedInBytes <= Task->HeapQuotaInBytes && SizeInBytes <= Task->HeapQuotaInBytes - Task->HeapUsedInBytes);
+		}
+	#endif // end of #if (USING_TASK_HEAP_QUOTA == 1)
+
+	void OS_SetMemoryOwner(void *Ptr, void *Owner)
+	{
+		OS_MEMORY_BLOCK_HEADER *MemoryBlock = ((OS_MEMORY_BLOCK_HEADER*)Ptr) - 1;
+		UINT32 SizeInBytes = (MemoryBlock->SizeInWords * OS_WORD_SIZE_IN_BYTES) + OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES;
+
+		OS_RemoveTaskHeapUsage((TASK*)MemoryBlock->Owner, SizeInBytes);
+
+		MemoryBlock->Owner = Owner;
+
+		OS_AddTaskHeapUsage((TASK*)Owner, SizeInBytes);
+	}
+#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
+
+#if (USING_TASK_STACK_ARENA == 1)
+	#define TASK_STACK_ARENA_MINIMUM_BLOCK_SIZE_IN_BYTES		(1UL << TASK_STACK_ARENA_MINIMUM_BLOCK_SIZE_LOG2)
+	#define TASK_STACK_ARENA_SIZE_IN_BYTES						(1UL << TASK_STACK_ARENA_SIZE_LOG2)
+	#define TASK_STACK_ARENA_NUMBER_OF_ORDERS					(TASK_STACK_ARENA_SIZE_LOG2 - TASK_STACK_ARENA_MINIMUM_BLOCK_SIZE_LOG2 + 1)
+	#define TASK_STACK_ARENA_NUMBER_OF_BLOCKS					(1UL << (TASK_STACK_ARENA_NUMBER_OF_ORDERS - 1))
+
+	// set in gTaskStackArenaBlockOrders[] for the first minimum sized block of a free or allocated block
+	#define TASK_STACK_ARENA_BLOCK_FREE							0x80
+	#define TASK_STACK_ARENA_BLOCK_IN_USE						0x40
+	#define TASK_STACK_ARENA_BLOCK_ORDER_MASK					0x3F
+
+	// a free block of the arena, on the free list for its order
+	typedef struct OS_TASK_STACK_ARENA_BLOCK
+	{
+		struct OS_TASK_STACK_ARENA_BLOCK *Next;
+		struct OS_TASK_STACK_ARENA_BLOCK *Previous;
+	}OS_TASK_STACK_ARENA_BLOCK;
+
+	static OS_WORD gTaskStackArena[TASK_STACK_ARENA_SIZE_IN_BYTES / OS_WORD_SIZE_IN_BYTES];
+	static OS_TASK_STACK_ARENA_BLOCK *gTaskStackArenaFreeLists[TASK_STACK_ARENA_NUMBER_OF_ORDERS];
+
+	// the order of each block and if it is free or in use, stored at the index of its first
+	// minimum sized block, 0 for every index which does not start a block
+	static BYTE gTaskStackArenaBlockOrders[TASK_STACK_ARENA_NUMBER_OF_BLOCKS];
+
+	#define OS_GetTaskStackArenaBlock(Index)					((OS_TASK_STACK_ARENA_BLOCK*)((BYTE*)gTaskStackArena + ((Index) << TASK_STACK_ARENA_MINIMUM_BLOCK_SIZE_LOG2)))
+	#define OS_GetTaskStackArenaIndex(Ptr)						((UINT32)((BYTE*)(Ptr) - (BYTE*)gTaskStackArena) >> TASK_STACK_ARENA_MINIMUM_BLOCK_SIZE_LOG2)
+	#define OS_AddressInTaskStackArena(Ptr)						((BYTE*)(Ptr) >= (BYTE*)gTaskStackArena && (BYTE*)(Ptr) < (BYTE*)gTaskStackArena + TASK_STACK_ARENA_SIZE_IN_BYTES)
+
+	static void OS_InsertTaskStackArenaBlock(UINT32 Index, UINT32 Order)
+	{
+		OS_TASK_STACK_ARENA_BLOCK *Block = OS_GetTaskStackArenaBlock(Index);
+
+		Block->Previous = (OS_TASK_STACK_ARENA_BLOCK*)NULL;
+		Block->Next = gTaskStackArenaFreeLists[Order];
+
+		if (Block->Next != (OS_TASK_STACK_ARENA_BLOCK*)NULL)
+			Block->Next->Previous = Block;
+
+		gTaskStackArenaFreeLists[Order] = Block;
+
+		gTaskStackArenaBlockOrders[Index] = (BYTE)(Order | TASK_STACK_ARENA_BLOCK_FREE);
+	}
+
+	static void OS_RemoveTaskStackArenaBlock(UINT32 Index, UINT32 Order)
+	{
+		OS_TASK_STACK_ARENA_BLOCK *Block = OS_GetTaskStackArenaBlock(Index);
+
+		if (Block->Previous != (OS_TASK_STACK_ARENA_BLOCK*)NULL)
+			Block->Previous->Next = Block->Next;
+		else
+			gTaskStackArenaFreeLists[Order] = Block->Next;
+
+		if (Block->Next != (OS_TASK_STACK_ARENA_BLOCK*)NULL)
+			Block->Next->Previous = Block->Previous;
+
+		gTaskStackArenaBlockOrders[Index] = 0;
+	}
+
+	static void OS_InitializeTaskStackArena(void)
+	{
+		memset((void*)gTaskStackArenaFreeLists, 0, sizeof(gTaskStackArenaFreeLists));
+		memset((void*)gTaskStackArenaBlockOrders, 0, sizeof(gTaskStackArenaBlockOrders));
+
+		// the whole arena starts as one free block
+		OS_InsertTaskStackArenaBlock(0, TASK_STACK_ARENA_NUMBER_OF_ORDERS - 1);
+	}
+
+	static void *OS_AllocateTaskStackArenaBlock(UINT32 SizeInBytes)
+	{
+		UINT32 Order = 0;
+		UINT32 FreeOrder;
+		UINT32 Index;
+
+		if (SizeInBytes == 0 || SizeInBytes > TASK_STACK_ARENA_SIZE_IN_BYTES)
+			return (void*)NULL;
+
+		// find the smallest power of 2 the stack fits in
+		while ((TASK_STACK_ARENA_MINIMUM_BLOCK_SIZE_IN_BYTES << Order) < SizeInBytes)
+			Order++;
+
+		// then the smallest free block at least that big
+		for (FreeOrder = Order; FreeOrder < TASK_STACK_ARENA_NUMBER_OF_ORDERS; FreeOrder++)
+			if (gTaskStackArenaFreeLists[FreeOrder] != (OS_TASK_STACK_ARENA_BLOCK*)NULL)
+				break;
+
+		if (FreeOrder == TASK_STACK_ARENA_NUMBER_OF_ORDERS)
+			return (void*)NULL;
+
+		Index = OS_GetTaskStackArenaIndex(gTaskStackArenaFreeLists[FreeOrder]);
+
+		OS_RemoveTaskStackArenaBlock(Index, FreeOrder);
+
+		// halve it until it is the size asked for, the upper halves stay free
+		while (FreeOrder > Order)
+		{
+			FreeOrder--;
+
+			OS_InsertTaskStackArenaBlock(Index + (1UL << FreeOrder), FreeOrder);
+		}
+
+		gTaskStackArenaBlockOrders[Index] = (BYTE)(Order | TASK_STACK_ARENA_BLOCK_IN_USE);
+
+		return (void*)OS_GetTaskStackArenaBlock(Index);
+	}
+
+	static BOOL OS_ReleaseTaskStackArenaBlock(void *Ptr)
+	{
+		UINT32 Index = OS_GetTaskStackArenaIndex(Ptr);
+		UINT32 Order;
+		UINT32 BuddyIndex;
+
+		// only the start of a block that is in use can be released
+		if ((void*)OS_GetTaskStackArenaBlock(Index) != Ptr || (gTaskStackArenaBlockOrders[Index] & TASK_STACK_ARENA_BLOCK_IN_USE) == 0)
+			return FALSE;
+
+		Order = gTaskStackArenaBlockOrders[Index] & TASK_STACK_ARENA_BLOCK_ORDER_MASK;
+
+		// merge with the buddy for as long as it is free and whole
+		while (Order < TASK_STACK_ARENA_NUMBER_OF_ORDERS - 1)
+		{
+			BuddyIndex = Index ^ (1UL << Order);
+
+			if (gTaskStackArenaBlockOrders[BuddyIndex] != (BYTE)(Order | TASK_STACK_ARENA_BLOCK_FREE))
+				break;
+
+			OS_RemoveTaskStackArenaBlock(BuddyIndex, Order);
+
+			Index &= ~(1UL << Order);
+
+			Order++;
+		}
+
+		OS_InsertTaskStackArenaBlock(Index, Order);
+
+		return TRUE;
+	}
+#endif // end of #if (USING_TASK_STACK_ARENA == 1)
+
+#if (USING_TLSF_MEMORY_ALLOCATOR == 0)
+// the first fit allocator walks the heap to find free blocks, so there is no free list to keep up to date
+#define OS_MEMORY_MINIMUM_BLOCK_SIZE_IN_WORDS				1
+#define OS_InsertFreeMemoryBlock(HeapRegion, MemoryBlock)
+#define OS_RemoveFreeMemoryBlock(HeapRegion, MemoryBlock)
+
+static void OS_InitializeHeapRegion(OS_HEAP_REGION *HeapRegion)
 {
-	UINT32 RequestedSizeInWords;
-	void *StartingMemoryAddress;
-	OS_MEMORY_BLOCK_HEADER *MemoryBlockIterator;
+	OS_MEMORY_BLOCK_HEADER *MemoryBlockIterator = HeapRegion->StartOfRegion;
 
-	if (SizeInBytes == 0)
-		return (void*)NULL;
+	// make the first block not allocated
+	MemoryBlockIterator->Allocated = 0;
 
-	StartingMemoryAddress = (void*)NULL;
-	MemoryBlockIterator = (OS_MEMORY_BLOCK_HEADER*)gKernelManagedMemory;
+	// it takes up the whole region
+	MemoryBlockIterator->SizeInWords = (UINT32)((OS_WORD*)HeapRegion->EndOfRegion - (OS_WORD*)(MemoryBlockIterator + 1));
 
-	// the request has to be at least OS_WORD_SIZE_IN_BYTES large
-	if (SizeInBytes < OS_WORD_SIZE_IN_BYTES)
-		SizeInBytes = OS_WORD_SIZE_IN_BYTES;
+	MemoryBlockIterator->PreviousSizeInWords = 0;
 
-	// make it evenly divisible by OS_WORD_SIZE_IN_BYTES
-	if ((SizeInBytes % OS_WORD_SIZE_IN_BYTES) != 0)
-		SizeInBytes += (OS_WORD_SIZE_IN_BYTES - (SizeInBytes % OS_WORD_SIZE_IN_BYTES));
+	#if(CLEAR_HEAP_AT_START_UP == 1)
+		memset(MemoryBlockIterator + 1, HEAP_INITIALIZATION_VALUE, MemoryBlockIterator->SizeInWords * OS_WORD_SIZE_IN_BYTES);
+	#endif // end of #if(CLEAR_HEAP_AT_START_UP == 1)
+}
 
-	// first normalize the request to words, and make it a value thats word aligned
-	RequestedSizeInWords = SizeInBytes / OS_WORD_SIZE_IN_BYTES;
+static OS_MEMORY_BLOCK_HEADER *OS_TakeFreeMemoryBlock(OS_HEAP_REGION *HeapRegion, UINT32 RequestedSizeInWords)
+{
+	OS_MEMORY_BLOCK_HEADER *MemoryBlockIterator = HeapRegion->StartOfRegion;
 
 	while (1)
 	{
@@ -179,9 +551,9 @@ void *OS_AllocateMemory(UINT32 SizeInBytes)
 		while (MemoryBlockIterator->Allocated)
 		{
 			// check to see if we have reached the end of the heap, if so return (void*)NULL
-			if ((MemoryBlockIterator = OS_IterateMemoryBlockHeader(MemoryBlockIterator)) == (OS_MEMORY_BLOCK_HEADER*)NULL)
+			if ((MemoryBlockIterator = OS_GetNextPhysicalMemoryBlock(HeapRegion, MemoryBlockIterator)) == (OS_MEMORY_BLOCK_HEADER*)NULL)
 			{
-				return (void*)NULL;
+				return (OS_MEMORY_BLOCK_HEADER*)NULL;
 			}
 		}
 
@@ -190,9 +562,9 @@ void *OS_AllocateMemory(UINT32 SizeInBytes)
 			break;
 
 		// check to see if we have reached the end of the heap, if so return (void*)NULL
-		if ((MemoryBlockIterator = OS_IterateMemoryBlockHeader(MemoryBlockIterator)) == (OS_MEMORY_BLOCK_HEADER*)NULL)
+		if ((MemoryBlockIterator = OS_GetNextPhysicalMemoryBlock(HeapRegion, MemoryBlockIterator)) == (OS_MEMORY_BLOCK_HEADER*)NULL)
 		{
-			return (void*)NULL;
+			return (OS_MEMORY_BLOCK_HEADER*)NULL;
 		}
 	}
 
@@ -200,62 +572,41 @@ void *OS_AllocateMemory(UINT32 SizeInBytes)
 
 	// Now check to see if there is enough room in this memory block to make another one, otherwise just add on the
 	// space to the current memory block
-
-	if (MemoryBlockIterator->SizeInWords >= (RequestedSizeInWords + ((OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES / OS_WORD_SIZE_IN_BYTES) + 1)))
+	if (MemoryBlockIterator->SizeInWords >= (RequestedSizeInWords + OS_MEMORY_BLOCK_HEADER_SIZE_IN_WORDS + 1))
 	{
 		// There's enough room in the current memory block to allocate at least the space requested another OS_MEMORY_BLOCK_HEADER
 		// and 1 word
-		// Just need to save this for the time being
-		UINT32 Space = MemoryBlockIterator->SizeInWords;
-		MemoryBlockIterator->SizeInWords = RequestedSizeInWords;
-
-		// Iterate to the open space that will be allocated
-		MemoryBlockIterator++;
-		StartingMemoryAddress = (void*)MemoryBlockIterator;
-
-		// Iterate the MemoryBlockIterator to the end of the newly allocated space
-		MemoryBlockIterator += (SizeInBytes / OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES);
-		MemoryBlockIterator->Allocated = FALSE;
-		MemoryBlockIterator->SizeInWords = (Space - RequestedSizeInWords - (OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES / OS_WORD_SIZE_IN_BYTES));
-	}
-	else
-	{
-		MemoryBlockIterator++;
-		StartingMemoryAddress = (void*)(MemoryBlockIterator);
-	}
+		OS_MEMORY_BLOCK_HEADER *RemainingMemoryBlock = (OS_MEMORY_BLOCK_HEADER*)((OS_WORD*)(MemoryBlockIterator + 1) + RequestedSizeInWords);
+		OS_MEMORY_BLOCK_HEADER *NextMemoryBlock;
 
-    #if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1 || USING_GET_HEAP_USED_IN_BYTES_METHOD == 1 || USING_GET_HEAP_REMAINING_IN_BYTES_METHOD == 1)
-        gHeapUsedInBytes += SizeInBytes + sizeof(OS_MEMORY_BLOCK_HEADER);
-    #endif // end of #if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1 || USING_GET_HEAP_USED_IN_BYTES_METHOD == 1 || USING_GET_HEAP_REMAINING_IN_BYTES_METHOD == 1)
-    
-	#if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1)
-		if (gMemoryWarning == FALSE)
-		{
-			if (gHeapUsedInBytes > MEMORY_WARNING_LEVEL_IN_BYTES)
-			{
-				gMemoryWarning = TRUE;
+		RemainingMemoryBlock->Allocated = FALSE;
+		RemainingMemoryBlock->SizeInWords = (MemoryBlockIterator->SizeInWords - RequestedSizeInWords - OS_MEMORY_BLOCK_HEADER_SIZE_IN_WORDS);
+		RemainingMemoryBlock->PreviousSizeInWords = RequestedSizeInWords;
 
-				#if (USING_MEMORY_WARNING_USER_CALLBACK == 1)
-					MemoryWarningUserCallback(gHeapUsedInBytes);
-				#endif // end of USING_MEMORY_WARNING_USER_CALLBACK
+		// the block after the remaining space has to know how far back it now starts
+		if ((NextMemoryBlock = OS_GetNextPhysicalMemoryBlock(HeapRegion, RemainingMemoryBlock)) != (OS_MEMORY_BLOCK_HEADER*)NULL)
+			NextMemoryBlock->PreviousSizeInWords = RemainingMemoryBlock->SizeInWords;
 
-				#if (USING_MEMORY_WARNING_EVENT == 1)
-					OS_RaiseEvent(MEMORY_WARNING_EVENT);
-				#endif // end of USING_MEMORY_WARNING_EVENT == 1
-			}
-		}
-	#endif // end of USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1
+		MemoryBlockIterator->SizeInWords = RequestedSizeInWords;
+	}
 
-	return (void*)StartingMemoryAddress;
+	return MemoryBlockIterator;
 }
 
 BOOL OS_ReleaseMemory(void *Ptr)
 {
+	OS_HEAP_REGION *HeapRegion;
 	OS_MEMORY_BLOCK_HEADER *MemoryBlockIterator;
 	OS_MEMORY_BLOCK_HEADER *MemoryBlockIterator2;
 
+	#if (USING_TASK_STACK_ARENA == 1)
+		// TASK stacks in the arena are handed back to it
+		if (OS_AddressInTaskStackArena(Ptr))
+			return OS_ReleaseTaskStackArenaBlock(Ptr);
+	#endif // end of #if (USING_TASK_STACK_ARENA == 1)
+
     // is the address even in the OS Heap?  If not we can't delete it.
-	if (AddressInHeap((OS_WORD)Ptr) == FALSE)
+	if ((HeapRegion = OS_GetHeapRegion(Ptr)) == (OS_HEAP_REGION*)NULL)
 		return FALSE;
 
 	MemoryBlockIterator = (OS_MEMORY_BLOCK_HEADER*)Ptr;
@@ -263,113 +614,858 @@ BOOL OS_ReleaseMemory(void *Ptr)
 	// Back up to where the memory block resides in memory
 	MemoryBlockIterator--;
 
-	MemoryBlockIterator2 = MemoryBlockIterator;
+	// releasing a block twice would corrupt the heap used count
+	if (!MemoryBlockIterator->Allocated)
+		return FALSE;
 
-    #if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1 || USING_GET_HEAP_USED_IN_BYTES_METHOD == 1 || USING_GET_HEAP_REMAINING_IN_BYTES_METHOD == 1)
-        // Record the amount of bytes that were in block and subtract them, we may be able to get rid of the header later on
-        gHeapUsedInBytes -= (MemoryBlockIterator->SizeInWords * 4);
-    #endif // end of #if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1 || USING_GET_HEAP_USED_IN_BYTES_METHOD == 1 || USING_GET_HEAP_REMAINING_IN_BYTES_METHOD == 1)
+	OS_TraceMemory(MEMORY_TRACE_RELEASE, Ptr, MemoryBlockIterator->SizeInWords * OS_WORD_SIZE_IN_BYTES);
+
+	// Record the amount of bytes that were in block and subtract them
+	OS_RemoveHeapUsage(HeapRegion, (MemoryBlockIterator->SizeInWords * OS_WORD_SIZE_IN_BYTES) + OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES);
+
+	#if (USING_TASK_HEAP_ACCOUNTING == 1)
+		OS_RemoveTaskHeapUsage((TASK*)MemoryBlockIterator->Owner, (MemoryBlockIterator->SizeInWords * OS_WORD_SIZE_IN_BYTES) + OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES);
+	#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
 
 	// Unallocate the memory block
 	MemoryBlockIterator->Allocated = FALSE;
 
-	// jump to the potential next memory block
-	MemoryBlockIterator += ((MemoryBlockIterator->SizeInWords * 4) / OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES) + 1;
+	// If the block after us isn't allocated we're going to merge it.
+	MemoryBlockIterator2 = OS_GetNextPhysicalMemoryBlock(HeapRegion, MemoryBlockIterator);
+
+	if (MemoryBlockIterator2 != (OS_MEMORY_BLOCK_HEADER*)NULL && !MemoryBlockIterator2->Allocated)
+		MemoryBlockIterator->SizeInWords += MemoryBlockIterator2->SizeInWords + OS_MEMORY_BLOCK_HEADER_SIZE_IN_WORDS;
 
-	// We must check to see if the block after us is allocated, lets see if we jump out of bounds
-	if (MemoryBlockIterator < (OS_MEMORY_BLOCK_HEADER*)&(gKernelManagedMemory[(OS_HEAP_SIZE_IN_BYTES / OS_WORD_SIZE_IN_BYTES)]))
+	// Now lets see if the memory block before us is allocated or not, if not merge us into it.
+	MemoryBlockIterator2 = OS_GetPreviousPhysicalMemoryBlock(HeapRegion, MemoryBlockIterator);
+
+	if (MemoryBlockIterator2 != (OS_MEMORY_BLOCK_HEADER*)NULL && !MemoryBlockIterator2->Allocated)
 	{
-		// If we're in here we haven't jumped out of bounds, and the memory block is valid.  Lets see if its allocated
-		// if so then we're going to merge it.
-		if (!MemoryBlockIterator->Allocated)
-		{
-            #if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1 || USING_GET_HEAP_USED_IN_BYTES_METHOD == 1 || USING_GET_HEAP_REMAINING_IN_BYTES_METHOD == 1)
-                // subtract the size of one header from the heap used since we're merging 2 blocks
-                gHeapUsedInBytes -= sizeof(OS_MEMORY_BLOCK_HEADER);
-            #endif // end of #if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1 || USING_GET_HEAP_USED_IN_BYTES_METHOD == 1 || USING_GET_HEAP_REMAINING_IN_BYTES_METHOD == 1)
+		MemoryBlockIterator2->SizeInWords += MemoryBlockIterator->SizeInWords + OS_MEMORY_BLOCK_HEADER_SIZE_IN_WORDS;
 
-			// We can merge the 2, this ones unallocated
-			MemoryBlockIterator2->SizeInWords += MemoryBlockIterator->SizeInWords + (OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES / OS_WORD_SIZE_IN_BYTES);
-		}
+		MemoryBlockIterator = MemoryBlockIterator2;
 	}
 
-	// Lets make sure the memory block wasn't the first one, cause if it was theres nothing before it!
-	if (MemoryBlockIterator2 != (OS_MEMORY_BLOCK_HEADER*)gKernelManagedMemory)
-	{
-		OS_WORD PreviousJumpInWords;
+	// the block after the merged block needs to know how far back to jump now
+	if ((MemoryBlockIterator2 = OS_GetNextPhysicalMemoryBlock(HeapRegion, MemoryBlockIterator)) != (OS_MEMORY_BLOCK_HEADER*)NULL)
+		MemoryBlockIterator2->PreviousSizeInWords = MemoryBlockIterator->SizeInWords;
 
-		// Now lets see if the memory block before the first one is allocated or not.
-		MemoryBlockIterator = (OS_MEMORY_BLOCK_HEADER*)gKernelManagedMemory;
+	#if (USING_GET_HEAP_STATISTICS_METHOD == 1 || USING_TASK_HEAP_RECLAIM == 1)
+		gHeapModificationCount++;
+	#endif // end of #if (USING_GET_HEAP_STATISTICS_METHOD == 1 || USING_TASK_HEAP_RECLAIM == 1)
 
-		do
-		{
-			PreviousJumpInWords = MemoryBlockIterator->SizeInWords;
+	#if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1)
+		OS_CheckMemoryWarningClear();
+	#endif // end of USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1
+
+	return TRUE;
+}
+#else
+	#define OS_MEMORY_MINIMUM_BLOCK_SIZE_IN_WORDS			TLSF_MINIMUM_BLOCK_SIZE_IN_WORDS
+	#define OS_InsertFreeMemoryBlock(HeapRegion, MemoryBlock)	OS_TLSFInsertFreeBlock(HeapRegion, MemoryBlock)
+	#define OS_RemoveFreeMemoryBlock(HeapRegion, MemoryBlock)	OS_TLSFRemoveFreeBlock(HeapRegion, MemoryBlock)
 
-			MemoryBlockIterator += ((MemoryBlockIterator->SizeInWords * 4) / OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES + 1);
-		} 
-		while (MemoryBlockIterator != MemoryBlockIterator2);
+	static UINT32 OS_TLSFFindLastSet(UINT32 Value)
+	{
+		return 31 - PortCountLeadingZeros(Value);
+	}
 
-		// Now that we're at where we we're allocated, we have to go back by one memory block
-		MemoryBlockIterator -= ((PreviousJumpInWords * 4) / OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES + 1);
+	static UINT32 OS_TLSFFindFirstSet(UINT32 Value)
+	{
+		// isolate the lowest set bit
+		return OS_TLSFFindLastSet(Value & (~Value + 1));
+	}
 
-		if (!MemoryBlockIterator->Allocated)
+	static void OS_TLSFGetListIndexes(UINT32 SizeInBytes, UINT32 *FirstLevelIndex, UINT32 *SecondLevelIndex)
+	{
+		if (SizeInBytes < TLSF_SMALL_BLOCK_SIZE_IN_BYTES)
+		{
+			*FirstLevelIndex = 0;
+			*SecondLevelIndex = SizeInBytes / OS_WORD_SIZE_IN_BYTES;
+		}
+		else
 		{
-            #if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1 || USING_GET_HEAP_USED_IN_BYTES_METHOD == 1 || USING_GET_HEAP_REMAINING_IN_BYTES_METHOD == 1)
-                // subtract the size of one header from the heap used since we're merging 2 blocks
-                gHeapUsedInBytes -= sizeof(OS_MEMORY_BLOCK_HEADER);
-            #endif // end of #if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1 || USING_GET_HEAP_USED_IN_BYTES_METHOD == 1 || USING_GET_HEAP_REMAINING_IN_BYTES_METHOD == 1)
+			UINT32 HighestBit = OS_TLSFFindLastSet(SizeInBytes);
 
-			// This memory block isn't allocated, lets merge them
-			MemoryBlockIterator->SizeInWords += (MemoryBlockIterator2->SizeInWords + OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES / OS_WORD_SIZE_IN_BYTES);
+			// the bits just below the highest set bit pick the size class in the power of 2
+			*SecondLevelIndex = (SizeInBytes >> (HighestBit - TLSF_SECOND_LEVEL_INDEX_COUNT_LOG2)) ^ TLSF_SECOND_LEVEL_INDEX_COUNT;
+			*FirstLevelIndex = HighestBit - (TLSF_FIRST_LEVEL_INDEX_SHIFT - 1);
 		}
 	}
 
-	#if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1)
-		if (gMemoryWarning == TRUE)
-		{
-			if (gHeapUsedInBytes < MEMORY_WARNING_LEVEL_IN_BYTES)
-			{
-				gMemoryWarning = FALSE;
+	static OS_MEMORY_FREE_BLOCK_LINKS *OS_TLSFGetFreeBlockLinks(OS_MEMORY_BLOCK_HEADER *MemoryBlock)
+	{
+		return (OS_MEMORY_FREE_BLOCK_LINKS*)(MemoryBlock + 1);
+	}
 
-				#if (USING_MEMORY_WARNING_CLEAR_USER_CALLBACK == 1)
-					MemoryWarningClearUserCallback();
-				#endif // end of USING_MEMORY_WARNING_CLEAR_USER_CALLBACK
+	static void OS_TLSFInsertFreeBlock(OS_HEAP_REGION *HeapRegion, OS_MEMORY_BLOCK_HEADER *MemoryBlock)
+	{
+		UINT32 FirstLevelIndex, SecondLevelIndex;
+		OS_MEMORY_FREE_BLOCK_LINKS *Links = OS_TLSFGetFreeBlockLinks(MemoryBlock);
 
-				#if (USING_MEMORY_WARNING_CLEAR_EVENT == 1)
-					OS_RaiseEvent(MEMORY_WARNING_CLEAR_EVENT);
-				#endif // end of USING_MEMORY_WARNING_CLEAR_EVENT == 1
-			}
-		}
-	#endif // end of USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1
+		OS_TLSFGetListIndexes(MemoryBlock->SizeInWords * OS_WORD_SIZE_IN_BYTES, &FirstLevelIndex, &SecondLevelIndex);
 
-	return TRUE;
-}
+		// put it at the front of its size class
+		Links->NextFreeBlock = HeapRegion->FreeBlockLists[FirstLevelIndex][SecondLevelIndex];
+		Links->PreviousFreeBlock = (OS_MEMORY_BLOCK_HEADER*)NULL;
 
-void *AllocateMemory(UINT32 SizeInBytes)
-{
-	void *AllocatedMemory;
+		if (Links->NextFreeBlock != (OS_MEMORY_BLOCK_HEADER*)NULL)
+			OS_TLSFGetFreeBlockLinks(Links->NextFreeBlock)->PreviousFreeBlock = MemoryBlock;
 
-	EnterCritical();
+		HeapRegion->FreeBlockLists[FirstLevelIndex][SecondLevelIndex] = MemoryBlock;
 
-	AllocatedMemory = OS_AllocateMemory(SizeInBytes);
+		HeapRegion->FirstLevelBitmap |= (1 << FirstLevelIndex);
+		HeapRegion->SecondLevelBitmap[FirstLevelIndex] |= (1 << SecondLevelIndex);
+	}
 
-	ExitCritical();
+	static void OS_TLSFRemoveFreeBlock(OS_HEAP_REGION *HeapRegion, OS_MEMORY_BLOCK_HEADER *MemoryBlock)
+	{
+		UINT32 FirstLevelIndex, SecondLevelIndex;
+		OS_MEMORY_FREE_BLOCK_LINKS *Links = OS_TLSFGetFreeBlockLinks(MemoryBlock);
+
+		OS_TLSFGetListIndexes(MemoryBlock->SizeInWords * OS_WORD_SIZE_IN_BYTES, &FirstLevelIndex, &SecondLevelIndex);
+
+		if (Links->NextFreeBlock != (OS_MEMORY_BLOCK_HEADER*)NULL)
+			OS_TLSFGetFreeBlockLinks(Links->NextFreeBlock)->PreviousFreeBlock = Links->PreviousFreeBlock;
+
+		if (Links->PreviousFreeBlock != (OS_MEMORY_BLOCK_HEADER*)NULL)
+		{
+			OS_TLSFGetFreeBlockLinks(Links->PreviousFreeBlock)->NextFreeBlock = Links->NextFreeBlock;
+		}
+		else
+		{
+			// it was the head of the list
+			HeapRegion->FreeBlockLists[FirstLevelIndex][SecondLevelIndex] = Links->NextFreeBlock;
+
+			if (Links->NextFreeBlock == (OS_MEMORY_BLOCK_HEADER*)NULL)
+			{
+				HeapRegion->SecondLevelBitmap[FirstLevelIndex] &= ~(1 << SecondLevelIndex);
+
+				if (HeapRegion->SecondLevelBitmap[FirstLevelIndex] == 0)
+					HeapRegion->FirstLevelBitmap &= ~(1 << FirstLevelIndex);
+			}
+		}
+	}
+
+	static OS_MEMORY_BLOCK_HEADER *OS_TLSFFindFreeBlock(OS_HEAP_REGION *HeapRegion, UINT32 SizeInBytes)
+	{
+		UINT32 FirstLevelIndex, SecondLevelIndex, Bitmap;
+
+		// round the request up to the next size class, that way every block in the list we land on is big enough
+		if (SizeInBytes >= TLSF_SMALL_BLOCK_SIZE_IN_BYTES)
+			SizeInBytes += (1 << (OS_TLSFFindLastSet(SizeInBytes) - TLSF_SECOND_LEVEL_INDEX_COUNT_LOG2)) - 1;
+
+		OS_TLSFGetListIndexes(SizeInBytes, &FirstLevelIndex, &SecondLevelIndex);
+
+		if (FirstLevelIndex >= TLSF_FIRST_LEVEL_INDEX_COUNT)
+			return (OS_MEMORY_BLOCK_HEADER*)NULL;
+
+		// first look for a free block in the same power of 2
+		Bitmap = HeapRegion->SecondLevelBitmap[FirstLevelIndex] & (0xFFFFFFFF << SecondLevelIndex);
+
+		if (Bitmap == 0)
+		{
+			// otherwise take the smallest block out of the next power of 2 that has any
+			Bitmap = HeapRegion->FirstLevelBitmap & (0xFFFFFFFF << (FirstLevelIndex + 1));
+
+			if (Bitmap == 0)
+				return (OS_MEMORY_BLOCK_HEADER*)NULL;
+
+			FirstLevelIndex = OS_TLSFFindFirstSet(Bitmap);
+
+			Bitmap = HeapRegion->SecondLevelBitmap[FirstLevelIndex];
+		}
+
+		SecondLevelIndex = OS_TLSFFindFirstSet(Bitmap);
+
+		return HeapRegion->FreeBlockLists[FirstLevelIndex][SecondLevelIndex];
+	}
+
+	static void OS_InitializeHeapRegion(OS_HEAP_REGION *HeapRegion)
+	{
+		OS_MEMORY_BLOCK_HEADER *MemoryBlock = HeapRegion->StartOfRegion;
+
+		HeapRegion->FirstLevelBitmap = 0;
+
+		memset((void*)HeapRegion->SecondLevelBitmap, 0, sizeof(HeapRegion->SecondLevelBitmap));
+		memset((void*)HeapRegion->FreeBlockLists, 0, sizeof(HeapRegion->FreeBlockLists));
+
+		// the whole region starts out as one free block
+		MemoryBlock->Allocated = 0;
+		MemoryBlock->SizeInWords = (UINT32)((OS_WORD*)HeapRegion->EndOfRegion - (OS_WORD*)(MemoryBlock + 1));
+		MemoryBlock->PreviousSizeInWords = 0;
+
+		#if(CLEAR_HEAP_AT_START_UP == 1)
+			memset(MemoryBlock + 1, HEAP_INITIALIZATION_VALUE, MemoryBlock->SizeInWords * OS_WORD_SIZE_IN_BYTES);
+		#endif // end of #if(CLEAR_HEAP_AT_START_UP == 1)
+
+		OS_TLSFInsertFreeBlock(HeapRegion, MemoryBlock);
+	}
+
+	static OS_MEMORY_BLOCK_HEADER *OS_TakeFreeMemoryBlock(OS_HEAP_REGION *HeapRegion, UINT32 RequestedSizeInWords)
+	{
+		OS_MEMORY_BLOCK_HEADER *MemoryBlock;
+
+		// nothing that big fits in any list, and the size in bytes could wrap below
+		if (RequestedSizeInWords >= ((UINT32)1 << TLSF_MAXIMUM_BLOCK_SIZE_LOG2) / OS_WORD_SIZE_IN_BYTES)
+			return (OS_MEMORY_BLOCK_HEADER*)NULL;
+
+		if ((MemoryBlock = OS_TLSFFindFreeBlock(HeapRegion, RequestedSizeInWords * OS_WORD_SIZE_IN_BYTES)) == (OS_MEMORY_BLOCK_HEADER*)NULL)
+			return (OS_MEMORY_BLOCK_HEADER*)NULL;
+
+		OS_TLSFRemoveFreeBlock(HeapRegion, MemoryBlock);
+
+		// if there is room left over for another block, split it off and give it back
+		if (MemoryBlock->SizeInWords >= (RequestedSizeInWords + OS_MEMORY_BLOCK_HEADER_SIZE_IN_WORDS + TLSF_MINIMUM_BLOCK_SIZE_IN_WORDS))
+		{
+			OS_MEMORY_BLOCK_HEADER *RemainingMemoryBlock = (OS_MEMORY_BLOCK_HEADER*)((OS_WORD*)(MemoryBlock + 1) + RequestedSizeInWords);
+			OS_MEMORY_BLOCK_HEADER *NextMemoryBlock;
+
+			RemainingMemoryBlock->Allocated = 0;
+			RemainingMemoryBlock->SizeInWords = MemoryBlock->SizeInWords - RequestedSizeInWords - OS_MEMORY_BLOCK_HEADER_SIZE_IN_WORDS;
+			RemainingMemoryBlock->PreviousSizeInWords = RequestedSizeInWords;
+
+			if ((NextMemoryBlock = OS_GetNextPhysicalMemoryBlock(HeapRegion, RemainingMemoryBlock)) != (OS_MEMORY_BLOCK_HEADER*)NULL)
+				NextMemoryBlock->PreviousSizeInWords = RemainingMemoryBlock->SizeInWords;
+
+			MemoryBlock->SizeInWords = RequestedSizeInWords;
+
+			OS_TLSFInsertFreeBlock(HeapRegion, RemainingMemoryBlock);
+		}
+
+		MemoryBlock->Allocated = 1;
+
+		return MemoryBlock;
+	}
+
+	BOOL OS_ReleaseMemory(void *Ptr)
+	{
+		OS_HEAP_REGION *HeapRegion;
+		OS_MEMORY_BLOCK_HEADER *MemoryBlock;
+		OS_MEMORY_BLOCK_HEADER *NeighborMemoryBlock;
+
+		#if (USING_TASK_STACK_ARENA == 1)
+			// TASK stacks in the arena are handed back to it
+			if (OS_AddressInTaskStackArena(Ptr))
+				return OS_ReleaseTaskStackArenaBlock(Ptr);
+		#endif // end of #if (USING_TASK_STACK_ARENA == 1)
+
+		// is the address even in the OS Heap?  If not we can't delete it.
+		if ((HeapRegion = OS_GetHeapRegion(Ptr)) == (OS_HEAP_REGION*)NULL)
+			return FALSE;
+
+		MemoryBlock = ((OS_MEMORY_BLOCK_HEADER*)Ptr) - 1;
+
+		// releasing a block twice would put it on a free list twice
+		if (MemoryBlock->Allocated == 0)
+			return FALSE;
+
+		OS_TraceMemory(MEMORY_TRACE_RELEASE, Ptr, MemoryBlock->SizeInWords * OS_WORD_SIZE_IN_BYTES);
+
+		OS_RemoveHeapUsage(HeapRegion, (MemoryBlock->SizeInWords * OS_WORD_SIZE_IN_BYTES) + OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES);
+
+		#if (USING_TASK_HEAP_ACCOUNTING == 1)
+			OS_RemoveTaskHeapUsage((TASK*)MemoryBlock->Owner, (MemoryBlock->SizeInWords * OS_WORD_SIZE_IN_BYTES) + OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES);
+		#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
+
+		MemoryBlock->Allocated = 0;
+
+		// merge with the block after us if it is free
+		NeighborMemoryBlock = OS_GetNextPhysicalMemoryBlock(HeapRegion, MemoryBlock);
+
+		if (NeighborMemoryBlock != (OS_MEMORY_BLOCK_HEADER*)NULL && NeighborMemoryBlock->Allocated == 0)
+		{
+			OS_TLSFRemoveFreeBlock(HeapRegion, NeighborMemoryBlock);
+
+			MemoryBlock->SizeInWords += NeighborMemoryBlock->SizeInWords + OS_MEMORY_BLOCK_HEADER_SIZE_IN_WORDS;
+		}
+
+		// merge with the block before us if it is free
+		NeighborMemoryBlock = OS_GetPreviousPhysicalMemoryBlock(HeapRegion, MemoryBlock);
+
+		if (NeighborMemoryBlock != (OS_MEMORY_BLOCK_HEADER*)NULL && NeighborMemoryBlock->Allocated == 0)
+		{
+			OS_TLSFRemoveFreeBlock(HeapRegion, NeighborMemoryBlock);
+
+			NeighborMemoryBlock->SizeInWords += MemoryBlock->SizeInWords + OS_MEMORY_BLOCK_HEADER_SIZE_IN_WORDS;
+
+			MemoryBlock = NeighborMemoryBlock;
+		}
+
+		// the block after the merged block needs to know how far back to jump now
+		if ((NeighborMemoryBlock = OS_GetNextPhysicalMemoryBlock(HeapRegion, MemoryBlock)) != (OS_MEMORY_BLOCK_HEADER*)NULL)
+			NeighborMemoryBlock->PreviousSizeInWords = MemoryBlock->SizeInWords;
+
+		OS_TLSFInsertFreeBlock(HeapRegion, MemoryBlock);
+
+		#if (USING_GET_HEAP_STATISTICS_METHOD == 1 || USING_TASK_HEAP_RECLAIM == 1)
+			gHeapModificationCount++;
+		#endif // end of #if (USING_GET_HEAP_STATISTICS_METHOD == 1 || USING_TASK_HEAP_RECLAIM == 1)
+
+		#if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1)
+			OS_CheckMemoryWarningClear();
+		#endif // end of USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1
+
+		return TRUE;
+	}
+#endif // end of #if (USING_TLSF_MEMORY_ALLOCATOR == 0)
+
+BOOL OS_InitializeHeap(void)
+{
+	memset((void*)gHeapRegions, 0, sizeof(gHeapRegions));
+
+	// the OS heap is always the first region
+	gHeapRegions[0].StartOfRegion = (OS_MEMORY_BLOCK_HEADER*)gKernelManagedMemory;
+	gHeapRegions[0].EndOfRegion = (OS_MEMORY_BLOCK_HEADER*)&gKernelManagedMemory[sizeof(gKernelManagedMemory) / OS_WORD_SIZE_IN_BYTES];
+
+	#if (USING_HEAP_REGIONS == 1)
+		gHeapRegions[OS_HEAP_REGION_ID].General = TRUE;
+
+		gHeapRegionCount = 1;
+
+		gDefaultHeapRegion = &gHeapRegions[OS_HEAP_REGION_ID];
+		gTaskStackHeapRegion = (OS_HEAP_REGION*)NULL;
+	#endif // end of #if (USING_HEAP_REGIONS == 1)
+
+	OS_InitializeHeapRegion(&gHeapRegions[0]);
+
+	#if (USING_TASK_STACK_ARENA == 1)
+		OS_InitializeTaskStackArena();
+	#endif // end of #if (USING_TASK_STACK_ARENA == 1)
+
+    #if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1)
+        gMemoryWarning = FALSE;
+    #endif // end of USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1
+
+    #if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1 || USING_GET_HEAP_USED_IN_BYTES_METHOD == 1 || USING_GET_HEAP_REMAINING_IN_BYTES_METHOD == 1)
+        gHeapUsedInBytes = 0;
+    #endif // end of #if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1 || USING_GET_HEAP_USED_IN_BYTES_METHOD == 1 || USING_GET_HEAP_REMAINING_IN_BYTES_METHOD == 1)
+
+	return TRUE;
+}
+
+static void *OS_FinishMemoryAllocation(OS_HEAP_REGION *HeapRegion, OS_MEMORY_BLOCK_HEADER *MemoryBlock)
+{
+	#if (USING_TASK_HEAP_ACCOUNTING == 1)
+		// AllocateMemory() hands the block to the calling TASK, otherwise the OS owns it
+		MemoryBlock->Owner = (void*)NULL;
+	#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
+
+	OS_AddHeapUsage(HeapRegion, (MemoryBlock->SizeInWords * OS_WORD_SIZE_IN_BYTES) + OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES);
+
+	#if (USING_GET_HEAP_STATISTICS_METHOD == 1 || USING_TASK_HEAP_RECLAIM == 1)
+		gHeapModificationCount++;
+	#endif // end of #if (USING_GET_HEAP_STATISTICS_METHOD == 1 || USING_TASK_HEAP_RECLAIM == 1)
+
+	#if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1)
+		OS_CheckMemoryWarning();
+	#endif // end of USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1
+
+	OS_TraceMemory(MEMORY_TRACE_ALLOCATE, (void*)(MemoryBlock + 1), MemoryBlock->SizeInWords * OS_WORD_SIZE_IN_BYTES);
+
+	return (void*)(MemoryBlock + 1);
+}
+
+#if (USING_REALLOC_MEMORY_METHOD == 1 || USING_ALLOCATE_ALIGNED_MEMORY_METHOD == 1)
+	/*
+		This gives the end of an allocated block back to the heap if there is room
+		for another block after RequestedSizeInWords.
+	*/
+	static void OS_SplitMemoryBlock(OS_HEAP_REGION *HeapRegion, OS_MEMORY_BLOCK_HEADER *MemoryBlock, UINT32 RequestedSizeInWords)
+	{
+		OS_MEMORY_BLOCK_HEADER *RemainingMemoryBlock, *NeighborMemoryBlock;
+
+		if (MemoryBlock->SizeInWords < (RequestedSizeInWords + OS_MEMORY_BLOCK_HEADER_SIZE_IN_WORDS + OS_MEMORY_MINIMUM_BLOCK_SIZE_IN_WORDS))
+			return;
+
+		RemainingMemoryBlock = (OS_MEMORY_BLOCK_HEADER*)((OS_WORD*)(MemoryBlock + 1) + RequestedSizeInWords);
+
+		RemainingMemoryBlock->Allocated = 0;
+		RemainingMemoryBlock->SizeInWords = MemoryBlock->SizeInWords - RequestedSizeInWords - OS_MEMORY_BLOCK_HEADER_SIZE_IN_WORDS;
+		RemainingMemoryBlock->PreviousSizeInWords = RequestedSizeInWords;
+
+		MemoryBlock->SizeInWords = RequestedSizeInWords;
+
+		// the block after us could be free too, keep the free space in one piece
+		NeighborMemoryBlock = OS_GetNextPhysicalMemoryBlock(HeapRegion, RemainingMemoryBlock);
+
+		if (NeighborMemoryBlock != (OS_MEMORY_BLOCK_HEADER*)NULL && !NeighborMemoryBlock->Allocated)
+		{
+			OS_RemoveFreeMemoryBlock(HeapRegion, NeighborMemoryBlock);
+
+			RemainingMemoryBlock->SizeInWords += NeighborMemoryBlock->SizeInWords + OS_MEMORY_BLOCK_HEADER_SIZE_IN_WORDS;
+		}
+
+		if ((NeighborMemoryBlock = OS_GetNextPhysicalMemoryBlock(HeapRegion, RemainingMemoryBlock)) != (OS_MEMORY_BLOCK_HEADER*)NULL)
+			NeighborMemoryBlock->PreviousSizeInWords = RemainingMemoryBlock->SizeInWords;
+
+		OS_InsertFreeMemoryBlock(HeapRegion, RemainingMemoryBlock);
+	}
+#endif // end of #if (USING_REALLOC_MEMORY_METHOD == 1 || USING_ALLOCATE_ALIGNED_MEMORY_METHOD == 1)
+
+#if (USING_ALLOCATE_ALIGNED_MEMORY_METHOD == 1)
+	// an aligned block keeps the alignment it was asked for in its last word, so ReallocMemory() can ask for the same again
+	#define OS_MemoryBlockAlignment(MemoryBlock)		(((OS_WORD*)((MemoryBlock) + 1))[(MemoryBlock)->SizeInWords - 1])
+
+	/*
+		This takes a block big enough to hold the request at any alignment, then turns the
+		space in front of the aligned address into a free block of its own and gives the
+		space after the request back, so nothing is wasted on padding.
+	*/
+	static OS_MEMORY_BLOCK_HEADER *OS_TakeAlignedMemoryBlock(OS_HEAP_REGION *HeapRegion, UINT32 RequestedSizeInWords, UINT32 AlignmentInBytes)
+	{
+		OS_WORD AlignedAddress;
+		UINT32 PaddingInWords;
+		OS_MEMORY_BLOCK_HEADER *MemoryBlock, *AlignedMemoryBlock, *NeighborMemoryBlock;
+
+		// every block is already word aligned
+		if (AlignmentInBytes <= OS_WORD_SIZE_IN_BYTES)
+			return OS_TakeFreeMemoryBlock(HeapRegion, RequestedSizeInWords);
+
+		// the padding has to be able to stand as a free block, so it can be up to that plus an alignment less a word
+		if ((MemoryBlock = OS_TakeFreeMemoryBlock(HeapRegion, RequestedSizeInWords + ((AlignmentInBytes + OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES) / OS_WORD_SIZE_IN_BYTES) + OS_MEMORY_MINIMUM_BLOCK_SIZE_IN_WORDS)) == (OS_MEMORY_BLOCK_HEADER*)NULL)
+			return (OS_MEMORY_BLOCK_HEADER*)NULL;
+
+		AlignedAddress = ((OS_WORD)(MemoryBlock + 1) + AlignmentInBytes - 1) & ~(OS_WORD)(AlignmentInBytes - 1);
+
+		// too little room in front for a free block, move up to the next aligned address
+		while (AlignedAddress != (OS_WORD)(MemoryBlock + 1) && AlignedAddress - (OS_WORD)(MemoryBlock + 1) < OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES + (OS_MEMORY_MINIMUM_BLOCK_SIZE_IN_WORDS * OS_WORD_SIZE_IN_BYTES))
+			AlignedAddress += AlignmentInBytes;
+
+		PaddingInWords = (UINT32)(AlignedAddress - (OS_WORD)(MemoryBlock + 1)) / OS_WORD_SIZE_IN_BYTES;
+
+		if (PaddingInWords != 0)
+		{
+			AlignedMemoryBlock = ((OS_MEMORY_BLOCK_HEADER*)AlignedAddress) - 1;
+
+			AlignedMemoryBlock->Allocated = 1;
+			AlignedMemoryBlock->SizeInWords = MemoryBlock->SizeInWords - PaddingInWords;
+			AlignedMemoryBlock->PreviousSizeInWords = PaddingInWords - OS_MEMORY_BLOCK_HEADER_SIZE_IN_WORDS;
+
+			if ((NeighborMemoryBlock = OS_GetNextPhysicalMemoryBlock(HeapRegion, AlignedMemoryBlock)) != (OS_MEMORY_BLOCK_HEADER*)NULL)
+				NeighborMemoryBlock->PreviousSizeInWords = AlignedMemoryBlock->SizeInWords;
+
+			// the block before a free block is never free, so the padding has nothing to merge with
+			MemoryBlock->Allocated = 0;
+			MemoryBlock->SizeInWords = PaddingInWords - OS_MEMORY_BLOCK_HEADER_SIZE_IN_WORDS;
+
+			OS_InsertFreeMemoryBlock(HeapRegion, MemoryBlock);
+
+			MemoryBlock = AlignedMemoryBlock;
+		}
+
+		OS_SplitMemoryBlock(HeapRegion, MemoryBlock, RequestedSizeInWords);
+
+		return MemoryBlock;
+	}
+#endif // end of #if (USING_ALLOCATE_ALIGNED_MEMORY_METHOD == 1)
+
+static void *OS_AllocateMemoryFromRegion(OS_HEAP_REGION *HeapRegion, UINT32 SizeInBytes, UINT32 AlignmentInBytes)
+{
+	UINT32 RequestedSizeInWords;
+	OS_MEMORY_BLOCK_HEADER *MemoryBlock;
+
+	if (SizeInBytes == 0 || SizeInBytes > OS_MEMORY_MAXIMUM_REQUEST_SIZE_IN_BYTES)
+		return (void*)NULL;
+
+	// first normalize the request to words, and make it a value thats word aligned
+	RequestedSizeInWords = (SizeInBytes + OS_WORD_SIZE_IN_BYTES - 1) / OS_WORD_SIZE_IN_BYTES;
+
+	#if (USING_ALLOCATE_ALIGNED_MEMORY_METHOD == 1)
+		// room for the alignment after the request
+		if (AlignmentInBytes > OS_WORD_SIZE_IN_BYTES)
+			RequestedSizeInWords++;
+	#endif // end of #if (USING_ALLOCATE_ALIGNED_MEMORY_METHOD == 1)
+
+	// with TLSF the block has to be able to hold its free list links once it is released
+	if (RequestedSizeInWords < OS_MEMORY_MINIMUM_BLOCK_SIZE_IN_WORDS)
+		RequestedSizeInWords = OS_MEMORY_MINIMUM_BLOCK_SIZE_IN_WORDS;
+
+	#if (USING_ALLOCATE_ALIGNED_MEMORY_METHOD == 1)
+		MemoryBlock = OS_TakeAlignedMemoryBlock(HeapRegion, RequestedSizeInWords, AlignmentInBytes);
+	#else
+		MemoryBlock = OS_TakeFreeMemoryBlock(HeapRegion, RequestedSizeInWords);
+	#endif // end of #if (USING_ALLOCATE_ALIGNED_MEMORY_METHOD == 1)
+
+	if (MemoryBlock == (OS_MEMORY_BLOCK_HEADER*)NULL)
+		return (void*)NULL;
+
+	MemoryBlock->Aligned = (AlignmentInBytes > OS_WORD_SIZE_IN_BYTES);
+
+	#if (USING_ALLOCATE_ALIGNED_MEMORY_METHOD == 1)
+		if (MemoryBlock->Aligned)
+			OS_MemoryBlockAlignment(MemoryBlock) = AlignmentInBytes;
+	#endif // end of #if (USING_ALLOCATE_ALIGNED_MEMORY_METHOD == 1)
+
+	return OS_FinishMemoryAllocation(HeapRegion, MemoryBlock);
+}
+
+#if (USING_HEAP_REGIONS == 1)
+	static void *OS_AllocateMemoryFromDefaultRegion(OS_HEAP_REGION *DefaultHeapRegion, UINT32 SizeInBytes, UINT32 AlignmentInBytes)
+	{
+		UINT32 i;
+		void *AllocatedMemory;
+
+		if ((AllocatedMemory = OS_AllocateMemoryFromRegion(DefaultHeapRegion, SizeInBytes, AlignmentInBytes)) != (void*)NULL)
+			return AllocatedMemory;
+
+		// fall back to the other general regions in the order they were added
+		for (i = 0; i < gHeapRegionCount; i++)
+		{
+			if (&gHeapRegions[i] == DefaultHeapRegion || gHeapRegions[i].General == FALSE)
+				continue;
+
+			if ((AllocatedMemory = OS_AllocateMemoryFromRegion(&gHeapRegions[i], SizeInBytes, AlignmentInBytes)) != (void*)NULL)
+				return AllocatedMemory;
+		}
+
+		if (SizeInBytes != 0)
+			DefaultHeapRegion->FailedAllocations++;
+
+		return (void*)NULL;
+	}
+
+	#define OS_AllocateMemoryFromHeap(SizeInBytes, AlignmentInBytes)			OS_AllocateMemoryFromDefaultRegion(gDefaultHeapRegion, SizeInBytes, AlignmentInBytes)
+#else
+	#define OS_AllocateMemoryFromHeap(SizeInBytes, AlignmentInBytes)			OS_AllocateMemoryFromRegion(&gHeapRegions[0], SizeInBytes, AlignmentInBytes)
+#endif // end of #if (USING_HEAP_REGIONS == 1)
+
+void *OS_AllocateMemory(UINT32 SizeInBytes)
+{
+	void *AllocatedMemory;
+
+	OS_SetMemoryTraceCaller();
+
+	AllocatedMemory = OS_AllocateMemoryFromHeap(SizeInBytes, OS_WORD_SIZE_IN_BYTES);
+
+	OS_ClearMemoryTraceCaller();
+
+	return AllocatedMemory;
+}
+
+void *AllocateMemoryFromISR(UINT32 SizeInBytes)
+{
+	void *AllocatedMemory;
+
+	OS_SetMemoryTraceCaller();
+
+	// an ISR is not a TASK, so the space is owned by nobody and counts against no quota
+	AllocatedMemory = OS_AllocateMemoryFromHeap(SizeInBytes, OS_WORD_SIZE_IN_BYTES);
+
+	OS_ClearMemoryTraceCaller();
+
+	return AllocatedMemory;
+}
+
+void *AllocateMemory(UINT32 SizeInBytes)
+{
+	void *AllocatedMemory;
+
+	#if (USING_TASK_HEAP_ACCOUNTING == 1)
+		TASK *Owner;
+	#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
+
+	EnterCritical();
+
+	#if (USING_TASK_HEAP_ACCOUNTING == 1)
+		Owner = OS_GetCurrentMemoryOwner();
+
+		#if (USING_TASK_HEAP_QUOTA == 1)
+			if (OS_TaskHeapQuotaAllows(Owner, ((SizeInBytes + OS_WORD_SIZE_IN_BYTES - 1) & ~(OS_WORD_SIZE_IN_BYTES - 1)) + OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES) == FALSE)
+			{
+				ExitCritical();
+
+				return (void*)NULL;
+			}
+		#endif // end of #if (USING_TASK_HEAP_QUOTA == 1)
+	#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
+
+	OS_SetMemoryTraceCaller();
+
+	AllocatedMemory = AllocateMemoryFromISR(SizeInBytes);
+
+	OS_ClearMemoryTraceCaller();
+
+	#if (USING_TASK_HEAP_ACCOUNTING == 1)
+		if (AllocatedMemory != (void*)NULL)
+			OS_SetMemoryOwner(AllocatedMemory, (void*)Owner);
+	#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
+
+	ExitCritical();
+
+	return AllocatedMemory;
+}
+
+#if (USING_ALLOCATE_ALIGNED_MEMORY_METHOD == 1)
+	void *AllocateAlignedMemoryFromISR(UINT32 SizeInBytes, UINT32 AlignmentInBytes)
+	{
+		void *AllocatedMemory;
+
+		// only a power of 2 makes sense as an alignment
+		if (AlignmentInBytes == 0 || (AlignmentInBytes & (AlignmentInBytes - 1)) != 0)
+			return (void*)NULL;
+
+		OS_SetMemoryTraceCaller();
+
+		AllocatedMemory = OS_AllocateMemoryFromHeap(SizeInBytes, AlignmentInBytes);
+
+		OS_ClearMemoryTraceCaller();
+
+		return AllocatedMemory;
+	}
+
+	void *AllocateAlignedMemory(UINT32 SizeInBytes, UINT32 AlignmentInBytes)
+	{
+		void *AllocatedMemory;
+
+		#if (USING_TASK_HEAP_ACCOUNTING == 1)
+			TASK *Owner;
+		#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
+
+		EnterCritical();
+
+		#if (USING_TASK_HEAP_ACCOUNTING == 1)
+			Owner = OS_GetCurrentMemoryOwner();
+
+			#if (USING_TASK_HEAP_QUOTA == 1)
+				// the padding goes back to the heap, so only the request counts against the quota
+				if (OS_TaskHeapQuotaAllows(Owner, ((SizeInBytes + OS_WORD_SIZE_IN_BYTES - 1) & ~(OS_WORD_SIZE_IN_BYTES - 1)) + OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES) == FALSE)
+				{
+					ExitCritical();
+
+					return (void*)NULL;
+				}
+			#endif // end of #if (USING_TASK_HEAP_QUOTA == 1)
+		#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
+
+		OS_SetMemoryTraceCaller();
+
+		AllocatedMemory = AllocateAlignedMemoryFromISR(SizeInBytes, AlignmentInBytes);
+
+		OS_ClearMemoryTraceCaller();
+
+		#if (USING_TASK_HEAP_ACCOUNTING == 1)
+			if (AllocatedMemory != (void*)NULL)
+				OS_SetMemoryOwner(AllocatedMemory, (void*)Owner);
+		#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
+
+		ExitCritical();
+
+		return AllocatedMemory;
+	}
+#endif // end of #if (USING_ALLOCATE_ALIGNED_MEMORY_METHOD == 1)
+
+void *OS_AllocateTaskStackMemory(UINT32 SizeInBytes)
+{
+	void *Stack;
+
+	EnterCritical();
+
+	#if (USING_TASK_STACK_ARENA == 1)
+		// a stack only goes in the heap once the arena is out of room
+		if ((Stack = OS_AllocateTaskStackArenaBlock(SizeInBytes)) != (void*)NULL)
+		{
+			ExitCritical();
+
+			return Stack;
+		}
+	#endif // end of #if (USING_TASK_STACK_ARENA == 1)
+
+	OS_SetMemoryTraceCaller();
+
+	#if (USING_HEAP_REGIONS == 1)
+		Stack = OS_AllocateMemoryFromDefaultRegion(gTaskStackHeapRegion != (OS_HEAP_REGION*)NULL ? gTaskStackHeapRegion : gDefaultHeapRegion, SizeInBytes, OS_WORD_SIZE_IN_BYTES);
+	#else
+		Stack = OS_AllocateMemoryFromHeap(SizeInBytes, OS_WORD_SIZE_IN_BYTES);
+	#endif // end of #if (USING_HEAP_REGIONS == 1)
+
+	OS_ClearMemoryTraceCaller();
+
+	ExitCritical();
+
+	return Stack;
+}
+
+BOOL ReleaseMemory(void *Ptr)
+{
+	BOOL ReleaseSuccessful;
+
+	EnterCritical();
+
+	OS_SetMemoryTraceCaller();
+
+	ReleaseSuccessful = OS_ReleaseMemory(Ptr);
+
+	OS_ClearMemoryTraceCaller();
+
+	ExitCritical();
+
+	return ReleaseSuccessful;
+}
+
+#if (USING_HEAP_REGIONS == 1)
+	static OS_HEAP_REGION *OS_GetHeapRegionFromID(HEAP_REGION_ID HeapRegionID)
+	{
+		if (HeapRegionID >= gHeapRegionCount)
+			return (OS_HEAP_REGION*)NULL;
+
+		return &gHeapRegions[HeapRegionID];
+	}
+
+	HEAP_REGION_ID AddHeapRegion(void *StartOfRegion, UINT32 SizeInBytes, BOOL General)
+	{
+		UINT32 i;
+		OS_WORD AlignedStartOfRegion;
+		OS_HEAP_REGION *HeapRegion;
+
+		// the regions are searched on every release, they cannot change once TASKs are running
+		if (gCPUSchedulerRunning == TRUE || gHeapRegionCount == NUMBER_OF_HEAP_REGIONS || StartOfRegion == (void*)NULL)
+			return INVALID_HEAP_REGION_ID;
+
+		AlignedStartOfRegion = ((OS_WORD)StartOfRegion + OS_WORD_SIZE_IN_BYTES - 1) & ~(OS_WORD_SIZE_IN_BYTES - 1);
+
+		if (SizeInBytes < (UINT32)(AlignedStartOfRegion - (OS_WORD)StartOfRegion))
+			return INVALID_HEAP_REGION_ID;
+
+		SizeInBytes = (SizeInBytes - (UINT32)(AlignedStartOfRegion - (OS_WORD)StartOfRegion)) & ~(OS_WORD_SIZE_IN_BYTES - 1);
+
+		// there has to be room for at least one block
+		if (SizeInBytes < OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES + (OS_MEMORY_MINIMUM_BLOCK_SIZE_IN_WORDS * OS_WORD_SIZE_IN_BYTES))
+			return INVALID_HEAP_REGION_ID;
+
+		#if (USING_TLSF_MEMORY_ALLOCATOR == 1)
+			if (SizeInBytes - OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES >= (1UL << TLSF_MAXIMUM_BLOCK_SIZE_LOG2))
+				return INVALID_HEAP_REGION_ID;
+		#endif // end of #if (USING_TLSF_MEMORY_ALLOCATOR == 1)
+
+		// a block could be merged into another region if they overlapped
+		for (i = 0; i < gHeapRegionCount; i++)
+			if (AlignedStartOfRegion < (OS_WORD)gHeapRegions[i].EndOfRegion && AlignedStartOfRegion + SizeInBytes > (OS_WORD)gHeapRegions[i].StartOfRegion)
+				return INVALID_HEAP_REGION_ID;
+
+		HeapRegion = &gHeapRegions[gHeapRegionCount];
+
+		HeapRegion->StartOfRegion = (OS_MEMORY_BLOCK_HEADER*)AlignedStartOfRegion;
+		HeapRegion->EndOfRegion = (OS_MEMORY_BLOCK_HEADER*)(AlignedStartOfRegion + SizeInBytes);
+		HeapRegion->General = General;
+
+		OS_InitializeHeapRegion(HeapRegion);
+
+		return gHeapRegionCount++;
+	}
 
-	return AllocatedMemory;
-}
+	void *AllocateMemoryFromRegionFromISR(HEAP_REGION_ID HeapRegionID, UINT32 SizeInBytes)
+	{
+		void *AllocatedMemory;
+		OS_HEAP_REGION *HeapRegion;
 
-BOOL ReleaseMemory(void *Ptr)
-{
-	BOOL ReleaseSuccessful;
+		if ((HeapRegion = OS_GetHeapRegionFromID(HeapRegionID)) == (OS_HEAP_REGION*)NULL)
+			return (void*)NULL;
 
-	EnterCritical();
+		OS_SetMemoryTraceCaller();
 
-	ReleaseSuccessful = OS_ReleaseMemory(Ptr);
+		// no falling back, the caller needs this kind of memory
+		if ((AllocatedMemory = OS_AllocateMemoryFromRegion(HeapRegion, SizeInBytes, OS_WORD_SIZE_IN_BYTES)) == (void*)NULL && SizeInBytes != 0)
+			HeapRegion->FailedAllocations++;
 
-	ExitCritical();
+		OS_ClearMemoryTraceCaller();
 
-	return ReleaseSuccessful;
-}
+		return AllocatedMemory;
+	}
+
+	void *AllocateMemoryFromRegion(HEAP_REGION_ID HeapRegionID, UINT32 SizeInBytes)
+	{
+		void *AllocatedMemory;
+
+		#if (USING_TASK_HEAP_ACCOUNTING == 1)
+			TASK *Owner;
+		#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
+
+		EnterCritical();
+
+		#if (USING_TASK_HEAP_ACCOUNTING == 1)
+			Owner = OS_GetCurrentMemoryOwner();
+
+			#if (USING_TASK_HEAP_QUOTA == 1)
+				if (OS_TaskHeapQuotaAllows(Owner, ((SizeInBytes + OS_WORD_SIZE_IN_BYTES - 1) & ~(OS_WORD_SIZE_IN_BYTES - 1)) + OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES) == FALSE)
+				{
+					ExitCritical();
+
+					return (void*)NULL;
+				}
+			#endif // end of #if (USING_TASK_HEAP_QUOTA == 1)
+		#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
+
+		OS_SetMemoryTraceCaller();
+
+		AllocatedMemory = AllocateMemoryFromRegionFromISR(HeapRegionID, SizeInBytes);
+
+		OS_ClearMemoryTraceCaller();
+
+		#if (USING_TASK_HEAP_ACCOUNTING == 1)
+			if (AllocatedMemory != (void*)NULL)
+				OS_SetMemoryOwner(AllocatedMemory, (void*)Owner);
+		#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
+
+		ExitCritical();
+
+		return AllocatedMemory;
+	}
+
+	BOOL SetDefaultHeapRegion(HEAP_REGION_ID HeapRegionID)
+	{
+		OS_HEAP_REGION *HeapRegion;
+
+		EnterCritical();
+
+		if ((HeapRegion = OS_GetHeapRegionFromID(HeapRegionID)) != (OS_HEAP_REGION*)NULL)
+			gDefaultHeapRegion = HeapRegion;
+
+		ExitCritical();
+
+		return (BOOL)(HeapRegion != (OS_HEAP_REGION*)NULL);
+	}
+
+	BOOL SetTaskStackHeapRegion(HEAP_REGION_ID HeapRegionID)
+	{
+		OS_HEAP_REGION *HeapRegion;
+
+		EnterCritical();
+
+		if ((HeapRegion = OS_GetHeapRegionFromID(HeapRegionID)) != (OS_HEAP_REGION*)NULL)
+			gTaskStackHeapRegion = HeapRegion;
+
+		ExitCritical();
+
+		return (BOOL)(HeapRegion != (OS_HEAP_REGION*)NULL);
+	}
+
+	BOOL GetHeapRegionStatistics(HEAP_REGION_ID HeapRegionID, HEAP_REGION_STATISTICS *HeapRegionStatistics)
+	{
+		OS_HEAP_REGION *HeapRegion;
+
+		if (HeapRegionStatistics == (HEAP_REGION_STATISTICS*)NULL)
+			return FALSE;
+
+		EnterCritical();
+
+		if ((HeapRegion = OS_GetHeapRegionFromID(HeapRegionID)) == (OS_HEAP_REGION*)NULL)
+		{
+			ExitCritical();
+
+			return FALSE;
+		}
+
+		HeapRegionStatistics->SizeInBytes = (UINT32)((OS_WORD)HeapRegion->EndOfRegion - (OS_WORD)(HeapRegion->StartOfRegion + 1));
+		HeapRegionStatistics->UsedInBytes = HeapRegion->UsedInBytes;
+		HeapRegionStatistics->MaximumUsedInBytes = HeapRegion->MaximumUsedInBytes;
+		HeapRegionStatistics->FailedAllocations = HeapRegion->FailedAllocations;
+
+		ExitCritical();
+
+		return TRUE;
+	}
+#endif // end of #if (USING_HEAP_REGIONS == 1)
 
 #if (USING_GET_HEAP_USED_IN_BYTES_METHOD == 1)
     UINT32 GetHeapUsedInBytes(void)
@@ -400,6 +1496,311 @@ BOOL ReleaseMemory(void *Ptr)
         return TempHeapRemaining;
     }
 #endif // end of #if (USING_GET_HEAP_REMAINING_IN_BYTES_METHOD == 1)
+
+#if (USING_GET_HEAP_STATISTICS_METHOD == 1)
+	static void OS_AddMemoryBlockToHeapStatistics(HEAP_STATISTICS *HeapStatistics, OS_MEMORY_BLOCK_HEADER *MemoryBlock)
+	{
+		UINT32 SizeInBytes, SizeClass;
+
+		if (MemoryBlock->Allocated)
+		{
+			HeapStatistics->AllocatedBlocks++;
+
+			return;
+		}
+
+		SizeInBytes = MemoryBlock->SizeInWords * OS_WORD_SIZE_IN_BYTES;
+
+		HeapStatistics->FreeBlocks++;
+		HeapStatistics->FreeBytes += SizeInBytes;
+
+		if (SizeInBytes > HeapStatistics->LargestFreeBlockInBytes)
+			HeapStatistics->LargestFreeBlockInBytes = SizeInBytes;
+
+		// class 0 is under 32 bytes, every class after that covers twice the sizes of the one before it
+		SizeInBytes >>= 5;
+
+		for (SizeClass = 0; SizeInBytes != 0 && SizeClass < (HEAP_STATISTICS_SIZE_CLASSES - 1); SizeClass++)
+			SizeInBytes >>= 1;
+
+		HeapStatistics->FreeBlockSizeClasses[SizeClass]++;
+	}
+
+	BOOL GetHeapStatistics(HEAP_STATISTICS *HeapStatistics)
+	{
+		OS_HEAP_REGION *HeapRegion = &gHeapRegions[0]; // only the OS heap
+		OS_MEMORY_BLOCK_HEADER *MemoryBlock;
+		UINT32 ModificationCount, BlocksWalked, Restarts;
+
+		if (HeapStatistics == (HEAP_STATISTICS*)NULL)
+			return FALSE;
+
+		for (Restarts = 0; Restarts <= HEAP_STATISTICS_MAXIMUM_RESTARTS; Restarts++)
+		{
+			memset(HeapStatistics, 0, sizeof(HEAP_STATISTICS));
+
+			BlocksWalked = 0;
+
+			EnterCritical();
+
+			ModificationCount = gHeapModificationCount;
+
+			MemoryBlock = HeapRegion->StartOfRegion;
+
+			while (MemoryBlock != (OS_MEMORY_BLOCK_HEADER*)NULL)
+			{
+				OS_AddMemoryBlockToHeapStatistics(HeapStatistics, MemoryBlock);
+
+				MemoryBlock = OS_GetNextPhysicalMemoryBlock(HeapRegion, MemoryBlock);
+
+				if (MemoryBlock != (OS_MEMORY_BLOCK_HEADER*)NULL && ++BlocksWalked % HEAP_STATISTICS_BLOCKS_PER_CHUNK == 0)
+				{
+					// let any interrupts or higher priority TASKs in before the next chunk
+					ExitCritical();
+
+					EnterCritical();
+
+					// if the heap changed while we were out, the block we are on may not exist anymore
+					if (ModificationCount != gHeapModificationCount)
+						break;
+				}
+			}
+
+			ExitCritical();
+
+			// did we make it to the end of the heap without it changing?
+			if (MemoryBlock == (OS_MEMORY_BLOCK_HEADER*)NULL)
+			{
+				if (HeapStatistics->FreeBytes != 0)
+					HeapStatistics->FragmentationPercent = 100 - (UINT32)(((UINT64)HeapStatistics->LargestFreeBlockInBytes * 100) / HeapStatistics->FreeBytes);
+
+				return TRUE;
+			}
+		}
+
+		return FALSE;
+	}
+#endif // end of #if (USING_GET_HEAP_STATISTICS_METHOD == 1)
+
+#if (USING_CHECK_HEAP_INTEGRITY_METHOD == 1)
+	static BOOL OS_CheckHeapRegionIntegrity(OS_HEAP_REGION *HeapRegion, UINT32 *UsedInBytes)
+	{
+		OS_MEMORY_BLOCK_HEADER *MemoryBlock = HeapRegion->StartOfRegion;
+		OS_MEMORY_BLOCK_HEADER *NextMemoryBlock;
+		UINT32 PreviousSizeInWords = 0;
+		BOOL PreviousBlockFree = FALSE;
+
+		#if (USING_TLSF_MEMORY_ALLOCATOR == 1)
+			UINT32 FreeBlocks = 0;
+			UINT32 FirstLevelIndex, SecondLevelIndex;
+			UINT32 BlockFirstLevelIndex, BlockSecondLevelIndex;
+			OS_MEMORY_BLOCK_HEADER *PreviousFreeBlock;
+		#endif // end of #if (USING_TLSF_MEMORY_ALLOCATOR == 1)
+
+		*UsedInBytes = 0;
+
+		while (MemoryBlock != (OS_MEMORY_BLOCK_HEADER*)NULL)
+		{
+			// the header and the space after it have to be inside the region
+			if ((OS_WORD*)(MemoryBlock + 1) > (OS_WORD*)HeapRegion->EndOfRegion || MemoryBlock->SizeInWords == 0 || MemoryBlock->SizeInWords > (UINT32)((OS_WORD*)HeapRegion->EndOfRegion - (OS_WORD*)(MemoryBlock + 1)))
+				return FALSE;
+
+			// the boundary tag is how a release finds the block before, it has to match
+			if (MemoryBlock->PreviousSizeInWords != PreviousSizeInWords)
+				return FALSE;
+
+			if (MemoryBlock->Allocated)
+			{
+				*UsedInBytes += (MemoryBlock->SizeInWords * OS_WORD_SIZE_IN_BYTES) + OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES;
+			}
+			else
+			{
+				// a release always merges with free neighbors, two free blocks in a row means one was missed
+				if (PreviousBlockFree == TRUE)
+					return FALSE;
+
+				#if (USING_TLSF_MEMORY_ALLOCATOR == 1)
+					FreeBlocks++;
+				#endif // end of #if (USING_TLSF_MEMORY_ALLOCATOR == 1)
+			}
+
+			PreviousBlockFree = (BOOL)(MemoryBlock->Allocated == 0);
+			PreviousSizeInWords = MemoryBlock->SizeInWords;
+
+			// the last block has to end right at the end of the region
+			if ((NextMemoryBlock = OS_GetNextPhysicalMemoryBlock(HeapRegion, MemoryBlock)) == (OS_MEMORY_BLOCK_HEADER*)NULL)
+				if ((OS_WORD*)(MemoryBlock + 1) + MemoryBlock->SizeInWords != (OS_WORD*)HeapRegion->EndOfRegion)
+					return FALSE;
+
+			MemoryBlock = NextMemoryBlock;
+		}
+
+		#if (USING_TLSF_MEMORY_ALLOCATOR == 1)
+			for (FirstLevelIndex = 0; FirstLevelIndex < TLSF_FIRST_LEVEL_INDEX_COUNT; FirstLevelIndex++)
+			{
+				// the first level bitmap says which second level bitmaps have bits set
+				if ((BOOL)((HeapRegion->FirstLevelBitmap >> FirstLevelIndex) & 1) != (BOOL)(HeapRegion->SecondLevelBitmap[FirstLevelIndex] != 0))
+					return FALSE;
+
+				for (SecondLevelIndex = 0; SecondLevelIndex < TLSF_SECOND_LEVEL_INDEX_COUNT; SecondLevelIndex++)
+				{
+					MemoryBlock = HeapRegion->FreeBlockLists[FirstLevelIndex][SecondLevelIndex];
+					PreviousFreeBlock = (OS_MEMORY_BLOCK_HEADER*)NULL;
+
+					// the second level bitmap says which lists have blocks
+					if ((BOOL)((HeapRegion->SecondLevelBitmap[FirstLevelIndex] >> SecondLevelIndex) & 1) != (BOOL)(MemoryBlock != (OS_MEMORY_BLOCK_HEADER*)NULL))
+						return FALSE;
+
+					while (MemoryBlock != (OS_MEMORY_BLOCK_HEADER*)NULL)
+					{
+						// more blocks on the lists than are free in the region means a block is on twice or a list loops
+						if (FreeBlocks == 0)
+							return FALSE;
+
+						FreeBlocks--;
+
+						if (OS_GetHeapRegion((void*)(MemoryBlock + 1)) != HeapRegion || MemoryBlock->Allocated)
+							return FALSE;
+
+						OS_TLSFGetListIndexes(MemoryBlock->SizeInWords * OS_WORD_SIZE_IN_BYTES, &BlockFirstLevelIndex, &BlockSecondLevelIndex);
+
+						if (BlockFirstLevelIndex != FirstLevelIndex || BlockSecondLevelIndex != SecondLevelIndex || OS_TLSFGetFreeBlockLinks(MemoryBlock)->PreviousFreeBlock != PreviousFreeBlock)
+							return FALSE;
+
+						PreviousFreeBlock = MemoryBlock;
+						MemoryBlock = OS_TLSFGetFreeBlockLinks(MemoryBlock)->NextFreeBlock;
+					}
+				}
+			}
+
+			// every free block has to be on a list or it can never be allocated again
+			if (FreeBlocks != 0)
+				return FALSE;
+		#endif // end of #if (USING_TLSF_MEMORY_ALLOCATOR == 1)
+
+		return TRUE;
+	}
+
+	#if (USING_TASK_STACK_ARENA == 1)
+		static BOOL OS_CheckTaskStackArenaIntegrity(void)
+		{
+			UINT32 Index, Order;
+			UINT32 FreeBlocks = 0;
+			OS_TASK_STACK_ARENA_BLOCK *Block;
+			OS_TASK_STACK_ARENA_BLOCK *PreviousBlock;
+
+			// the blocks have to cover the arena with no gaps, each one aligned to its size
+			for (Index = 0; Index < TASK_STACK_ARENA_NUMBER_OF_BLOCKS; Index += (1UL << Order))
+			{
+				if ((gTaskStackArenaBlockOrders[Index] & (TASK_STACK_ARENA_BLOCK_FREE | TASK_STACK_ARENA_BLOCK_IN_USE)) == 0)
+					return FALSE;
+
+				Order = gTaskStackArenaBlockOrders[Index] & TASK_STACK_ARENA_BLOCK_ORDER_MASK;
+
+				if (Order >= TASK_STACK_ARENA_NUMBER_OF_ORDERS || (Index & ((1UL << Order) - 1)) != 0)
+					return FALSE;
+
+				if (gTaskStackArenaBlockOrders[Index] & TASK_STACK_ARENA_BLOCK_FREE)
+					FreeBlocks++;
+			}
+
+			for (Order = 0; Order < TASK_STACK_ARENA_NUMBER_OF_ORDERS; Order++)
+			{
+				PreviousBlock = (OS_TASK_STACK_ARENA_BLOCK*)NULL;
+
+				for (Block = gTaskStackArenaFreeLists[Order]; Block != (OS_TASK_STACK_ARENA_BLOCK*)NULL; Block = Block->Next)
+				{
+					if (FreeBlocks == 0 || OS_AddressInTaskStackArena(Block) == FALSE || Block->Previous != PreviousBlock)
+						return FALSE;
+
+					FreeBlocks--;
+
+					Index = OS_GetTaskStackArenaIndex(Block);
+
+					if ((void*)OS_GetTaskStackArenaBlock(Index) != (void*)Block || gTaskStackArenaBlockOrders[Index] != (BYTE)(Order | TASK_STACK_ARENA_BLOCK_FREE))
+						return FALSE;
+
+					PreviousBlock = Block;
+				}
+			}
+
+			return (BOOL)(FreeBlocks == 0);
+		}
+	#endif // end of #if (USING_TASK_STACK_ARENA == 1)
+
+	BOOL CheckHeapIntegrity(void)
+	{
+		UINT32 i;
+		UINT32 UsedInBytes;
+		BOOL HeapIntact = TRUE;
+
+		EnterCritical();
+
+		for (i = 0; i < gHeapRegionCount && HeapIntact == TRUE; i++)
+		{
+			HeapIntact = OS_CheckHeapRegionIntegrity(&gHeapRegions[i], &UsedInBytes);
+
+			// the usage counts have to agree with what the walk found allocated
+			#if (USING_HEAP_REGIONS == 1)
+				if (UsedInBytes != gHeapRegions[i].UsedInBytes)
+					HeapIntact = FALSE;
+			#endif // end of #if (USING_HEAP_REGIONS == 1)
+
+			#if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1 || USING_GET_HEAP_USED_IN_BYTES_METHOD == 1 || USING_GET_HEAP_REMAINING_IN_BYTES_METHOD == 1)
+				if (OS_IsOSHeapRegion(&gHeapRegions[i]) && UsedInBytes != gHeapUsedInBytes)
+					HeapIntact = FALSE;
+			#endif // end of #if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1 || USING_GET_HEAP_USED_IN_BYTES_METHOD == 1 || USING_GET_HEAP_REMAINING_IN_BYTES_METHOD == 1)
+		}
+
+		#if (USING_TASK_STACK_ARENA == 1)
+			if (HeapIntact == TRUE)
+				HeapIntact = OS_CheckTaskStackArenaIntegrity();
+		#endif // end of #if (USING_TASK_STACK_ARENA == 1)
+
+		ExitCritical();
+
+		return HeapIntact;
+	}
+#endif // end of #if (USING_CHECK_HEAP_INTEGRITY_METHOD == 1)
+
+#if (USING_MEMORY_TRACE == 1)
+	UINT32 MemoryTraceRead(MEMORY_TRACE_RECORD *Records, UINT32 MaximumRecords, UINT32 *RecordsDropped)
+	{
+		UINT32 RecordsRead, OldestRecord;
+
+		if (Records == (MEMORY_TRACE_RECORD*)NULL)
+			return 0;
+
+		EnterCritical();
+
+		if (MaximumRecords > gMemoryTraceRecordCount)
+			MaximumRecords = gMemoryTraceRecordCount;
+
+		// the oldest record is the one the count reaches back to from the next one to be written
+		OldestRecord = (gMemoryTraceNextRecord + MEMORY_TRACE_SIZE_IN_RECORDS - gMemoryTraceRecordCount) % MEMORY_TRACE_SIZE_IN_RECORDS;
+
+		for (RecordsRead = 0; RecordsRead < MaximumRecords; RecordsRead++)
+		{
+			Records[RecordsRead] = gMemoryTrace[OldestRecord];
+
+			if (++OldestRecord == MEMORY_TRACE_SIZE_IN_RECORDS)
+				OldestRecord = 0;
+		}
+
+		gMemoryTraceRecordCount -= RecordsRead;
+
+		if (RecordsDropped != (UINT32*)NULL)
+		{
+			*RecordsDropped = gMemoryTraceRecordsDropped;
+
+			gMemoryTraceRecordsDropped = 0;
+		}
+
+		ExitCritical();
+
+		return RecordsRead;
+	}
+#endif // end of #if (USING_MEMORY_TRACE == 1)
     
 
 #if (USING_CALLOC_MEMORY_METHOD == 1)
@@ -413,15 +1814,33 @@ BOOL ReleaseMemory(void *Ptr)
 
 		if(SizeInBytes == 0 || NumberOfItems == 0)
 			return (void*)NULL;
+
+		// the total has to fit in a UINT32 or we would hand back a block smaller than asked for
+		if (SizeInBytes > 0xFFFFFFFF / NumberOfItems)
+			return (void*)NULL;
         
         SizeInBytes *= NumberOfItems;
 
 		if (SizeInBytes < OS_WORD_SIZE_IN_BYTES)
 			SizeInBytes = OS_WORD_SIZE_IN_BYTES;
 	
-		RequestedSizeInWords = ((SizeInBytes + (SizeInBytes % OS_WORD_SIZE_IN_BYTES)) / OS_WORD_SIZE_IN_BYTES);
+		// round up to whole words, the last word may only be partly asked for but all of it is cleared
+		RequestedSizeInWords = (SizeInBytes / OS_WORD_SIZE_IN_BYTES) + ((SizeInBytes % OS_WORD_SIZE_IN_BYTES) != 0);
 	
+		#if (USING_MEMORY_TRACE == 1)
+			// the trace should point at whoever called us, not at CallocMemory()
+			EnterCritical();
+
+			OS_SetMemoryTraceCaller();
+		#endif // end of #if (USING_MEMORY_TRACE == 1)
+
 		Data = AllocateMemory(SizeInBytes);
+
+		#if (USING_MEMORY_TRACE == 1)
+			OS_ClearMemoryTraceCaller();
+
+			ExitCritical();
+		#endif // end of #if (USING_MEMORY_TRACE == 1)
 	
 		if(Data != (void*)NULL)
 		{
@@ -438,39 +1857,241 @@ BOOL ReleaseMemory(void *Ptr)
 #endif // end of USING_CALLOC_MEMORY_METHOD
 
 #if (USING_REALLOC_MEMORY_METHOD == 1)
+	/*
+		This tries to make an allocated block hold SizeInBytes without moving it.  A shrink
+		always works, a grow only works if the block after it is free and big enough.  Any
+		space left over is split off and given back to the heap.
+	*/
+	static BOOL OS_ResizeMemory(OS_HEAP_REGION *HeapRegion, OS_MEMORY_BLOCK_HEADER *MemoryBlock, UINT32 SizeInBytes)
+	{
+		UINT32 RequestedSizeInWords, OldSizeInWords;
+		OS_MEMORY_BLOCK_HEADER *NeighborMemoryBlock;
+
+		#if (USING_ALLOCATE_ALIGNED_MEMORY_METHOD == 1)
+			UINT32 AlignmentInBytes = 0;
+		#endif // end of #if (USING_ALLOCATE_ALIGNED_MEMORY_METHOD == 1)
+
+		RequestedSizeInWords = (SizeInBytes + OS_WORD_SIZE_IN_BYTES - 1) / OS_WORD_SIZE_IN_BYTES;
+
+		#if (USING_ALLOCATE_ALIGNED_MEMORY_METHOD == 1)
+			// the alignment moves to the new end of the block
+			if (MemoryBlock->Aligned)
+			{
+				AlignmentInBytes = OS_MemoryBlockAlignment(MemoryBlock);
+
+				RequestedSizeInWords++;
+			}
+		#endif // end of #if (USING_ALLOCATE_ALIGNED_MEMORY_METHOD == 1)
+
+		if (RequestedSizeInWords < OS_MEMORY_MINIMUM_BLOCK_SIZE_IN_WORDS)
+			RequestedSizeInWords = OS_MEMORY_MINIMUM_BLOCK_SIZE_IN_WORDS;
+
+		OldSizeInWords = MemoryBlock->SizeInWords;
+
+		if (RequestedSizeInWords > OldSizeInWords)
+		{
+			// we can only grow into the block after us
+			NeighborMemoryBlock = OS_GetNextPhysicalMemoryBlock(HeapRegion, MemoryBlock);
+
+			if (NeighborMemoryBlock == (OS_MEMORY_BLOCK_HEADER*)NULL || NeighborMemoryBlock->Allocated)
+				return FALSE;
+
+			if (OldSizeInWords + OS_MEMORY_BLOCK_HEADER_SIZE_IN_WORDS + NeighborMemoryBlock->SizeInWords < RequestedSizeInWords)
+				return FALSE;
+
+			OS_RemoveFreeMemoryBlock(HeapRegion, NeighborMemoryBlock);
+
+			MemoryBlock->SizeInWords += NeighborMemoryBlock->SizeInWords + OS_MEMORY_BLOCK_HEADER_SIZE_IN_WORDS;
+
+			if ((NeighborMemoryBlock = OS_GetNextPhysicalMemoryBlock(HeapRegion, MemoryBlock)) != (OS_MEMORY_BLOCK_HEADER*)NULL)
+				NeighborMemoryBlock->PreviousSizeInWords = MemoryBlock->SizeInWords;
+		}
+
+		// give back whatever we don't need if there is room for another block
+		OS_SplitMemoryBlock(HeapRegion, MemoryBlock, RequestedSizeInWords);
+
+		#if (USING_ALLOCATE_ALIGNED_MEMORY_METHOD == 1)
+			if (MemoryBlock->Aligned)
+				OS_MemoryBlockAlignment(MemoryBlock) = AlignmentInBytes;
+		#endif // end of #if (USING_ALLOCATE_ALIGNED_MEMORY_METHOD == 1)
+
+		OS_RemoveHeapUsage(HeapRegion, OldSizeInWords * OS_WORD_SIZE_IN_BYTES);
+		OS_AddHeapUsage(HeapRegion, MemoryBlock->SizeInWords * OS_WORD_SIZE_IN_BYTES);
+
+		#if (USING_TASK_HEAP_ACCOUNTING == 1)
+			OS_RemoveTaskHeapUsage((TASK*)MemoryBlock->Owner, OldSizeInWords * OS_WORD_SIZE_IN_BYTES);
+			OS_AddTaskHeapUsage((TASK*)MemoryBlock->Owner, MemoryBlock->SizeInWords * OS_WORD_SIZE_IN_BYTES);
+		#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
+
+		OS_TraceMemory(MEMORY_TRACE_RESIZE, (void*)(MemoryBlock + 1), MemoryBlock->SizeInWords * OS_WORD_SIZE_IN_BYTES);
+
+		#if (USING_GET_HEAP_STATISTICS_METHOD == 1 || USING_TASK_HEAP_RECLAIM == 1)
+			gHeapModificationCount++;
+		#endif // end of #if (USING_GET_HEAP_STATISTICS_METHOD == 1 || USING_TASK_HEAP_RECLAIM == 1)
+
+		#if (USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1)
+			if (MemoryBlock->SizeInWords > OldSizeInWords)
+				OS_CheckMemoryWarning();
+			else
+				OS_CheckMemoryWarningClear();
+		#endif // end of USING_MEMORY_WARNING_EVENT == 1 || USING_MEMORY_WARNING_USER_CALLBACK == 1
+
+		return TRUE;
+	}
+
     void *ReallocMemory(void *Ptr, UINT32 SizeInBytes)
 	{
 		void *Data;
+		UINT32 OldSizeInBytes;
+		UINT32 AlignmentInBytes = OS_WORD_SIZE_IN_BYTES;
+		OS_HEAP_REGION *HeapRegion = (OS_HEAP_REGION*)NULL;
+		OS_MEMORY_BLOCK_HEADER *MemoryBlock;
 
 		if (Ptr != (void*)NULL)
-			if (AddressInHeap((OS_WORD)Ptr) == FALSE)
+			if ((HeapRegion = OS_GetHeapRegion(Ptr)) == (OS_HEAP_REGION*)NULL)
 				return (void*)NULL;
 
-		if (SizeInBytes == 0)
+		if (SizeInBytes == 0 || SizeInBytes > OS_MEMORY_MAXIMUM_REQUEST_SIZE_IN_BYTES)
 			return (void*)NULL;
 
-		Data = AllocateMemory(SizeInBytes);
+		if (Ptr == (void*)NULL)
+			return AllocateMemory(SizeInBytes);
+
+		MemoryBlock = ((OS_MEMORY_BLOCK_HEADER*)Ptr) - 1;
+
+		EnterCritical();
+
+		// it has to be something we handed out
+		if (!MemoryBlock->Allocated)
+		{
+			ExitCritical();
 
-		if (Data == (void*)NULL)
 			return (void*)NULL;
+		}
 
-		// if they passed in a valid pointer to the heap,
-		// just go ahead and copy the data over and then
-		// free the previous data.
-		if (Ptr != (void*)NULL)
+		OldSizeInBytes = MemoryBlock->SizeInWords * OS_WORD_SIZE_IN_BYTES;
+
+		#if (USING_TASK_HEAP_QUOTA == 1)
+			// the block stays with its owner, so the owner has to have room for it to grow
+			if (SizeInBytes > OldSizeInBytes)
+			{
+				if (OS_TaskHeapQuotaAllows((TASK*)MemoryBlock->Owner, ((SizeInBytes + OS_WORD_SIZE_IN_BYTES - 1) & ~(OS_WORD_SIZE_IN_BYTES - 1)) - OldSizeInBytes) == FALSE)
+				{
+					ExitCritical();
+
+					return (void*)NULL;
+				}
+			}
+		#endif // end of #if (USING_TASK_HEAP_QUOTA == 1)
+
+		OS_SetMemoryTraceCaller();
+
+		// first see if the block can just change size where it is
+		if (OS_ResizeMemory(HeapRegion, MemoryBlock, SizeInBytes) == TRUE)
 		{
-			memcpy(Data, Ptr, SizeInBytes);
+			OS_ClearMemoryTraceCaller();
+
+			ExitCritical();
 
-			ReleaseMemory(Ptr);
+			return Ptr;
 		}
+
+		#if (USING_ALLOCATE_ALIGNED_MEMORY_METHOD == 1)
+			// the new block gets the alignment the old one was asked for
+			if (MemoryBlock->Aligned)
+				AlignmentInBytes = OS_MemoryBlockAlignment(MemoryBlock);
+		#endif // end of #if (USING_ALLOCATE_ALIGNED_MEMORY_METHOD == 1)
+
+		// we only get here on a grow, so the old block is the smaller of the two, and it stays in the same kind of memory
+		Data = OS_AllocateMemoryFromRegion(HeapRegion, SizeInBytes, AlignmentInBytes);
+
+		OS_ClearMemoryTraceCaller();
+
+		#if (USING_TASK_HEAP_ACCOUNTING == 1)
+			if (Data != (void*)NULL)
+				OS_SetMemoryOwner(Data, MemoryBlock->Owner);
+		#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
+
+		ExitCritical();
+
+		if (Data == (void*)NULL)
+			return (void*)NULL;
+
+		// the caller still owns both blocks so the copy can be done outside of the critical section
+		memcpy(Data, Ptr, OldSizeInBytes);
+
+		ReleaseMemory(Ptr);
 	
 		return Data;
 	}
 #endif // end of USING_REALLOC_MEMORY_METHOD
 
+#if (USING_TASK_HEAP_RECLAIM == 1)
+	void OS_ReleaseTaskMemory(void *Owner)
+	{
+		UINT32 i;
+		UINT32 ModificationCount, BlocksWalked;
+		UINT32 Restarts = 0;
+		OS_HEAP_REGION *HeapRegion;
+		OS_MEMORY_BLOCK_HEADER *MemoryBlock;
+		OS_MEMORY_BLOCK_HEADER *PreviousMemoryBlock;
+
+		EnterCritical();
+
+		for (i = 0; i < gHeapRegionCount; i++)
+		{
+			HeapRegion = &gHeapRegions[i];
+
+			BlocksWalked = 0;
+
+			MemoryBlock = HeapRegion->StartOfRegion;
+
+			while (MemoryBlock != (OS_MEMORY_BLOCK_HEADER*)NULL)
+			{
+				if (MemoryBlock->Allocated && MemoryBlock->Owner == Owner)
+				{
+					PreviousMemoryBlock = OS_GetPreviousPhysicalMemoryBlock(HeapRegion, MemoryBlock);
+
+					OS_ReleaseMemory((void*)(MemoryBlock + 1));
+
+					// if it merged into the block before it, that is where the free space starts now
+					if (PreviousMemoryBlock != (OS_MEMORY_BLOCK_HEADER*)NULL && !PreviousMemoryBlock->Allocated)
+						MemoryBlock = PreviousMemoryBlock;
+				}
+
+				MemoryBlock = OS_GetNextPhysicalMemoryBlock(HeapRegion, MemoryBlock);
+
+				// once it has restarted too often the rest of the heap is walked in one go so the reclaim always finishes
+				if (MemoryBlock != (OS_MEMORY_BLOCK_HEADER*)NULL && Restarts < TASK_HEAP_RECLAIM_MAXIMUM_RESTARTS && ++BlocksWalked % TASK_HEAP_RECLAIM_BLOCKS_PER_CHUNK == 0)
+				{
+					// our own releases changed the heap too, only what changes while we are out matters
+					ModificationCount = gHeapModificationCount;
+
+					// let any interrupts or higher priority TASKs in before the next chunk
+					ExitCritical();
+
+					EnterCritical();
+
+					// the block we are on may have been merged away, the blocks already released will not be found again
+					if (ModificationCount != gHeapModificationCount)
+					{
+						MemoryBlock = HeapRegion->StartOfRegion;
+
+						BlocksWalked = 0;
+
+						Restarts++;
+					}
+				}
+			}
+		}
+
+		ExitCritical();
+	}
+#endif // end of #if (USING_TASK_HEAP_RECLAIM == 1)
+
 BOOL AddressInHeap(OS_WORD Address)
 {
-	return (BOOL)(Address >= (OS_WORD)gKernelManagedMemory && Address <= ((OS_WORD)gKernelManagedMemory + sizeof(gKernelManagedMemory)));
+	return (BOOL)(OS_GetHeapRegion((void*)Address) != (OS_HEAP_REGION*)NULL);
 }
 
 BOOL ProgramAddressValid(OS_WORD ProgramAddress)
@@ -44,10 +44,59 @@
 
 typedef struct
 {
-	unsigned long SizeInWords: 31;
+	unsigned long SizeInWords: 30;
 	unsigned int Allocated: 1;
+	unsigned int Aligned: 1; // set if the block came from AllocateAlignedMemory(), so ReallocMemory() keeps it aligned
+	UINT32 PreviousSizeInWords; // size of the block physically before this one so it can be merged without walking the heap, 0 for the first block
+
+	#if (USING_TASK_HEAP_ACCOUNTING == 1)
+		void *Owner; // the TASK which allocated the block, NULL if the OS allocated it for itself
+	#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
 }OS_MEMORY_BLOCK_HEADER;
 
+#if (USING_GET_HEAP_STATISTICS_METHOD == 1)
+	typedef struct
+	{
+		UINT32 FreeBytes; // the space free in the heap, not counting memory headers
+		UINT32 LargestFreeBlockInBytes; // the biggest allocation that could succeed right now
+		UINT32 FreeBlocks;
+		UINT32 AllocatedBlocks;
+		UINT32 FragmentationPercent; // 0 if all free space is in one block, approaching 100 as it is split up
+		UINT32 FreeBlockSizeClasses[HEAP_STATISTICS_SIZE_CLASSES]; // free blocks under 32 bytes, then 32 to 63, 64 to 127 and so on
+	}HEAP_STATISTICS;
+#endif // end of #if (USING_GET_HEAP_STATISTICS_METHOD == 1)
+
+#if (USING_MEMORY_TRACE == 1)
+	#define MEMORY_TRACE_ALLOCATE				'A'
+	#define MEMORY_TRACE_RELEASE				'R'
+	#define MEMORY_TRACE_RESIZE					'S' // ReallocMemory() changed the size of a block without moving it
+
+	typedef struct
+	{
+		UINT32 OSTickCount;
+		void *Task; // the TASK running when the heap was called, NULL before the scheduler starts
+		void *Caller; // the return address into the code which called the heap
+		void *Ptr;
+		UINT32 SizeInBytes; // the size of the block, not counting its memory header
+		BYTE Type;
+	}MEMORY_TRACE_RECORD;
+#endif // end of #if (USING_MEMORY_TRACE == 1)
+
+#if (USING_HEAP_REGIONS == 1)
+	#define OS_HEAP_REGION_ID					0 // the OS heap, always there
+	#define INVALID_HEAP_REGION_ID				0xFFFFFFFF
+
+	typedef UINT32 HEAP_REGION_ID;
+
+	typedef struct
+	{
+		UINT32 SizeInBytes; // the space in the region that can be allocated, after the first memory header
+		UINT32 UsedInBytes; // inclusive of the memory headers, like GetHeapUsedInBytes()
+		UINT32 MaximumUsedInBytes;
+		UINT32 FailedAllocations; // requests aimed at this region that could not be met from it or any region it falls back to
+	}HEAP_REGION_STATISTICS;
+#endif // end of #if (USING_HEAP_REGIONS == 1)
+
 /*
 	BOOL OS_InitializeHeap(void)
 
@@ -78,7 +127,8 @@ BOOL OS_InitializeHeap(void);
 	Description: This method allocates space in the heap and returns a pointer to the
 	newly allocated space.  The allocated space is left uninitialized.  This method
 	uses a first fit algorithm.  Meaning the first area of memory which is big enough
-	to fulfill the request will be used.
+	to fulfill the request will be used.  If USING_TLSF_MEMORY_ALLOCATOR is a 1 a two
+	level segregated fit algorithm is used instead, which finds a free area in constant time.
 
 	Blocking: No
 
@@ -125,6 +175,63 @@ void *OS_AllocateMemory(UINT32 SizeInBytes);
 */
 BOOL OS_ReleaseMemory(void *Ptr);
 
+/*
+	void OS_SetMemoryOwner(void *Ptr, void *Owner)
+
+	Description: This method hands an allocated area in the heap over to another
+	TASK, moving its size from the old owner's heap usage to the new owner's.
+
+	Blocking: No
+
+	User Callable: No
+
+	Arguments:
+		void *Ptr - A pointer to an area in the heap previous allocated by AllocateMemory().
+
+		void *Owner - The TASK which now owns the area, or NULL if the OS owns it.
+
+	Returns:
+		None
+
+	Notes:
+		- USING_TASK_HEAP_ACCOUNTING inside of RTOSConfig.h must
+          be defined as a 1 to use this method.
+
+	See Also:
+		- OS_ReleaseTaskMemory()
+*/
+void OS_SetMemoryOwner(void *Ptr, void *Owner);
+
+/*
+	void OS_ReleaseTaskMemory(void *Owner)
+
+	Description: This method releases every area in the heap owned by a TASK.
+
+	Blocking: No
+
+	User Callable: No
+
+	Arguments:
+		void *Owner - The TASK whose memory is being released.
+
+	Returns:
+		None
+
+	Notes:
+		- USING_TASK_HEAP_RECLAIM inside of RTOSConfig.h must
+          be defined as a 1 to use this method.
+
+		- This walks the whole heap TASK_HEAP_RECLAIM_BLOCKS_PER_CHUNK blocks at a time,
+		  leaving the critical section between each chunk.  It must not be called from
+		  inside of a critical section, or interrupts stay off for the whole walk.
+		- Every block the TASK allocated is released, even ones it handed to an ISR or
+		  another TASK.
+
+	See Also:
+		- OS_SetMemoryOwner()
+*/
+void OS_ReleaseTaskMemory(void *Owner);
+
 /*
 	UINT32 GetHeapUsedInBytes(void)
 
@@ -144,6 +251,7 @@ BOOL OS_ReleaseMemory(void *Ptr);
 	Notes:
 		- USING_GET_HEAP_USED_IN_BYTES_METHOD inside of RTOSConfig.h must
           be defined as a 1 to use this method.
+		- Only the OS heap is counted, see GetHeapRegionStatistics() for other regions.
 
 	See Also:
 		- ReleaseMemory()
@@ -174,13 +282,340 @@ UINT32 GetHeapUsedInBytes(void);
 */
 UINT32 GetHeapRemainingInBytes(void);
 
+/*
+	BOOL GetHeapStatistics(HEAP_STATISTICS *HeapStatistics)
+
+	Description: This method walks the heap and reports how the free space in it is
+	laid out.  The bytes remaining in the heap do not say if an allocation will succeed,
+	the largest free block does.  The heap is walked HEAP_STATISTICS_BLOCKS_PER_CHUNK
+	blocks at a time, with interrupts and other TASKs allowed to run between each chunk.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		HEAP_STATISTICS *HeapStatistics - A pointer to where the statistics will be stored.
+
+	Returns: 
+		BOOL - TRUE if the statistics were filled in, FALSE otherwise.
+
+	Notes:
+		- USING_GET_HEAP_STATISTICS_METHOD inside of RTOSConfig.h must
+          be defined as a 1 to use this method.
+		- If the heap is changed while it is being walked, the walk is started over.
+		  FALSE is returned if the heap changed HEAP_STATISTICS_MAXIMUM_RESTARTS times
+		  in a row.
+		- FragmentationPercent is 100 minus the largest free block as a percentage
+		  of all the free space.
+		- Only the OS heap is walked, not any regions added with AddHeapRegion().
+
+	See Also:
+		- GetHeapRemainingInBytes(), AllocateMemory()
+*/
+#if (USING_GET_HEAP_STATISTICS_METHOD == 1)
+	BOOL GetHeapStatistics(HEAP_STATISTICS *HeapStatistics);
+#endif // end of #if (USING_GET_HEAP_STATISTICS_METHOD == 1)
+
+/*
+	BOOL CheckHeapIntegrity(void)
+
+	Description: This method walks every block of every heap region and checks the
+	heap is not corrupted.  Each block has to fit inside its region and agree with the
+	boundary tag of the block after it, no two free blocks can be next to each other
+	and the bytes allocated have to match the heap used counts.  With the TLSF allocator
+	every free block has to be on the right free list and the bitmaps have to match the
+	lists.  The TASK stack arena is checked as well if it is used.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		None
+
+	Returns: 
+		BOOL - TRUE if the heap is intact, FALSE if any check failed.
+
+	Notes:
+		- USING_CHECK_HEAP_INTEGRITY_METHOD inside of RTOSConfig.h must
+          be defined as a 1 to use this method.
+		- The whole heap is walked inside of a critical section, so this is meant for
+		  debugging.  Memory.c only needs EnterCritical() and ExitCritical() stubbed
+		  out to be built on a PC, where this can be called after every allocation and
+		  release of a random test to catch the first one that corrupts the heap.
+
+	See Also:
+		- GetHeapStatistics(), ReleaseMemory()
+*/
+#if (USING_CHECK_HEAP_INTEGRITY_METHOD == 1)
+	BOOL CheckHeapIntegrity(void);
+#endif // end of #if (USING_CHECK_HEAP_INTEGRITY_METHOD == 1)
+
+/*
+	UINT32 MemoryTraceRead(MEMORY_TRACE_RECORD *Records, UINT32 MaximumRecords, UINT32 *RecordsDropped)
+
+	Description: This method takes the oldest records out of the memory trace ring
+	buffer.  Records which are read are removed, so calling this periodically gives
+	every allocation and release the heap has done.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		MEMORY_TRACE_RECORD *Records - Where to copy the records to.
+
+		UINT32 MaximumRecords - The most records to copy into Records.
+
+		UINT32 *RecordsDropped - This is an optional parameter.  If specified the
+		number of records that were dropped because the ring buffer was full since
+		the last call is stored here.
+
+	Returns: 
+		UINT32 - The number of records copied into Records.
+
+	Notes:
+		- USING_MEMORY_TRACE inside of RTOSConfig.h must be defined as a 1 to use
+		  this method.
+		- Interrupts are held off while the records are copied, keep MaximumRecords small.
+
+	See Also:
+		- IOBufferWriteMemoryTrace()
+*/
+#if (USING_MEMORY_TRACE == 1)
+	UINT32 MemoryTraceRead(MEMORY_TRACE_RECORD *Records, UINT32 MaximumRecords, UINT32 *RecordsDropped);
+#endif // end of #if (USING_MEMORY_TRACE == 1)
+
+/*
+	HEAP_REGION_ID AddHeapRegion(void *StartOfRegion, UINT32 SizeInBytes, BOOL General)
+
+	Description: This method hands an area of RAM over to the OS to be managed as
+	another heap.  Blocks are never split or merged across regions, so memory in one
+	region cannot fragment another.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		void *StartOfRegion - The start of the RAM, like an uncached KSEG1 address
+		for DMA buffers or the start of external RAM.  This is rounded up to a word.
+
+		UINT32 SizeInBytes - The size of the RAM in bytes.  This is rounded down to a
+		word once StartOfRegion has been aligned.
+
+		BOOL General - TRUE if AllocateMemory() can fall back to this region when the
+		default region is full.  FALSE if only AllocateMemoryFromRegion() can use it.
+
+	Returns: 
+		HEAP_REGION_ID - The ID of the new region, INVALID_HEAP_REGION_ID if there are
+		already NUMBER_OF_HEAP_REGIONS regions, the OS was already started or the RAM
+		was too small.
+
+	Notes:
+		- USING_HEAP_REGIONS inside of RTOSConfig.h must be defined as a 1 to use
+		  this method.
+		- Call this after InitOS() and before StartOS().
+		- With the TLSF allocator the region must be smaller than 2 raised to
+		  TLSF_MAXIMUM_BLOCK_SIZE_LOG2.
+
+	See Also:
+		- AllocateMemoryFromRegion(), SetDefaultHeapRegion()
+*/
+#if (USING_HEAP_REGIONS == 1)
+	HEAP_REGION_ID AddHeapRegion(void *StartOfRegion, UINT32 SizeInBytes, BOOL General);
+#endif // end of #if (USING_HEAP_REGIONS == 1)
+
+/*
+	void *AllocateMemoryFromRegion(HEAP_REGION_ID HeapRegionID, UINT32 SizeInBytes)
+
+	Description: This method allocates space in one heap region only.  Use this for
+	memory which has to be in a certain kind of RAM, like DMA buffers.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		HEAP_REGION_ID HeapRegionID - The region to allocate from.
+
+		UINT32 SizeInBytes - The number of bytes to allocate.  This number will be
+		rounded up to be evenly divisible by sizeof(OS_WORD).
+
+	Returns: 
+		void * - A void pointer to the newly allocated space upon success.  If the
+		space was not available in the region a (void*)NULL pointer is returned.
+
+	Notes:
+		- USING_HEAP_REGIONS inside of RTOSConfig.h must be defined as a 1 to use
+		  this method.
+		- Release the memory with ReleaseMemory(), ReallocMemory() keeps it in the
+		  same region.
+
+	See Also:
+		- AddHeapRegion(), AllocateMemory(), AllocateMemoryFromRegionFromISR()
+*/
+#if (USING_HEAP_REGIONS == 1)
+	void *AllocateMemoryFromRegion(HEAP_REGION_ID HeapRegionID, UINT32 SizeInBytes);
+#endif // end of #if (USING_HEAP_REGIONS == 1)
+
+/*
+	void *AllocateMemoryFromRegionFromISR(HEAP_REGION_ID HeapRegionID, UINT32 SizeInBytes)
+
+	Description: This method allocates space in one heap region only from an ISR.  It
+	works like AllocateMemoryFromRegion(), except the space is not owned by any TASK.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		HEAP_REGION_ID HeapRegionID - The region to allocate from.
+
+		UINT32 SizeInBytes - The number of bytes to allocate.  This number will be
+		rounded up to be evenly divisible by sizeof(OS_WORD).
+
+	Returns: 
+		void * - A void pointer to the newly allocated space upon success.  If the
+		space was not available in the region a (void*)NULL pointer is returned.
+
+	Notes:
+		- USING_HEAP_REGIONS inside of RTOSConfig.h must be defined as a 1 to use
+		  this method.
+		- This should only be called from an ISR or inside of a critical section.
+
+	See Also:
+		- AllocateMemoryFromRegion(), AllocateMemoryFromISR()
+*/
+#if (USING_HEAP_REGIONS == 1)
+	void *AllocateMemoryFromRegionFromISR(HEAP_REGION_ID HeapRegionID, UINT32 SizeInBytes);
+#endif // end of #if (USING_HEAP_REGIONS == 1)
+
+/*
+	BOOL SetDefaultHeapRegion(HEAP_REGION_ID HeapRegionID)
+
+	Description: This method picks the region AllocateMemory() tries first.  If the
+	default region is full the other general regions are tried in the order they
+	were added, the OS heap first.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		HEAP_REGION_ID HeapRegionID - The region to try first.
+
+	Returns: 
+		BOOL - TRUE if the default region was changed, FALSE if the region does not exist.
+
+	Notes:
+		- USING_HEAP_REGIONS inside of RTOSConfig.h must be defined as a 1 to use
+		  this method.
+		- The default region is OS_HEAP_REGION_ID until this is called.
+
+	See Also:
+		- AllocateMemory(), SetTaskStackHeapRegion()
+*/
+#if (USING_HEAP_REGIONS == 1)
+	BOOL SetDefaultHeapRegion(HEAP_REGION_ID HeapRegionID);
+#endif // end of #if (USING_HEAP_REGIONS == 1)
+
+/*
+	BOOL SetTaskStackHeapRegion(HEAP_REGION_ID HeapRegionID)
+
+	Description: This method picks the region the stacks of TASKs created from now on
+	are allocated from, like a small region of fast RAM.  If the region is full the
+	stack falls back to the general regions.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		HEAP_REGION_ID HeapRegionID - The region to put TASK stacks in.
+
+	Returns: 
+		BOOL - TRUE if the stack region was changed, FALSE if the region does not exist.
+
+	Notes:
+		- USING_HEAP_REGIONS inside of RTOSConfig.h must be defined as a 1 to use
+		  this method.
+		- TASK stacks follow the default region until this is called.
+
+	See Also:
+		- SetDefaultHeapRegion(), CreateTask()
+*/
+#if (USING_HEAP_REGIONS == 1)
+	BOOL SetTaskStackHeapRegion(HEAP_REGION_ID HeapRegionID);
+#endif // end of #if (USING_HEAP_REGIONS == 1)
+
+/*
+	void *OS_AllocateTaskStackMemory(UINT32 SizeInBytes)
+
+	Description: This method allocates the stack of a TASK.  The stack comes from the
+	TASK stack arena if there is one and it has room, otherwise from the region picked
+	with SetTaskStackHeapRegion(), falling back to the general regions.  The stack is
+	not counted against any TASK.
+
+	Blocking: No
+
+	User Callable: No
+
+	Arguments:
+		UINT32 SizeInBytes - The size of the stack in bytes.
+
+	Returns: 
+		void * - A void pointer to the stack upon success, (void*)NULL otherwise.
+
+	Notes:
+		- USING_TASK_STACK_ARENA inside of RTOSConfig.h must be defined as a 1 to
+		  use the TASK stack arena.
+		- OS_ReleaseMemory() hands a stack from the arena back to the arena.
+
+	See Also:
+		- SetTaskStackHeapRegion(), OS_ReleaseMemory()
+*/
+void *OS_AllocateTaskStackMemory(UINT32 SizeInBytes);
+
+/*
+	BOOL GetHeapRegionStatistics(HEAP_REGION_ID HeapRegionID, HEAP_REGION_STATISTICS *HeapRegionStatistics)
+
+	Description: This method returns how much of a heap region is in use, the most
+	that has ever been in use and how many allocations aimed at it failed.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		HEAP_REGION_ID HeapRegionID - The region to get the statistics of.
+
+		HEAP_REGION_STATISTICS *HeapRegionStatistics - Where to store the statistics.
+
+	Returns: 
+		BOOL - TRUE if the statistics were filled in, FALSE if the region does not exist.
+
+	Notes:
+		- USING_HEAP_REGIONS inside of RTOSConfig.h must be defined as a 1 to use
+		  this method.
+		- Unlike GetHeapStatistics() this does not walk the region.
+
+	See Also:
+		- GetHeapStatistics(), GetHeapUsedInBytes()
+*/
+#if (USING_HEAP_REGIONS == 1)
+	BOOL GetHeapRegionStatistics(HEAP_REGION_ID HeapRegionID, HEAP_REGION_STATISTICS *HeapRegionStatistics);
+#endif // end of #if (USING_HEAP_REGIONS == 1)
+
 /*
 	void *AllocateMemory(UINT32 SizeInBytes)
 
 	Description: This method allocates space in the heap and returns a pointer to the
 	newly allocated space.  The allocated space is left uninitialized.  This method 
 	uses a first fit algorithm.  Meaning the first area of memory which is big enough
-	to fulfill the request will be used.
+	to fulfill the request will be used.  If USING_TLSF_MEMORY_ALLOCATOR is a 1 a two
+	level segregated fit algorithm is used instead, which finds a free area in constant time.
 
 	Blocking: No
 
@@ -195,13 +630,115 @@ UINT32 GetHeapRemainingInBytes(void);
 		was not available a (void*)NULL pointer is returned.
 
 	Notes:
-		- None
+		- If USING_TASK_HEAP_ACCOUNTING is a 1 the space is owned by the calling TASK.  If
+		  USING_TASK_HEAP_QUOTA is a 1 and the space would put the calling TASK over its
+		  quota, (void*)NULL is returned.
+		- If USING_HEAP_REGIONS is a 1 the default region is tried first, then every
+		  other general region.
+		- From an ISR use AllocateMemoryFromISR(), otherwise the space is owned by
+		  whichever TASK was interrupted.
 
 	See Also:
-		- ReleaseMemory()
+		- ReleaseMemory(), TaskSetHeapQuota(), AllocateMemoryFromRegion(), AllocateMemoryFromISR()
 */
 void *AllocateMemory(UINT32 SizeInBytes);
 
+/*
+	void *AllocateMemoryFromISR(UINT32 SizeInBytes)
+
+	Description: This method allocates space in the heap from an ISR.  It works like
+	AllocateMemory(), except the space is not owned by any TASK.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		UINT32 SizeInBytes - The number of bytes to allocate in the heap.  This number 
+		will be rounded up to be evenly divisible by sizeof(OS_WORD).
+
+	Returns: 
+		void * - A void pointer to the newly allocated space upon success.  If the space
+		was not available a (void*)NULL pointer is returned.
+
+	Notes:
+		- This should only be called from an ISR or inside of a critical section.
+		- The space counts against no TASK's quota and is never reclaimed when a TASK
+		  is deleted or restarted.
+
+	See Also:
+		- AllocateMemory(), ReleaseMemory()
+*/
+void *AllocateMemoryFromISR(UINT32 SizeInBytes);
+
+/*
+	void *AllocateAlignedMemory(UINT32 SizeInBytes, UINT32 AlignmentInBytes)
+
+	Description: This method allocates space in the heap which starts on a multiple of
+	AlignmentInBytes, like a cache line for a DMA buffer.  The space skipped to reach the
+	alignment is made into a free block of its own, so it can still be allocated.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		UINT32 SizeInBytes - The number of bytes to allocate in the heap.  This number 
+		will be rounded up to be evenly divisible by sizeof(OS_WORD).
+
+		UINT32 AlignmentInBytes - The alignment of the space.  This must be a power of 2.
+
+	Returns: 
+		void * - A void pointer to the newly allocated space upon success.  If the space
+		was not available or AlignmentInBytes is not a power of 2 a (void*)NULL pointer
+		is returned.
+
+	Notes:
+		- USING_ALLOCATE_ALIGNED_MEMORY_METHOD inside of RTOSConfig.h must
+          be defined as a 1 to use this method.
+		- Release the space with ReleaseMemory().
+		- The heap needs a free block big enough for the request plus AlignmentInBytes
+		  and a memory header, even though all but the request is given back.
+		- One more word is taken after the request to keep AlignmentInBytes in.  If
+		  ReallocMemory() has to move the space to grow it, the new space gets the same
+		  alignment.
+
+	See Also:
+		- AllocateMemory(), ReleaseMemory(), AllocateAlignedMemoryFromISR()
+*/
+void *AllocateAlignedMemory(UINT32 SizeInBytes, UINT32 AlignmentInBytes);
+
+/*
+	void *AllocateAlignedMemoryFromISR(UINT32 SizeInBytes, UINT32 AlignmentInBytes)
+
+	Description: This method allocates aligned space in the heap from an ISR.  It works
+	like AllocateAlignedMemory(), except the space is not owned by any TASK.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		UINT32 SizeInBytes - The number of bytes to allocate in the heap.  This number 
+		will be rounded up to be evenly divisible by sizeof(OS_WORD).
+
+		UINT32 AlignmentInBytes - The alignment of the space.  This must be a power of 2.
+
+	Returns: 
+		void * - A void pointer to the newly allocated space upon success.  If the space
+		was not available or AlignmentInBytes is not a power of 2 a (void*)NULL pointer
+		is returned.
+
+	Notes:
+		- USING_ALLOCATE_ALIGNED_MEMORY_METHOD inside of RTOSConfig.h must
+          be defined as a 1 to use this method.
+		- This should only be called from an ISR or inside of a critical section.
+
+	See Also:
+		- AllocateAlignedMemory(), AllocateMemoryFromISR()
+*/
+void *AllocateAlignedMemoryFromISR(UINT32 SizeInBytes, UINT32 AlignmentInBytes);
+
 /*
 	BOOL ReleaseMemory(void *Ptr)
 
@@ -247,7 +784,8 @@ BOOL ReleaseMemory(void *Ptr);
 
 	Returns: 
 		void * - A void pointer to the newly allocated space upon success.  If the space
-		was not availble a (void*)NULL pointer is returned.
+		was not availble, or NumberOfItems * SizeInBytes does not fit in a UINT32, a
+		(void*)NULL pointer is returned.
 
 	Notes: 
 		- USING_CALLOC_MEMORY_METHOD inside of RTOSConfig.h must be defined as 1 to
@@ -261,9 +799,10 @@ void *CallocMemory(UINT32 NumberOfItems, UINT32 SizeInBytes);
 /*
 	void *ReallocMemory(void *Ptr, UINT32 SizeInBytes)
 
-	Description: This method will first attempt to allocate SizeInBytes space in the
-	heap.  Then if Ptr is not NULL it will copy the data located at Ptr to the newly
-	allocated area and then called ReleaseMemory(Ptr).
+	Description: This method changes the size of a block in the heap.  The block is
+	first resized where it is.  A shrink always happens in place, and a grow happens in
+	place if the block after it in the heap is free and large enough.  Otherwise SizeInBytes
+	space is allocated, the old data is copied over and ReleaseMemory(Ptr) is called.
 
 	Blocking: No
 
@@ -273,19 +812,22 @@ void *CallocMemory(UINT32 NumberOfItems, UINT32 SizeInBytes);
 		void *Ptr - Either (void*)NULL or data previously allocated with a call to 
 		AllocateMemory().
 
-		UINT32 SizeInBytes - The number of bytes to allocate in the heap.  This number
-		will be rounded up to be evenly divisible by sizeof(OS_WORD).  The data specified
-		by Ptr will be copied to the newly allocated area if Ptr is not (void*)NULL.  If
-		Ptr is not (void*)NULL this method will attempt to free it from the heap.
+		UINT32 SizeInBytes - The number of bytes the block needs to hold.  This number
+		will be rounded up to be evenly divisible by sizeof(OS_WORD).  If Ptr is
+		(void*)NULL this behaves like AllocateMemory().
 
 	Returns: 
-		void * - A void pointer to the newly allocated space upon success.  If the space
-		was not available a (void*)NULL pointer is returned.
+		void * - A void pointer to the resized space upon success, this is Ptr if the
+		block did not move.  If the space was not available a (void*)NULL pointer is
+		returned and Ptr is left untouched.
 
 	Notes: 
 		- USING_REALLOC_MEMORY_METHOD inside of RTOSConfig.h must be defined as 1 to
 		use this method.
 
+		- When the block has to move only the old contents are copied, the rest of the
+		new block is left as it was in the heap.
+
 	See Also:
 		- ReleaseMemory()
 */
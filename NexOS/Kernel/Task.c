@@ -31,6 +31,7 @@
 
 extern TASK * volatile gCurrentTask;
 extern DOUBLE_LINKED_LIST_HEAD gCPUScheduler[];
+extern BYTE gCurrentSystemPriority;
 
 #if (USING_TASK_UNIQUE_ID == 1)
     UINT32 gNextTaskUniqueID = 0;
@@ -48,6 +49,10 @@ extern DOUBLE_LINKED_LIST_HEAD gCPUScheduler[];
     UINT32 gNumberOfTasks = 0;
 #endif // end of #if (USING_GET_NUMBER_OF_TASKS_METHOD == 1)
 
+#if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+    extern DOUBLE_LINKED_LIST_HEAD gTaskStackList;
+#endif // end of #if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+
 #if (USING_SUSPEND_TASK_METHOD == 1 || USING_SUSPEND_ALL_TASKS_METHOD == 1)
 	static BOOL OS_SuspendTask(TASK *Task)
 	{
@@ -232,6 +237,24 @@ static TASK *OS_CreateTask(TASK_ENTRY_POINT StartingAddress,
 	#if(USING_TASK_CHECK_IN == 1)
 		NewTask->TaskCheckIn = (TASK_CHECK_IN*)NULL;
 	#endif // end of USING_TASK_CHECK_IN
+
+	#if (USING_TASK_HEAP_ACCOUNTING == 1)
+		NewTask->HeapUsedInBytes = 0;
+		NewTask->MaximumHeapUsedInBytes = 0;
+
+		// the TASK belongs to the OS, not to whichever TASK created it
+		if (PreAllocatedTask == (TASK*)NULL)
+			OS_SetMemoryOwner((void*)NewTask, (void*)NULL);
+
+		#if (USING_RESTART_TASK == 1)
+			if (NewTask->RestartInfo != (TASK_RESTART_INFO*)NULL)
+				OS_SetMemoryOwner((void*)NewTask->RestartInfo, (void*)NULL);
+		#endif // end of #if (USING_RESTART_TASK == 1)
+	#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
+
+	#if (USING_TASK_HEAP_QUOTA == 1)
+		NewTask->HeapQuotaInBytes = 0;
+	#endif // end of #if (USING_TASK_HEAP_QUOTA == 1)
         
 	#if (USING_TASK_SIGNAL == 1)
 		NewTask->TaskSignal.OS_Signals.Word = 0;
@@ -245,6 +268,12 @@ static TASK *OS_CreateTask(TASK_ENTRY_POINT StartingAddress,
     #if (USING_GET_NUMBER_OF_TASKS_METHOD == 1)
         gNumberOfTasks++;
     #endif // end of #if (USING_GET_NUMBER_OF_TASKS_METHOD == 1)
+
+    #if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+        InsertNodeAtEndOfDoubleLinkedList(&gTaskStackList, &NewTask->TaskStackNode);
+
+        NewTask->TaskStackNode.Data = (void*)NewTask;
+    #endif // end of #if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
         
 	return NewTask;
 }
@@ -592,7 +621,8 @@ TASK *CreateTask(TASK_ENTRY_POINT StartingAddress,
 
 		if(OS_DeleteTask(Task) == TRUE)
 		{
-			if(Task == gCurrentTask)
+			// release the CPU if it was us or the Maintenance TASK now outranks us
+			if(Task == gCurrentTask || gCurrentTask->TaskInfo.bits.Priority < gCurrentSystemPriority)
 				SurrenderCPU();
 	
 			ReturnValue = OS_SUCCESS;
@@ -638,13 +668,16 @@ TASK *CreateTask(TASK_ENTRY_POINT StartingAddress,
 */
 
 #if (USING_TASK_CHECK_IN == 1)
-	extern DOUBLE_LINKED_LIST_HEAD gTaskCheckInList;
 
 	OS_RESULT SetupTaskCheckIn(TASK_CHECK_IN *TaskCheckIn, UINT32 TaskCheckInPeriodicityInTicks)
 	{
         #if (USING_CHECK_TASK_PARAMETERS == 1)
             if (TaskCheckInPeriodicityInTicks <= 1)
                 return OS_INVALID_ARGUMENT;
+        #else
+            // a period of 0 would re-arm at the current tick and the tick would never leave OS_UpdateTaskCheckIn()
+            if (TaskCheckInPeriodicityInTicks == 0)
+                return OS_INVALID_ARGUMENT;
         #endif // end of #if (USING_CHECK_TASK_PARAMETERS == 1)
 	
 		EnterCritical();
@@ -676,12 +709,11 @@ TASK *CreateTask(TASK_ENTRY_POINT StartingAddress,
         }
 	
 		gCurrentTask->TaskCheckIn->Timeout = TaskCheckInPeriodicityInTicks;
-		gCurrentTask->TaskCheckIn->CurrentCount = 0;
 
 		OS_InitializeTaskNode(&(gCurrentTask->TaskCheckIn->TaskCheckInNode), (void*)gCurrentTask);
 		
-		// now add it to the check in list
-		OS_AddTaskToList(&gTaskCheckInList, &(gCurrentTask->TaskCheckIn->TaskCheckInNode));
+		// now add it to the check in list in order of its deadline
+		OS_AddTaskToCheckInList(gCurrentTask);
 
 		ExitCritical();
 	
@@ -699,7 +731,10 @@ TASK *CreateTask(TASK_ENTRY_POINT StartingAddress,
 			return OS_INVALID_OBJECT_USED;
 		}
 
-		gCurrentTask->TaskCheckIn->CurrentCount = 0;
+		// push the deadline forward by moving the TASK back in the check in list
+		OS_RemoveTaskFromList(&(gCurrentTask->TaskCheckIn->TaskCheckInNode));
+
+		OS_AddTaskToCheckInList(gCurrentTask);
 
 		ExitCritical();
 
@@ -851,8 +886,8 @@ TASK *CreateTask(TASK_ENTRY_POINT StartingAddress,
             
 			if (OS_RestartTask(Task) == TRUE)
 			{
-                // if the TASK to restart was us, release the CPU
-				if (Task == gCurrentTask)
+                // if the TASK to restart was us, or the Maintenance TASK now outranks us, release the CPU
+				if (Task == gCurrentTask || gCurrentTask->TaskInfo.bits.Priority < gCurrentSystemPriority)
 					SurrenderCPU();
 
 				ReturnValue = OS_SUCCESS;
@@ -1165,13 +1200,39 @@ TASK *CreateTask(TASK_ENTRY_POINT StartingAddress,
             Task = gCurrentTask;
 
         // get the value
-        FreeWords = PortAnaylzeTaskStackUsage(Task->StartOfTaskStackPointer, Task->StartingTaskStackSizeInWords);
+        FreeWords = PortAnaylzeTaskStackUsage(Task->StartOfTaskStackPointer + TASK_STACK_GUARD_SIZE_IN_WORDS, Task->StartingTaskStackSizeInWords - TASK_STACK_GUARD_SIZE_IN_WORDS);
 
         ExitCritical();
         
         return FreeWords * OS_WORD_SIZE_IN_BYTES;
     }
 #endif // end of #if (ANALYZE_TASK_STACK_USAGE == 1)
+
+#if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+    UINT32 TaskStackHighWaterMark(TASK *Task)
+    {
+        UINT32 FreeWords;
+
+        #if (USING_CHECK_TASK_PARAMETERS == 1)
+            if (Task != (TASK*)NULL)
+            {
+                if (RAMAddressValid((OS_WORD)Task) == FALSE)
+                    return 0xFFFFFFFF;
+            }
+        #endif // end of #if (USING_CHECK_TASK_PARAMETERS == 1)
+
+        EnterCritical();
+
+        if (Task == (TASK*)NULL)
+            Task = gCurrentTask;
+
+        FreeWords = (UINT32)(Task->LowestTaskStackPointer - (Task->StartOfTaskStackPointer + TASK_STACK_GUARD_SIZE_IN_WORDS));
+
+        ExitCritical();
+
+        return FreeWords * OS_WORD_SIZE_IN_BYTES;
+    }
+#endif // end of #if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
     
 #if (USING_TASK_UNIQUE_ID == 1)
     UINT32 TaskGetUniqueID(TASK *Task)
@@ -1189,4 +1250,78 @@ TASK *CreateTask(TASK_ENTRY_POINT StartingAddress,
         
         return Task->UniqueID;
     }
-#endif // end of #if (USING_TASK_UNIQUE_ID == 1)
\ No newline at end of file
+#endif // end of #if (USING_TASK_UNIQUE_ID == 1)
+#if (USING_TASK_HEAP_ACCOUNTING == 1)
+    UINT32 TaskGetHeapUsedInBytes(TASK *Task)
+    {
+        UINT32 HeapUsedInBytes;
+
+        #if (USING_CHECK_TASK_PARAMETERS == 1)
+            if (Task != (TASK*)NULL)
+            {
+                if (RAMAddressValid((OS_WORD)Task) == FALSE)
+                    return 0;
+            }
+        #endif // end of #if (USING_CHECK_TASK_PARAMETERS == 1)
+
+        EnterCritical();
+
+        if (Task == (TASK*)NULL)
+            Task = gCurrentTask;
+
+        HeapUsedInBytes = Task->HeapUsedInBytes;
+
+        ExitCritical();
+
+        return HeapUsedInBytes;
+    }
+
+    UINT32 TaskGetMaximumHeapUsedInBytes(TASK *Task)
+    {
+        UINT32 MaximumHeapUsedInBytes;
+
+        #if (USING_CHECK_TASK_PARAMETERS == 1)
+            if (Task != (TASK*)NULL)
+            {
+                if (RAMAddressValid((OS_WORD)Task) == FALSE)
+                    return 0;
+            }
+        #endif // end of #if (USING_CHECK_TASK_PARAMETERS == 1)
+
+        EnterCritical();
+
+        if (Task == (TASK*)NULL)
+            Task = gCurrentTask;
+
+        MaximumHeapUsedInBytes = Task->MaximumHeapUsedInBytes;
+
+        ExitCritical();
+
+        return MaximumHeapUsedInBytes;
+    }
+#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
+
+#if (USING_TASK_HEAP_QUOTA == 1)
+    OS_RESULT TaskSetHeapQuota(TASK *Task, UINT32 HeapQuotaInBytes)
+    {
+        #if (USING_CHECK_TASK_PARAMETERS == 1)
+            if (Task != (TASK*)NULL)
+            {
+                if (RAMAddressValid((OS_WORD)Task) == FALSE)
+                    return OS_INVALID_ARGUMENT_ADDRESS;
+            }
+        #endif // end of #if (USING_CHECK_TASK_PARAMETERS == 1)
+
+        EnterCritical();
+
+        if (Task == (TASK*)NULL)
+            Task = gCurrentTask;
+
+        // a TASK already over the new limit just can't allocate until it releases enough
+        Task->HeapQuotaInBytes = HeapQuotaInBytes;
+
+        ExitCritical();
+
+        return OS_SUCCESS;
+    }
+#endif // end of #if (USING_TASK_HEAP_QUOTA == 1)
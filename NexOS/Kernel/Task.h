@@ -555,6 +555,8 @@ BYTE *GetTaskName(TASK *Task);
 		- USING_TASK_CHECK_IN in RTOSConfig.h must be defined as a 1 to use this method.
 		- This method always applies to the current TASK when called.
 		- This method can only be called once per TASK, unless the TASK is restarted.
+		- A TaskCheckInPeriodicityInTicks of 0 is always rejected, even if USING_CHECK_TASK_PARAMETERS
+		is not defined as 1.
 
 	See Also:
 		TaskCheckIn()
@@ -926,4 +928,107 @@ UINT32 GetNumberOfTasks(void);
 */
 UINT32 AnalyzeTaskStack(TASK *Task);
 
+/*
+	UINT32 TaskStackHighWaterMark(TASK *Task)
+
+	Description: This method returns the number of unused bytes in a TASK stack
+    at the lowest stack pointer the OS has recorded for the TASK.  Unlike
+    AnalyzeTaskStack() the TASK stack is not scanned.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+        TASK *Task - A valid TASK returned from CreateTask(), or (TASK*)NULL for the current TASK.
+
+	Returns:
+        UINT32 - The number of bytes unused in the TASK stack.
+
+	Notes:
+		- USING_TASK_STACK_HIGH_WATER_MARK in RTOSConfig.h must be defined as a 1 to use this method.
+        - The mark is updated at each context switch, stack usage between context
+          switches is only seen if TASK_STACK_HIGH_WATER_MARK_GUARD_WORDS is greater than 0.
+
+	See Also:
+        - AnalyzeTaskStack(), TaskStackReportToString()
+*/
+UINT32 TaskStackHighWaterMark(TASK *Task);
+
+/*
+	UINT32 TaskGetHeapUsedInBytes(TASK *Task)
+
+	Description: This method returns how many bytes of the OS heap a TASK owns.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+        TASK *Task - A valid TASK returned from CreateTask(), or (TASK*)NULL for the current TASK.
+
+	Returns:
+        UINT32 - The number of bytes of the OS heap the TASK owns, memory headers included.
+
+	Notes:
+		- USING_TASK_HEAP_ACCOUNTING in RTOSConfig.h must be defined as a 1 to use this method.
+        - Only memory the TASK allocated itself is counted, not its stack.
+
+	See Also:
+        - TaskGetMaximumHeapUsedInBytes(), TaskSetHeapQuota()
+*/
+UINT32 TaskGetHeapUsedInBytes(TASK *Task);
+
+/*
+	UINT32 TaskGetMaximumHeapUsedInBytes(TASK *Task)
+
+	Description: This method returns the most bytes of the OS heap a TASK has ever
+	owned at once.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+        TASK *Task - A valid TASK returned from CreateTask(), or (TASK*)NULL for the current TASK.
+
+	Returns:
+        UINT32 - The peak number of bytes of the OS heap the TASK has owned.
+
+	Notes:
+		- USING_TASK_HEAP_ACCOUNTING in RTOSConfig.h must be defined as a 1 to use this method.
+
+	See Also:
+        - TaskGetHeapUsedInBytes()
+*/
+UINT32 TaskGetMaximumHeapUsedInBytes(TASK *Task);
+
+/*
+	OS_RESULT TaskSetHeapQuota(TASK *Task, UINT32 HeapQuotaInBytes)
+
+	Description: This method limits how many bytes of the OS heap a TASK can own.
+	Once at its limit, AllocateMemory() called by the TASK will fail.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+        TASK *Task - A valid TASK returned from CreateTask(), or (TASK*)NULL for the current TASK.
+
+        UINT32 HeapQuotaInBytes - The limit in bytes, memory headers included.  0 removes the limit.
+
+	Returns:
+        OS_SUCCESS - If the quota was set.
+
+        OS_INVALID_ARGUMENT_ADDRESS - If the TASK is not a valid address.
+
+	Notes:
+		- USING_TASK_HEAP_QUOTA in RTOSConfig.h must be defined as a 1 to use this method.
+
+	See Also:
+        - TaskGetHeapUsedInBytes()
+*/
+OS_RESULT TaskSetHeapQuota(TASK *Task, UINT32 HeapQuotaInBytes);
+
 #endif // end of TASK_H
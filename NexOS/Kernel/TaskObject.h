@@ -90,9 +90,9 @@ typedef struct
 
 typedef struct
 {
-	UINT32 CurrentCount;
+	UINT32 Deadline; // the OS tick count at which the TASK must have checked in by
 	UINT32 Timeout;
-	TASK_NODE TaskCheckInNode;
+	TASK_NODE TaskCheckInNode; // gTaskCheckInList is kept in order of Deadline
 }TASK_CHECK_IN;
 
 typedef struct
@@ -191,13 +191,43 @@ typedef struct
     FLOAT32 PreviousExecutionTime;
 }TASK_RUNTIME_HISTORY;
 
+/*
+    The TASK is laid out hot to cold.  Everything OS_NextTask() touches on every
+    context switch comes first so it shares as few cache lines as possible, the
+    fields only used by the API and the maintenance code follow after.
+
+    The cold fields are not split off behind a pointer.  With every option on the
+    switch time fields are the first 44 bytes of a 160 byte TASK, already the fewest
+    16 or 32 byte lines they fit in, and with the shipped RTOSConfig.h the whole
+    TASK is 28 bytes.  A split would not save a line, it would only cost every TASK
+    a second heap block.  Tools/TaskLayout measures this.
+*/
 typedef struct
 {
-	TASK_NODE TaskNodeArray[NUMBER_OF_INTERNAL_TASK_NODES]; // this is what is used by lists to store the TASK
+    // switch time fields, read or written by OS_NextTask() on every context switch
     OS_WORD *TaskStackPointer; // A pointer to a memory location as to where the tasks stack resides
 	OS_WORD CriticalCount;  // This stores the critical count of the system when the TASK was blocked by the OS
     TASK_INFO TaskInfo; // this stores various bits of information about the TASK
 
+    #if (USING_DELETE_TASK == 1) || (USING_RESTART_TASK == 1) || (ANALYZE_TASK_STACK_USAGE == 1) || (USING_CHECK_TASK_STACK_FOR_OVERFLOW == 1) || (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+        OS_WORD *StartOfTaskStackPointer;
+    #endif // end of using task restart or delete task
+
+    #if (ANALYZE_TASK_STACK_USAGE == 1) || (USING_CHECK_TASK_STACK_FOR_OVERFLOW == 1) || (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+        UINT32 StartingTaskStackSizeInWords;
+    #endif // end of #if (ANALYZE_TASK_STACK_USAGE == 1) || (USING_CHECK_TASK_STACK_FOR_OVERFLOW == 1) || (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+
+    #if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+        OS_WORD *LowestTaskStackPointer; // the lowest stack pointer the OS has seen for this TASK
+    #endif // end of #if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+
+    #if (USING_TASK_RUNTIME_EXECUTION_COUNTER == 1)
+        TASK_RUNTIME_INFO *TaskRunTime;
+    #endif // end of #if (USING_TASK_RUNTIME_EXECUTION_COUNTER == 1)
+
+	TASK_NODE TaskNodeArray[NUMBER_OF_INTERNAL_TASK_NODES]; // this is what is used by lists to store the TASK, the ready queue walks the PRIMARY_TASK_NODE
+
+    // cold fields, only touched by the API, the tick and the maintenance code
 	#if (USING_TASK_DELAY_TICKS_METHOD == 1)
 		INT32 DelayInTicks; // This is how many ticks the TASK is delaying
 	#endif // end of #if (USING_TASK_DELAY_TICKS_METHOD == 1)
@@ -210,13 +240,9 @@ typedef struct
         BYTE TaskName[TASK_NAME_LENGTH_IN_BYTES + 1];
     #endif // end of #if (USING_TASK_NAMES == 1)
 
-    #if (USING_DELETE_TASK == 1) || (USING_RESTART_TASK == 1) || (ANALYZE_TASK_STACK_USAGE == 1) || (USING_CHECK_TASK_STACK_FOR_OVERFLOW == 1)
-        OS_WORD *StartOfTaskStackPointer;
-    #endif // end of using task restart or delete task
-
-    #if (ANALYZE_TASK_STACK_USAGE == 1) || (USING_CHECK_TASK_STACK_FOR_OVERFLOW == 1)
-        UINT32 StartingTaskStackSizeInWords;
-    #endif // end of #if (ANALYZE_TASK_STACK_USAGE == 1) || (USING_CHECK_TASK_STACK_FOR_OVERFLOW == 1)
+    #if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+        DOUBLE_LINKED_LIST_NODE TaskStackNode; // this is used by the gTaskStackList
+    #endif // end of #if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
 
     #if (USING_RESTART_TASK == 1)
         TASK_RESTART_INFO *RestartInfo;
@@ -248,13 +274,18 @@ typedef struct
         void *TaskLocalThreadStorageArray[NUMBER_OF_LOCAL_THREAD_STORAGE_POINTERS];
     #endif // end of #if (USING_TASK_LOCAL_STORAGE_ACCESS == 1)
 
-    #if (USING_TASK_RUNTIME_EXECUTION_COUNTER == 1)
-        TASK_RUNTIME_INFO *TaskRunTime;
-    #endif // end of #if (USING_TASK_RUNTIME_EXECUTION_COUNTER == 1)
-
     #if (USING_TASK_UNIQUE_ID == 1)
         UINT32 UniqueID;
     #endif // end of #if (USING_TASK_UNIQUE_ID == 1)
+
+    #if (USING_TASK_HEAP_ACCOUNTING == 1)
+        UINT32 HeapUsedInBytes; // how much of the OS heap the TASK owns right now
+        UINT32 MaximumHeapUsedInBytes; // the most of the OS heap the TASK has ever owned
+    #endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
+
+    #if (USING_TASK_HEAP_QUOTA == 1)
+        UINT32 HeapQuotaInBytes; // the most of the OS heap the TASK may own, 0 for no limit
+    #endif // end of #if (USING_TASK_HEAP_QUOTA == 1)
 }TASK;
 
 #endif	/* TASKOBJECT_H */
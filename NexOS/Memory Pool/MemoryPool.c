@@ -0,0 +1,378 @@
+/*
+    NexOS Kernel Version v1.02.01
+    Copyright (c) 2023 brodie
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+ */
+
+#include "MemoryPool.h"
+#include "../Kernel/Memory.h"
+#include "CriticalSection.h"
+
+#if (USING_MEMORY_POOL_WAIT_FOR_BLOCK_METHOD == 1)
+	extern TASK * volatile gCurrentTask;
+#endif // end of #if (USING_MEMORY_POOL_WAIT_FOR_BLOCK_METHOD == 1)
+
+MEMORY_POOL *CreateMemoryPool(MEMORY_POOL *MemoryPool, void *PoolMemory, UINT32 BlockSizeInBytes, UINT32 NumberOfBlocks)
+{
+	MEMORY_POOL *NewMemoryPool;
+	BYTE *Block;
+	UINT32 i;
+
+	#if (USING_CHECK_MEMORY_POOL_PARAMETERS == 1)
+		if (MemoryPool != (MEMORY_POOL*)NULL)
+			if (RAMAddressValid((OS_WORD)MemoryPool) == FALSE)
+				return (MEMORY_POOL*)NULL;
+
+		if (PoolMemory != (void*)NULL)
+			if (RAMAddressValid((OS_WORD)PoolMemory) == FALSE || ((OS_WORD)PoolMemory % sizeof(OS_WORD)) != 0)
+				return (MEMORY_POOL*)NULL;
+	#endif // end of #if (USING_CHECK_MEMORY_POOL_PARAMETERS == 1)
+
+	if (BlockSizeInBytes == 0 || NumberOfBlocks == 0)
+		return (MEMORY_POOL*)NULL;
+
+	// the rounding below would wrap
+	if (BlockSizeInBytes > 0xFFFFFFFF - (sizeof(OS_WORD) - 1))
+		return (MEMORY_POOL*)NULL;
+
+	// every free block has to be able to hold the pointer to the next free block
+	if (BlockSizeInBytes < sizeof(void*))
+		BlockSizeInBytes = sizeof(void*);
+
+	// keep every block OS_WORD aligned
+	BlockSizeInBytes = (BlockSizeInBytes + sizeof(OS_WORD) - 1) & ~(sizeof(OS_WORD) - 1);
+
+	// the whole pool has to fit in a UINT32, otherwise we would thread blocks past the end of the RAM we have
+	if (NumberOfBlocks > 0xFFFFFFFF / BlockSizeInBytes)
+		return (MEMORY_POOL*)NULL;
+
+	NewMemoryPool = MemoryPool;
+
+	if (NewMemoryPool == (MEMORY_POOL*)NULL)
+	{
+		if ((NewMemoryPool = (MEMORY_POOL*)AllocateMemory(sizeof(MEMORY_POOL))) == (MEMORY_POOL*)NULL)
+			return (MEMORY_POOL*)NULL;
+	}
+
+	NewMemoryPool->MemoryPoolAllocated = (BOOL)(MemoryPool == (MEMORY_POOL*)NULL);
+	NewMemoryPool->PoolMemoryAllocated = (BOOL)(PoolMemory == (void*)NULL);
+
+	if (PoolMemory == (void*)NULL)
+	{
+		// carve all the blocks out of the OS heap at once
+		if ((PoolMemory = AllocateMemory(BlockSizeInBytes * NumberOfBlocks)) == (void*)NULL)
+		{
+			// only delete it if we allocated for a new one
+			if (MemoryPool == (MEMORY_POOL*)NULL)
+				ReleaseMemory((void*)NewMemoryPool);
+
+			return (MEMORY_POOL*)NULL;
+		}
+	}
+
+	NewMemoryPool->BlockSizeInBytes = BlockSizeInBytes;
+	NewMemoryPool->NumberOfBlocks = NumberOfBlocks;
+	NewMemoryPool->BlocksFree = NumberOfBlocks;
+	NewMemoryPool->StartOfPool = (BYTE*)PoolMemory;
+	NewMemoryPool->EndOfPool = (BYTE*)PoolMemory + (BlockSizeInBytes * NumberOfBlocks);
+
+	// thread every block onto the free list in address order
+	Block = NewMemoryPool->StartOfPool;
+
+	for (i = 0; i < NumberOfBlocks - 1; i++)
+	{
+		*(void**)Block = (void*)(Block + BlockSizeInBytes);
+
+		Block += BlockSizeInBytes;
+	}
+
+	*(void**)Block = (void*)NULL;
+
+	NewMemoryPool->FreeList = (void*)NewMemoryPool->StartOfPool;
+
+	#if (USING_MEMORY_POOL_STATISTICS == 1)
+		NewMemoryPool->MaximumBlocksUsed = 0;
+		NewMemoryPool->FailedAllocations = 0;
+	#endif // end of #if (USING_MEMORY_POOL_STATISTICS == 1)
+
+	#if (USING_MEMORY_POOL_WAIT_FOR_BLOCK_METHOD == 1)
+		InitializeDoubleLinkedListHead(&NewMemoryPool->BlockedListHead);
+	#endif // end of #if (USING_MEMORY_POOL_WAIT_FOR_BLOCK_METHOD == 1)
+
+	return NewMemoryPool;
+}
+
+#if (USING_MEMORY_POOL_ALLOCATE_METHOD == 1)
+	void *MemoryPoolAllocate(MEMORY_POOL *MemoryPool)
+	{
+		void *Block;
+
+		EnterCritical();
+
+		Block = MemoryPoolAllocateFromISR(MemoryPool);
+
+		ExitCritical();
+
+		return Block;
+	}
+#endif // end of #if (USING_MEMORY_POOL_ALLOCATE_METHOD == 1)
+
+void *MemoryPoolAllocateFromISR(MEMORY_POOL *MemoryPool)
+{
+	void *Block;
+
+	#if (USING_CHECK_MEMORY_POOL_PARAMETERS == 1)
+		if (RAMAddressValid((OS_WORD)MemoryPool) == FALSE)
+			return (void*)NULL;
+	#endif // end of #if (USING_CHECK_MEMORY_POOL_PARAMETERS == 1)
+
+	Block = MemoryPool->FreeList;
+
+	if (Block == (void*)NULL)
+	{
+		#if (USING_MEMORY_POOL_STATISTICS == 1)
+			MemoryPool->FailedAllocations++;
+		#endif // end of #if (USING_MEMORY_POOL_STATISTICS == 1)
+
+		return (void*)NULL;
+	}
+
+	// the block we are handing out points to the next free one
+	MemoryPool->FreeList = *(void**)Block;
+
+	MemoryPool->BlocksFree--;
+
+	#if (USING_MEMORY_POOL_STATISTICS == 1)
+		if (MemoryPool->NumberOfBlocks - MemoryPool->BlocksFree > MemoryPool->MaximumBlocksUsed)
+			MemoryPool->MaximumBlocksUsed = MemoryPool->NumberOfBlocks - MemoryPool->BlocksFree;
+	#endif // end of #if (USING_MEMORY_POOL_STATISTICS == 1)
+
+	return Block;
+}
+
+#if (USING_MEMORY_POOL_WAIT_FOR_BLOCK_METHOD == 1)
+	void *MemoryPoolWaitForBlock(	MEMORY_POOL *MemoryPool
+
+									#if (USING_TASK_DELAY_TICKS_METHOD == 1)
+										, INT32 TimeoutInTicks
+									#endif // end of #if (USING_TASK_DELAY_TICKS_METHOD == 1)
+
+									)
+	{
+		void *Block;
+
+		#if (USING_CHECK_MEMORY_POOL_PARAMETERS == 1)
+			if (RAMAddressValid((OS_WORD)MemoryPool) == FALSE)
+				return (void*)NULL;
+		#endif // end of #if (USING_CHECK_MEMORY_POOL_PARAMETERS == 1)
+
+		EnterCritical();
+
+		// keep trying until we get a block, another TASK or ISR could beat us to a released block
+		while ((Block = MemoryPoolAllocateFromISR(MemoryPool)) == (void*)NULL)
+		{
+			OS_PlaceTaskOnBlockedList(gCurrentTask, &MemoryPool->BlockedListHead, &gCurrentTask->TaskNodeArray[PRIMARY_TASK_NODE], BLOCKED, TRUE);
+
+			#if (USING_TASK_DELAY_TICKS_METHOD == 1)
+				if (TimeoutInTicks > 0)
+				{
+					// place on timer list
+					OS_AddTaskToDelayQueue(gCurrentTask, &gCurrentTask->TaskNodeArray[SECONDARY_TASK_NODE], TimeoutInTicks, FALSE);
+				}
+			#endif // end of #if (USING_TASK_DELAY_TICKS_METHOD == 1)
+
+			SurrenderCPU();
+
+			#if (USING_TASK_DELAY_TICKS_METHOD == 1)
+				if (TimeoutInTicks > 0)
+				{
+					// if we timed out just exit with nothing
+					if (gCurrentTask->DelayInTicks == TASK_TIMEOUT_DONE_VALUE)
+					{
+						gCurrentTask->DelayInTicks = 0;
+
+						break;
+					}
+				}
+			#endif // end of #if (USING_TASK_DELAY_TICKS_METHOD == 1)
+		}
+
+		ExitCritical();
+
+		return Block;
+	}
+#endif // end of #if (USING_MEMORY_POOL_WAIT_FOR_BLOCK_METHOD == 1)
+
+#if (USING_MEMORY_POOL_RELEASE_METHOD == 1)
+	OS_RESULT MemoryPoolRelease(MEMORY_POOL *MemoryPool, void *Block)
+	{
+		OS_RESULT Result;
+
+		EnterCritical();
+
+		Result = MemoryPoolReleaseFromISR(MemoryPool, Block);
+
+		ExitCritical();
+
+		return Result;
+	}
+#endif // end of #if (USING_MEMORY_POOL_RELEASE_METHOD == 1)
+
+OS_RESULT MemoryPoolReleaseFromISR(MEMORY_POOL *MemoryPool, void *Block)
+{
+	#if (USING_CHECK_MEMORY_POOL_PARAMETERS == 1)
+		void *FreeBlock;
+		UINT32 i;
+
+		if (RAMAddressValid((OS_WORD)MemoryPool) == FALSE)
+			return OS_INVALID_ARGUMENT_ADDRESS;
+	#endif // end of #if (USING_CHECK_MEMORY_POOL_PARAMETERS == 1)
+
+	// the block has to be the start of a block inside of this pool
+	if ((BYTE*)Block < MemoryPool->StartOfPool || (BYTE*)Block >= MemoryPool->EndOfPool)
+		return OS_INVALID_ARGUMENT_ADDRESS;
+
+	if (((UINT32)((BYTE*)Block - MemoryPool->StartOfPool) % MemoryPool->BlockSizeInBytes) != 0)
+		return OS_INVALID_ARGUMENT_ADDRESS;
+
+	// releasing more blocks than we have would corrupt the free list
+	if (MemoryPool->BlocksFree == MemoryPool->NumberOfBlocks)
+		return OS_RESOURCE_FULL;
+
+	#if (USING_CHECK_MEMORY_POOL_PARAMETERS == 1)
+		// a block released twice would end up on the free list twice and be handed out to two owners
+		FreeBlock = MemoryPool->FreeList;
+
+		for (i = 0; i < MemoryPool->BlocksFree && FreeBlock != (void*)NULL; i++)
+		{
+			if (FreeBlock == Block)
+				return OS_INVALID_OBJECT_STATE;
+
+			FreeBlock = *(void**)FreeBlock;
+		}
+	#endif // end of #if (USING_CHECK_MEMORY_POOL_PARAMETERS == 1)
+
+	*(void**)Block = MemoryPool->FreeList;
+
+	MemoryPool->FreeList = Block;
+
+	MemoryPool->BlocksFree++;
+
+	#if (USING_MEMORY_POOL_WAIT_FOR_BLOCK_METHOD == 1)
+		// if there is a TASK waiting for a block, wake it.
+		if (DoubleLinkedListHasData(&MemoryPool->BlockedListHead) == TRUE)
+		{
+			UINT32 i;
+
+			TASK *TaskHandle = (TASK*)MemoryPool->BlockedListHead.Beginning->Data;
+
+			// remove all the nodes from any lists they were on
+			for (i = 0; i < NUMBER_OF_INTERNAL_TASK_NODES; i++)
+				OS_RemoveTaskFromList(&TaskHandle->TaskNodeArray[i]);
+
+			// now add it to the ready queue
+			if (OS_AddTaskToReadyQueue(TaskHandle) == TRUE)
+				SurrenderCPU();
+		}
+	#endif // end of #if (USING_MEMORY_POOL_WAIT_FOR_BLOCK_METHOD == 1)
+
+	return OS_SUCCESS;
+}
+
+#if (USING_MEMORY_POOL_GET_BLOCKS_FREE_METHOD == 1)
+	UINT32 MemoryPoolGetBlocksFree(MEMORY_POOL *MemoryPool)
+	{
+		#if (USING_CHECK_MEMORY_POOL_PARAMETERS == 1)
+			if (RAMAddressValid((OS_WORD)MemoryPool) == FALSE)
+				return 0;
+		#endif // end of #if (USING_CHECK_MEMORY_POOL_PARAMETERS == 1)
+
+		return MemoryPool->BlocksFree;
+	}
+#endif // end of #if (USING_MEMORY_POOL_GET_BLOCKS_FREE_METHOD == 1)
+
+#if (USING_MEMORY_POOL_STATISTICS == 1)
+	UINT32 MemoryPoolGetMaximumBlocksUsed(MEMORY_POOL *MemoryPool)
+	{
+		#if (USING_CHECK_MEMORY_POOL_PARAMETERS == 1)
+			if (RAMAddressValid((OS_WORD)MemoryPool) == FALSE)
+				return 0;
+		#endif // end of #if (USING_CHECK_MEMORY_POOL_PARAMETERS == 1)
+
+		return MemoryPool->MaximumBlocksUsed;
+	}
+
+	UINT32 MemoryPoolGetFailedAllocations(MEMORY_POOL *MemoryPool)
+	{
+		#if (USING_CHECK_MEMORY_POOL_PARAMETERS == 1)
+			if (RAMAddressValid((OS_WORD)MemoryPool) == FALSE)
+				return 0;
+		#endif // end of #if (USING_CHECK_MEMORY_POOL_PARAMETERS == 1)
+
+		return MemoryPool->FailedAllocations;
+	}
+#endif // end of #if (USING_MEMORY_POOL_STATISTICS == 1)
+
+#if (USING_DELETE_MEMORY_POOL_METHOD == 1)
+	OS_RESULT DeleteMemoryPool(MEMORY_POOL *MemoryPool)
+	{
+		OS_RESULT Result = OS_SUCCESS;
+
+		#if (USING_CHECK_MEMORY_POOL_PARAMETERS == 1)
+			if (RAMAddressValid((OS_WORD)MemoryPool) == FALSE)
+				return OS_INVALID_ARGUMENT_ADDRESS;
+		#endif // end of #if (USING_CHECK_MEMORY_POOL_PARAMETERS == 1)
+
+		EnterCritical();
+
+		// is someone still using it?
+		if (MemoryPool->BlocksFree != MemoryPool->NumberOfBlocks)
+		{
+			ExitCritical();
+
+			return OS_RESOURCE_IN_USE;
+		}
+
+		#if (USING_MEMORY_POOL_WAIT_FOR_BLOCK_METHOD == 1)
+			if (DoubleLinkedListHasData(&MemoryPool->BlockedListHead) == TRUE)
+			{
+				ExitCritical();
+
+				return OS_RESOURCE_IN_USE;
+			}
+		#endif // end of #if (USING_MEMORY_POOL_WAIT_FOR_BLOCK_METHOD == 1)
+
+		// nothing else can get a block now
+		MemoryPool->FreeList = (void*)NULL;
+		MemoryPool->BlocksFree = 0;
+
+		if (MemoryPool->PoolMemoryAllocated == TRUE)
+			if (ReleaseMemory((void*)MemoryPool->StartOfPool) == FALSE)
+				Result = OS_FREE_MEMORY_FAILED;
+
+		if (MemoryPool->MemoryPoolAllocated == TRUE)
+			if (ReleaseMemory((void*)MemoryPool) == FALSE)
+				Result = OS_FREE_MEMORY_FAILED;
+
+		ExitCritical();
+
+		return Result;
+	}
+#endif // end of #if (USING_DELETE_MEMORY_POOL_METHOD == 1)
@@ -0,0 +1,405 @@
+/*
+    NexOS Kernel Version v1.02.01
+    Copyright (c) 2023 brodie
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+ */
+
+/*
+	MEMORY_POOL Description:
+		A MEMORY_POOL hands out blocks of one fixed size from a single region of RAM.  The region
+		can be a static array supplied by the user or it can be carved out of the OS heap in one
+		allocation when the MEMORY_POOL is created.  After that the OS heap is never touched again
+		by the MEMORY_POOL.
+
+		Every free block holds a pointer to the next free block inside of itself.  This means
+		getting and releasing a block is always a constant time operation and there is no
+		per block header, unlike memory allocated from the OS heap.  A MEMORY_POOL also cannot
+		fragment since every block is the same size.
+
+		A TASK can optionally block on an empty MEMORY_POOL until another TASK or ISR releases
+		a block back to it.
+*/
+
+#ifndef MEMORY_POOL_H
+	#define MEMORY_POOL_H
+
+#include "RTOSConfig.h"
+#include "../Kernel/Kernel.h"
+
+// This is how many OS_WORDs a static array needs to be to back a MEMORY_POOL.  It
+// accounts for the rounding CreateMemoryPool() does to each block.
+#define MEMORY_POOL_SIZE_IN_WORDS(BlockSizeInBytes, NumberOfBlocks)			(((((BlockSizeInBytes) < sizeof(void*) ? sizeof(void*) : (BlockSizeInBytes)) + sizeof(OS_WORD) - 1) / sizeof(OS_WORD)) * (NumberOfBlocks))
+
+typedef struct
+{
+	// this points to the first free block, each free block points to the next one
+	void *FreeList;
+
+	// this is the size of each block after it was rounded up to a whole OS_WORD
+	UINT32 BlockSizeInBytes;
+
+	UINT32 NumberOfBlocks;
+
+	UINT32 BlocksFree;
+
+	// these are used to validate a block being released back to the MEMORY_POOL
+	BYTE *StartOfPool;
+	BYTE *EndOfPool;
+
+	// these record what CreateMemoryPool() took from the OS heap
+	BOOL PoolMemoryAllocated;
+	BOOL MemoryPoolAllocated;
+
+	#if (USING_MEMORY_POOL_STATISTICS == 1)
+		// this is the most blocks that were ever out of the MEMORY_POOL at once
+		UINT32 MaximumBlocksUsed;
+
+		// this is how many times a block was requested when none were free
+		UINT32 FailedAllocations;
+	#endif // end of #if (USING_MEMORY_POOL_STATISTICS == 1)
+
+	#if (USING_MEMORY_POOL_WAIT_FOR_BLOCK_METHOD == 1)
+		// this holds the TASKs waiting for a block to be released
+		DOUBLE_LINKED_LIST_HEAD BlockedListHead;
+	#endif // end of #if (USING_MEMORY_POOL_WAIT_FOR_BLOCK_METHOD == 1)
+}MEMORY_POOL;
+
+/*
+	MEMORY_POOL *CreateMemoryPool(MEMORY_POOL *MemoryPool, void *PoolMemory, UINT32 BlockSizeInBytes, UINT32 NumberOfBlocks)
+
+	Description: This method creates and or initializes a MEMORY_POOL.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		MEMORY_POOL *MemoryPool - A pointer to a MEMORY_POOL.  If NULL is passed in
+		this method will create the MEMORY_POOL object in the OS heap.
+
+		void *PoolMemory - A pointer to the RAM the blocks will come from.  This must be
+		OS_WORD aligned and at least MEMORY_POOL_SIZE_IN_WORDS(BlockSizeInBytes, NumberOfBlocks)
+		OS_WORDs long.  If NULL is passed in the RAM is allocated from the OS heap in a
+		single allocation.
+
+		UINT32 BlockSizeInBytes - The size of each block.  This is rounded up to a whole
+		number of OS_WORDs and can be no smaller than a pointer.
+
+		UINT32 NumberOfBlocks - How many blocks the MEMORY_POOL holds.
+
+	Returns:
+		MEMORY_POOL * - A pointer to a valid MEMORY_POOL upon success, otherwise a
+		(MEMORY_POOL*)NULL pointer is returned.
+
+	Notes:
+		- (MEMORY_POOL*)NULL is also returned if the rounded BlockSizeInBytes times
+		  NumberOfBlocks does not fit in a UINT32.
+
+	See Also:
+		- DeleteMemoryPool()
+*/
+MEMORY_POOL *CreateMemoryPool(MEMORY_POOL *MemoryPool, void *PoolMemory, UINT32 BlockSizeInBytes, UINT32 NumberOfBlocks);
+
+/*
+	void *MemoryPoolAllocate(MEMORY_POOL *MemoryPool)
+
+	Description: This method takes a block out of a MEMORY_POOL.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		MEMORY_POOL *MemoryPool - A pointer to a valid MEMORY_POOL.
+
+	Returns:
+		void * - A pointer to the block, or (void*)NULL if the MEMORY_POOL was empty.
+
+	Notes:
+		- USING_MEMORY_POOL_ALLOCATE_METHOD inside of RTOSConfig.h must
+		  be defined as a 1 to use this method.
+
+	See Also:
+		- MemoryPoolAllocateFromISR(), MemoryPoolRelease()
+*/
+#if (USING_MEMORY_POOL_ALLOCATE_METHOD == 1)
+	void *MemoryPoolAllocate(MEMORY_POOL *MemoryPool);
+#endif // end of #if (USING_MEMORY_POOL_ALLOCATE_METHOD == 1)
+
+/*
+	void *MemoryPoolAllocateFromISR(MEMORY_POOL *MemoryPool)
+
+	Description: This method takes a block out of a MEMORY_POOL from an ISR.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		MEMORY_POOL *MemoryPool - A pointer to a valid MEMORY_POOL.
+
+	Returns:
+		void * - A pointer to the block, or (void*)NULL if the MEMORY_POOL was empty.
+
+	Notes:
+		- This should only be called from an ISR or inside of a critical section.
+
+	See Also:
+		- MemoryPoolAllocate(), MemoryPoolReleaseFromISR()
+*/
+void *MemoryPoolAllocateFromISR(MEMORY_POOL *MemoryPool);
+
+/*
+	void *MemoryPoolWaitForBlock(MEMORY_POOL *MemoryPool, INT32 TimeoutInTicks)
+
+	Description: This method takes a block out of a MEMORY_POOL.  If the MEMORY_POOL
+	is empty the calling TASK will block until a block is released back to it.
+
+	Blocking: Potentially
+
+	User Callable: Yes
+
+	Arguments:
+		MEMORY_POOL *MemoryPool - A pointer to a valid MEMORY_POOL.
+
+		INT32 TimeoutInTicks - This is a timeout value in ticks to wait
+		for a block.  Below are valid values for TimeoutInTicks.
+
+			TimeoutInTicks = 1 to (2^31 - 1): The calling TASK will be placed onto the
+			Delayed Queue up to the specified number of ticks.
+
+			TimeoutInTicks <= 0: The calling TASK will not be placed on the
+			Delay Queue and will wait forever.
+
+	Returns:
+		void * - A pointer to the block, or (void*)NULL if the timeout expired first.
+
+	Notes:
+		- USING_MEMORY_POOL_WAIT_FOR_BLOCK_METHOD inside of RTOSConfig.h must
+		  be defined as a 1 to use this method.
+
+		- USING_TASK_DELAY_TICKS_METHOD inside of RTOSConfig.h must
+		  be defined as a 1 to use the INT32 TimeoutInTicks argument.
+
+		- If another TASK takes the released block first, the calling TASK blocks
+		  again for the full timeout.
+
+	See Also:
+		- MemoryPoolRelease(), MemoryPoolReleaseFromISR()
+*/
+#if (USING_MEMORY_POOL_WAIT_FOR_BLOCK_METHOD == 1)
+	void *MemoryPoolWaitForBlock(	MEMORY_POOL *MemoryPool
+
+									#if (USING_TASK_DELAY_TICKS_METHOD == 1)
+										, INT32 TimeoutInTicks
+									#endif // end of #if (USING_TASK_DELAY_TICKS_METHOD == 1)
+
+									);
+#endif // end of #if (USING_MEMORY_POOL_WAIT_FOR_BLOCK_METHOD == 1)
+
+/*
+	OS_RESULT MemoryPoolRelease(MEMORY_POOL *MemoryPool, void *Block)
+
+	Description: This method returns a block to the MEMORY_POOL it came from.  If a
+	TASK is waiting for a block it is readied.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		MEMORY_POOL *MemoryPool - A pointer to a valid MEMORY_POOL.
+
+		void *Block - A block previously obtained from the same MEMORY_POOL.
+
+	Returns:
+		OS_SUCCESS - If the block was returned to the MEMORY_POOL.
+
+		OS_INVALID_ARGUMENT_ADDRESS - If the block does not belong to the MEMORY_POOL.
+
+		OS_RESOURCE_FULL - If the MEMORY_POOL already had all of its blocks.
+
+		OS_INVALID_OBJECT_STATE - If the block is already free.  This is only checked
+		when USING_CHECK_MEMORY_POOL_PARAMETERS is a 1.
+
+	Notes:
+		- USING_MEMORY_POOL_RELEASE_METHOD inside of RTOSConfig.h must
+		  be defined as a 1 to use this method.
+		- With USING_CHECK_MEMORY_POOL_PARAMETERS the free list is walked to catch
+		  a block released twice, so a release takes longer the more blocks are free.
+
+	See Also:
+		- MemoryPoolReleaseFromISR(), MemoryPoolAllocate()
+*/
+#if (USING_MEMORY_POOL_RELEASE_METHOD == 1)
+	OS_RESULT MemoryPoolRelease(MEMORY_POOL *MemoryPool, void *Block);
+#endif // end of #if (USING_MEMORY_POOL_RELEASE_METHOD == 1)
+
+/*
+	OS_RESULT MemoryPoolReleaseFromISR(MEMORY_POOL *MemoryPool, void *Block)
+
+	Description: This method returns a block to the MEMORY_POOL it came from while in
+	an ISR.  If a TASK is waiting for a block it is readied.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		MEMORY_POOL *MemoryPool - A pointer to a valid MEMORY_POOL.
+
+		void *Block - A block previously obtained from the same MEMORY_POOL.
+
+	Returns:
+		OS_SUCCESS - If the block was returned to the MEMORY_POOL.
+
+		OS_INVALID_ARGUMENT_ADDRESS - If the block does not belong to the MEMORY_POOL.
+
+		OS_RESOURCE_FULL - If the MEMORY_POOL already had all of its blocks.
+
+		OS_INVALID_OBJECT_STATE - If the block is already free.  This is only checked
+		when USING_CHECK_MEMORY_POOL_PARAMETERS is a 1.
+
+	Notes:
+		- This should only be called from an ISR or inside of a critical section.
+		- With USING_CHECK_MEMORY_POOL_PARAMETERS the free list is walked to catch
+		  a block released twice, so a release takes longer the more blocks are free.
+
+	See Also:
+		- MemoryPoolRelease(), MemoryPoolAllocateFromISR()
+*/
+OS_RESULT MemoryPoolReleaseFromISR(MEMORY_POOL *MemoryPool, void *Block);
+
+/*
+	UINT32 MemoryPoolGetBlocksFree(MEMORY_POOL *MemoryPool)
+
+	Description: This method returns how many blocks are left in a MEMORY_POOL.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		MEMORY_POOL *MemoryPool - A pointer to a valid MEMORY_POOL.
+
+	Returns:
+		UINT32 - The number of free blocks.
+
+	Notes:
+		- USING_MEMORY_POOL_GET_BLOCKS_FREE_METHOD inside of RTOSConfig.h must
+		  be defined as a 1 to use this method.
+
+	See Also:
+		- MemoryPoolGetMaximumBlocksUsed()
+*/
+#if (USING_MEMORY_POOL_GET_BLOCKS_FREE_METHOD == 1)
+	UINT32 MemoryPoolGetBlocksFree(MEMORY_POOL *MemoryPool);
+#endif // end of #if (USING_MEMORY_POOL_GET_BLOCKS_FREE_METHOD == 1)
+
+/*
+	UINT32 MemoryPoolGetMaximumBlocksUsed(MEMORY_POOL *MemoryPool)
+
+	Description: This method returns the most blocks that have been out of a
+	MEMORY_POOL at the same time since it was created.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		MEMORY_POOL *MemoryPool - A pointer to a valid MEMORY_POOL.
+
+	Returns:
+		UINT32 - The high water mark of the MEMORY_POOL in blocks.
+
+	Notes:
+		- USING_MEMORY_POOL_STATISTICS inside of RTOSConfig.h must
+		  be defined as a 1 to use this method.
+
+	See Also:
+		- MemoryPoolGetFailedAllocations()
+*/
+#if (USING_MEMORY_POOL_STATISTICS == 1)
+	UINT32 MemoryPoolGetMaximumBlocksUsed(MEMORY_POOL *MemoryPool);
+#endif // end of #if (USING_MEMORY_POOL_STATISTICS == 1)
+
+/*
+	UINT32 MemoryPoolGetFailedAllocations(MEMORY_POOL *MemoryPool)
+
+	Description: This method returns how many times a block was requested from
+	a MEMORY_POOL while it was empty.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		MEMORY_POOL *MemoryPool - A pointer to a valid MEMORY_POOL.
+
+	Returns:
+		UINT32 - The number of failed requests.
+
+	Notes:
+		- USING_MEMORY_POOL_STATISTICS inside of RTOSConfig.h must
+		  be defined as a 1 to use this method.
+
+		- A TASK that blocks in MemoryPoolWaitForBlock() counts as a failed request
+		  each time it finds the MEMORY_POOL empty.
+
+	See Also:
+		- MemoryPoolGetMaximumBlocksUsed()
+*/
+#if (USING_MEMORY_POOL_STATISTICS == 1)
+	UINT32 MemoryPoolGetFailedAllocations(MEMORY_POOL *MemoryPool);
+#endif // end of #if (USING_MEMORY_POOL_STATISTICS == 1)
+
+/*
+	OS_RESULT DeleteMemoryPool(MEMORY_POOL *MemoryPool)
+
+	Description: This method deletes a MEMORY_POOL.  Anything CreateMemoryPool()
+	took from the OS heap is released.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		MEMORY_POOL *MemoryPool - A pointer to a valid MEMORY_POOL.
+
+	Returns:
+		OS_SUCCESS - If the MEMORY_POOL was deleted.
+
+		OS_RESOURCE_IN_USE - If any block is still out of the MEMORY_POOL or a TASK
+		is waiting on it.
+
+		OS_FREE_MEMORY_FAILED - If the OS heap memory could not be released.
+
+	Notes:
+		- USING_DELETE_MEMORY_POOL_METHOD inside of RTOSConfig.h must
+		  be defined as a 1 to use this method.
+
+	See Also:
+		- CreateMemoryPool()
+*/
+#if (USING_DELETE_MEMORY_POOL_METHOD == 1)
+	OS_RESULT DeleteMemoryPool(MEMORY_POOL *MemoryPool);
+#endif // end of #if (USING_DELETE_MEMORY_POOL_METHOD == 1)
+
+#endif // end of #ifndef MEMORY_POOL_H
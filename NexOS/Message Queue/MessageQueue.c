@@ -25,10 +25,31 @@
 #include "../Kernel/Memory.h"
 #include "CriticalSection.h"
 
+#if (USING_MESSAGE_QUEUE_MEMORY_POOL == 1)
+	#include "../Memory Pool/MemoryPool.h"
+#endif // end of #if (USING_MESSAGE_QUEUE_MEMORY_POOL == 1)
+
 #if (USING_MESSAGE_QUEUE_WAIT_FOR_DATA_METHOD == 1)
 	extern TASK * volatile gCurrentTask;
 #endif // end of #if (USING_MESSAGE_QUEUE_WAIT_FOR_DATA_METHOD == 1)
 
+#if (USING_MESSAGE_QUEUE_MEMORY_POOL == 1)
+	// every MESSAGE_QUEUE_NODE comes out of here instead of the OS heap
+	static OS_WORD gMessageQueueNodeMemory[MEMORY_POOL_SIZE_IN_WORDS(sizeof(MESSAGE_QUEUE_NODE), MESSAGE_QUEUE_MEMORY_POOL_SIZE_IN_NODES)];
+	static MEMORY_POOL gMessageQueueNodePool;
+
+	#define MessageQueueAllocateNode()				(MESSAGE_QUEUE_NODE*)MemoryPoolAllocateFromISR(&gMessageQueueNodePool)
+	#define MessageQueueReleaseNode(Node)			(BOOL)(MemoryPoolReleaseFromISR(&gMessageQueueNodePool, (void*)(Node)) == OS_SUCCESS)
+
+	void OS_InitializeMessageQueueMemoryPool(void)
+	{
+		CreateMemoryPool(&gMessageQueueNodePool, (void*)gMessageQueueNodeMemory, sizeof(MESSAGE_QUEUE_NODE), MESSAGE_QUEUE_MEMORY_POOL_SIZE_IN_NODES);
+	}
+#else
+	#define MessageQueueAllocateNode()				(MESSAGE_QUEUE_NODE*)OS_AllocateMemory(sizeof(MESSAGE_QUEUE_NODE))
+	#define MessageQueueReleaseNode(Node)			OS_ReleaseMemory((void*)(Node))
+#endif // end of #if (USING_MESSAGE_QUEUE_MEMORY_POOL == 1)
+
 /*
 	This method removes the MESSAGE_QUEUE_NODE at the head of the queue.
 	Then updates the queue node pointers to point to the next node.
@@ -47,10 +68,12 @@
         // now make the start of data in the message queue point to the second node (if it exists)
         MessageQueue->MessageQueueData = (MESSAGE_QUEUE_NODE*)MessageQueue->MessageQueueData->NextMessageQueueNode;
 
-        #if (USING_MESSAGE_QUEUE_GET_SIZE_FROM_ISR_METHOD == 1)
-            // now decrement the size by one
-            MessageQueue->MessageQueueSize--;
-        #endif // end of #if (USING_MESSAGE_QUEUE_GET_SIZE_FROM_ISR_METHOD == 1)
+        // if that was the last node the tail goes with it
+        if (MessageQueue->MessageQueueData == (MESSAGE_QUEUE_NODE*)NULL)
+            MessageQueue->MessageQueueDataEnd = (MESSAGE_QUEUE_NODE*)NULL;
+
+        // now decrement the size by one
+        MessageQueue->MessageQueueSize--;
 
         return Node;
     }
@@ -69,23 +92,15 @@ static void MessageQueueAddNode(MESSAGE_QUEUE *MessageQueue, MESSAGE_QUEUE_NODE
 	}
 	else
 	{
-		MESSAGE_QUEUE_NODE *NodeIterator;
-
-		// start at the beginning since we know there is at least one node
-		NodeIterator = MessageQueue->MessageQueueData;
-
-		// now iterate through and put the new node at the end of the queue
-		while (NodeIterator->NextMessageQueueNode != (void*)NULL)
-			NodeIterator = (MESSAGE_QUEUE_NODE*)NodeIterator->NextMessageQueueNode;
-
-		// now point to the new data
-		NodeIterator->NextMessageQueueNode = (void*)Node;
+		// the tail is the last node, so no need to walk the queue to find it
+		MessageQueue->MessageQueueDataEnd->NextMessageQueueNode = (void*)Node;
 	}
 
-	#if (USING_MESSAGE_QUEUE_GET_SIZE_FROM_ISR_METHOD == 1)
-		// now that the data was added lets increase the size
-		MessageQueue->MessageQueueSize++;
-	#endif // end of #if (USING_MESSAGE_QUEUE_GET_SIZE_FROM_ISR_METHOD == 1)
+	// the new node is always the last one
+	MessageQueue->MessageQueueDataEnd = Node;
+
+	// now that the data was added lets increase the size
+	MessageQueue->MessageQueueSize++;
 }
 
 MESSAGE_QUEUE *CreateMessageQueue(	MESSAGE_QUEUE *MessageQueue
@@ -124,10 +139,6 @@ MESSAGE_QUEUE *CreateMessageQueue(	MESSAGE_QUEUE *MessageQueue
 		NewMessageQueue->MessageQueueFreeMethod = MessageQueueFreeMethod;
 	#endif // end of #if (USING_MESSAGE_QUEUE_ADDITIONAL_DATA_FREE_METHOD == 1)
 
-	#if (USING_MESSAGE_QUEUE_GET_SIZE_FROM_ISR_METHOD == 1)
-		NewMessageQueue->MessageQueueSize = 0;
-	#endif // end of #if (USING_MESSAGE_QUEUE_GET_SIZE_FROM_ISR_METHOD == 1)
-
 	#if (USING_MESSAGE_QUEUE_WAIT_FOR_DATA_METHOD == 1)
 		InitializeDoubleLinkedListHead(&NewMessageQueue->BlockedListHead);
 	#endif // end of #if (USING_MESSAGE_QUEUE_WAIT_FOR_DATA_METHOD == 1)
@@ -136,7 +147,8 @@ MESSAGE_QUEUE *CreateMessageQueue(	MESSAGE_QUEUE *MessageQueue
         NewMessageQueue->BlockDeleteCount = 0;
     #endif // end of #if (USING_MESSAGE_QUEUE_DELETE_FROM_ISR_METHOD == 1)
 
-	NewMessageQueue->MessageQueueData = (MESSAGE_QUEUE_NODE*)NULL;
+	NewMessageQueue->MessageQueueData = NewMessageQueue->MessageQueueDataEnd = (MESSAGE_QUEUE_NODE*)NULL;
+	NewMessageQueue->MessageQueueSize = 0;
 
 	return NewMessageQueue;
 }
@@ -217,11 +229,11 @@ MESSAGE_QUEUE *CreateMessageQueue(	MESSAGE_QUEUE *MessageQueue
 			#if (USING_TASK_DELAY_TICKS_METHOD == 1)
 				if (TimeoutInTicks > 0)
 				{
-					gCurrentTask->DelayInTicks = 0;
-
 					// if we timed out just exit with an error
 					if (gCurrentTask->DelayInTicks == TASK_TIMEOUT_DONE_VALUE)
 					{
+						gCurrentTask->DelayInTicks = 0;
+
 						// we timed out
 						ExitCritical();
 
@@ -440,7 +452,7 @@ OS_RESULT MessageQueueAddFromISR(	MESSAGE_QUEUE *MessageQueue
         #endif // end of #if (USING_MESSAGE_QUEUE_ADDITIONAL_DATA == 1)
     #endif // end of #if (USING_CHECK_MESSAGE_QUEUE_PARAMETERS == 1)
 
-    Node = OS_AllocateMemory(sizeof(MESSAGE_QUEUE_NODE));
+    Node = MessageQueueAllocateNode();
 
     if (Node == (MESSAGE_QUEUE_NODE*)NULL)
         return OS_ALLOCATE_MEMORY_FAILED;
@@ -527,7 +539,7 @@ OS_RESULT MessageQueueAddFromISR(	MESSAGE_QUEUE *MessageQueue
         #endif // end of #if (USING_MESSAGE_QUEUE_MESSAGE_CODE_DATA == 1)
 
 		// now clear our the MESSAGE_QUEUE_NODE itself!
-		if (OS_ReleaseMemory((void*)Node) == FALSE)
+		if (MessageQueueReleaseNode(Node) == FALSE)
 			return OS_FREE_MEMORY_FAILED;
 
 		return OS_SUCCESS;
@@ -631,7 +643,7 @@ OS_RESULT MessageQueueAddFromISR(	MESSAGE_QUEUE *MessageQueue
 			#endif // end of #if (USING_MESSAGE_QUEUE_ADDITIONAL_DATA == 1)
 
 			// now clear our the MESSAGE_QUEUE_NODE itself!
-			if (OS_ReleaseMemory((void*)Node) == FALSE)
+			if (MessageQueueReleaseNode(Node) == FALSE)
 				return OS_FREE_MEMORY_FAILED;
 		}
 
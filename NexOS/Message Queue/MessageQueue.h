@@ -29,6 +29,8 @@
 		A MESSAGE_QUEUE uses the OS heap to allocate data on the fly.  Each time data is added to the
 		MESSAGE_QUEUE space from the OS heap is used to store the data.  This allows a MESSAGE_QUEUE
 		to grow dynamically at runtime as needed.
+		If USING_MESSAGE_QUEUE_MEMORY_POOL is set to a 1 the nodes instead come from a fixed
+		MEMORY_POOL shared by every MESSAGE_QUEUE.
 
 		The MESSAGE_QUEUE is designed to be used by one consumer and one producer.  However, this 
 		behavior is not enforced by the OS.  A TASK can block waiting for data from the MESSAGE_QUEUE, 
@@ -60,11 +62,9 @@ typedef struct
 
 typedef struct
 {
-	MESSAGE_QUEUE_NODE *MessageQueueData;
-
-	#if (USING_MESSAGE_QUEUE_GET_SIZE_FROM_ISR_METHOD == 1)
-		UINT32 MessageQueueSize;
-	#endif // end of #if (USING_MESSAGE_QUEUE_GET_SIZE_FROM_ISR_METHOD == 1)
+	MESSAGE_QUEUE_NODE *MessageQueueData; // the head of the queue, nodes are removed from here
+	MESSAGE_QUEUE_NODE *MessageQueueDataEnd; // the tail of the queue, nodes are added here
+	UINT32 MessageQueueSize; // how many nodes are in the queue
 
 	#if (USING_MESSAGE_QUEUE_FREE_DATA_FROM_ISR_METHOD == 1)
 		BOOL(*MessageQueueFreeMethod)(void *); // this optionally points to a method to free data in a node when clear is called.
@@ -743,4 +743,33 @@ OS_RESULT MessageQueueFreeDataFromISR(MESSAGE_QUEUE *MessageQueue, void *Data);
 */
 OS_RESULT MessageQueueDeleteFromISR(MESSAGE_QUEUE *MessageQueue);
 
+/*
+	void OS_InitializeMessageQueueMemoryPool(void)
+
+	Description: This method creates the MEMORY_POOL every MESSAGE_QUEUE takes its
+	nodes from.
+
+	Blocking: No
+
+	User Callable: No
+
+	Arguments:
+		None
+
+	Returns:
+		None
+
+	Notes:
+		- This is called by InitOS() and should never be called by the user.
+
+		- USING_MESSAGE_QUEUE_MEMORY_POOL inside of RTOSConfig.h must
+		  be defined as a 1 to use this method.
+
+	See Also:
+		- CreateMemoryPool()
+*/
+#if (USING_MESSAGE_QUEUE_MEMORY_POOL == 1)
+	void OS_InitializeMessageQueueMemoryPool(void);
+#endif // end of #if (USING_MESSAGE_QUEUE_MEMORY_POOL == 1)
+
 #endif // end of #ifndef MESSAGE_QUEUE_H
\ No newline at end of file
@@ -64,7 +64,13 @@ static BOOL OS_TryPipeRead(PIPE *Pipe, BYTE **Data, UINT32 *TotalBytesRead, UINT
 	return FALSE;
 }
 
-PIPE *CreatePipe(PIPE *Pipe, BYTE *Buffer, UINT32 CapacityInBytes)
+PIPE *CreatePipe(PIPE *Pipe, BYTE *Buffer, UINT32 CapacityInBytes
+
+                #if (USING_PIPE_OVERWRITE_MODE == 1)
+                    , BOOL OverwriteOldest
+                #endif // end of #if (USING_PIPE_OVERWRITE_MODE == 1)
+
+                )
 {
 	PIPE *NewPipe;
 
@@ -94,7 +100,15 @@ PIPE *CreatePipe(PIPE *Pipe, BYTE *Buffer, UINT32 CapacityInBytes)
 	}
 
 	// now we know we have a valid pipe handle, lets see about the generic buffer
-	if (CreateGenericBuffer(&NewPipe->GenericBuffer, CapacityInBytes, Buffer) == (GENERIC_BUFFER*)NULL)
+	if (CreateGenericBuffer(&NewPipe->GenericBuffer, CapacityInBytes, Buffer
+
+                            #if (USING_PIPE_OVERWRITE_MODE == 1)
+                                , OverwriteOldest
+                            #elif (USING_GENERIC_BUFFER_OVERWRITE_MODE == 1)
+                                , FALSE
+                            #endif // end of #if (USING_PIPE_OVERWRITE_MODE == 1)
+
+                            ) == (GENERIC_BUFFER*)NULL)
 	{
 		// we failed for whatever reason, now we have to free the pipe if it was allocated on the heap
 		if (Pipe == (PIPE*)NULL)
@@ -487,6 +501,21 @@ OS_RESULT PipeRead(PIPE *Pipe, BYTE *Data, UINT32 BufferSizeInBytes, UINT32 Byte
 	}
 #endif // end of #if (USING_PIPE_CONTAINS_SEQUENCE_METHOD == 1)
 
+#if (USING_PIPE_SEARCH_METHOD == 1)
+	UINT32 PipeSearch(PIPE *Pipe, GENERIC_BUFFER_SEARCH *Search, UINT32 *PatternIndex)
+	{
+		UINT32 ReturnValue;
+
+		EnterCritical();
+
+		ReturnValue = PipeSearchFromISR(Pipe, Search, PatternIndex);
+
+		ExitCritical();
+
+		return ReturnValue;
+	}
+#endif // end of #if (USING_PIPE_SEARCH_METHOD == 1)
+
 #if (USING_PIPE_SEEK_METHOD == 1)
 	UINT32 PipeSeek(PIPE *Pipe, BYTE Value)
 	{
@@ -547,6 +576,21 @@ OS_RESULT PipeRead(PIPE *Pipe, BYTE *Data, UINT32 BufferSizeInBytes, UINT32 Byte
 	}
 #endif // end of #if (USING_PIPE_GET_REMAINING_BYTES_METHOD == 1)
 
+#if (USING_PIPE_OVERWRITE_MODE == 1)
+	UINT32 PipeGetBytesDropped(PIPE *Pipe)
+	{
+		UINT32 ReturnValue;
+
+		EnterCritical();
+
+		ReturnValue = PipeGetBytesDroppedFromISR(Pipe);
+
+		ExitCritical();
+
+		return ReturnValue;
+	}
+#endif // end of #if (USING_PIPE_OVERWRITE_MODE == 1)
+
 #if (USING_PIPE_DELETE_METHOD == 1)
 	OS_RESULT PipeDelete(PIPE *Pipe, BOOL FreeBufferSpace)
 	{
@@ -562,6 +606,104 @@ OS_RESULT PipeRead(PIPE *Pipe, BYTE *Data, UINT32 BufferSizeInBytes, UINT32 Byte
 	}
 #endif // end of #if (USING_PIPE_DELETE_METHOD == 1)
 
+#if (USING_PIPE_SPAN_METHODS == 1)
+	OS_RESULT PipeGetWriteSpan(PIPE *Pipe, BYTE **Span, UINT32 *SpanSizeInBytes)
+	{
+		OS_RESULT Result;
+
+		EnterCritical();
+
+		Result = PipeGetWriteSpanFromISR(Pipe, Span, SpanSizeInBytes);
+
+		ExitCritical();
+
+		return Result;
+	}
+
+	OS_RESULT PipeCommitWrite(PIPE *Pipe, UINT32 BytesToCommit)
+	{
+		OS_RESULT Result;
+		BOOL HigherPriorityTask = FALSE;
+
+		EnterCritical();
+
+		Result = PipeCommitWriteFromISR(Pipe, BytesToCommit, &HigherPriorityTask);
+
+		if (HigherPriorityTask == TRUE)
+			SurrenderCPU();
+
+		ExitCritical();
+
+		return Result;
+	}
+
+	OS_RESULT PipeGetReadSpan(PIPE *Pipe, BYTE **Span, UINT32 *SpanSizeInBytes)
+	{
+		OS_RESULT Result;
+
+		EnterCritical();
+
+		Result = PipeGetReadSpanFromISR(Pipe, Span, SpanSizeInBytes);
+
+		ExitCritical();
+
+		return Result;
+	}
+
+	OS_RESULT PipeConsume(PIPE *Pipe, UINT32 BytesToConsume)
+	{
+		OS_RESULT Result;
+		BOOL HigherPriorityTask = FALSE;
+
+		EnterCritical();
+
+		Result = PipeConsumeFromISR(Pipe, BytesToConsume, &HigherPriorityTask);
+
+		if (HigherPriorityTask == TRUE)
+			SurrenderCPU();
+
+		ExitCritical();
+
+		return Result;
+	}
+#endif // end of #if (USING_PIPE_SPAN_METHODS == 1)
+
+#if (USING_PIPE_VECTOR_METHODS == 1)
+	OS_RESULT PipeWriteVector(PIPE *Pipe, const GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, BOOL AllOrNothing, UINT32 *BytesWritten)
+	{
+		OS_RESULT Result;
+		BOOL HigherPriorityTask = FALSE;
+
+		EnterCritical();
+
+		Result = PipeWriteVectorFromISR(Pipe, Vectors, NumberOfVectors, AllOrNothing, BytesWritten, &HigherPriorityTask);
+
+		if (HigherPriorityTask == TRUE)
+			SurrenderCPU();
+
+		ExitCritical();
+
+		return Result;
+	}
+
+	OS_RESULT PipeReadVector(PIPE *Pipe, GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, BOOL AllOrNothing, UINT32 *BytesRead)
+	{
+		OS_RESULT Result;
+		BOOL HigherPriorityTask = FALSE;
+
+		EnterCritical();
+
+		Result = PipeReadVectorFromISR(Pipe, Vectors, NumberOfVectors, AllOrNothing, BytesRead, &HigherPriorityTask);
+
+		if (HigherPriorityTask == TRUE)
+			SurrenderCPU();
+
+		ExitCritical();
+
+		return Result;
+	}
+#endif // end of #if (USING_PIPE_VECTOR_METHODS == 1)
+
 OS_RESULT PipeWriteFromISR(PIPE *Pipe, BYTE *Data, UINT32 BytesToWrite, UINT32 *BytesWritten, BOOL *HigherPriorityTask)
 {
     #if (USING_CHECK_PIPE_PARAMETERS == 1)
@@ -723,6 +865,21 @@ OS_RESULT PipeReadFromISR(PIPE *Pipe, BYTE *Data, UINT32 BufferSizeInBytes, UINT
 	}
 #endif // end of #if (USING_PIPE_CONTAINS_SEQUENCE_FROM_ISR_METHOD == 1)
 
+#if (USING_PIPE_SEARCH_FROM_ISR_METHOD == 1)
+	UINT32 PipeSearchFromISR(PIPE *Pipe, GENERIC_BUFFER_SEARCH *Search, UINT32 *PatternIndex)
+	{
+        #if (USING_CHECK_PIPE_PARAMETERS == 1)
+            if (RAMAddressValid((OS_WORD)Pipe) == FALSE)
+                return INVALID_PIPE_SIZE;
+
+            if (RAMAddressValid((OS_WORD)Search) == FALSE)
+                return INVALID_PIPE_SIZE;
+        #endif // end of #if (USING_CHECK_PIPE_PARAMETERS == 1)
+
+		return GenericBufferSearch(&Pipe->GenericBuffer, Search, PatternIndex);
+	}
+#endif // end of #if (USING_PIPE_SEARCH_FROM_ISR_METHOD == 1)
+
 #if (USING_PIPE_SEEK_FROM_ISR_METHOD == 1)
 	UINT32 PipeSeekFromISR(PIPE *Pipe, BYTE Value)
 	{
@@ -772,6 +929,18 @@ OS_RESULT PipeReadFromISR(PIPE *Pipe, BYTE *Data, UINT32 BufferSizeInBytes, UINT
 	}
 #endif // end of #if (USING_PIPE_GET_REMAINING_BYTES_FROM_ISR_METHOD == 1)
 
+#if (USING_PIPE_OVERWRITE_MODE == 1)
+	UINT32 PipeGetBytesDroppedFromISR(PIPE *Pipe)
+	{
+        #if (USING_CHECK_PIPE_PARAMETERS == 1)
+            if (RAMAddressValid((OS_WORD)Pipe) == FALSE)
+                return INVALID_PIPE_SIZE;
+        #endif // end of #if (USING_CHECK_PIPE_PARAMETERS == 1)
+
+		return GenericBufferGetBytesDropped(&Pipe->GenericBuffer);
+	}
+#endif // end of #if (USING_PIPE_OVERWRITE_MODE == 1)
+
 #if (USING_PIPE_DELETE_FROM_ISR_METHOD == 1)
 	OS_RESULT PipeDeleteFromISR(PIPE *Pipe, BOOL FreeBufferSpace)
 	{
@@ -802,3 +971,163 @@ OS_RESULT PipeReadFromISR(PIPE *Pipe, BYTE *Data, UINT32 BufferSizeInBytes, UINT
 		return OS_SUCCESS;
 	}
 #endif // end of #if (USING_PIPE_DELETE_FROM_ISR_METHOD == 1)
+
+#if (USING_PIPE_SPAN_FROM_ISR_METHODS == 1)
+	OS_RESULT PipeGetWriteSpanFromISR(PIPE *Pipe, BYTE **Span, UINT32 *SpanSizeInBytes)
+	{
+        #if (USING_CHECK_PIPE_PARAMETERS == 1)
+            if (RAMAddressValid((OS_WORD)Pipe) == FALSE)
+                return OS_INVALID_ARGUMENT_ADDRESS;
+
+            if (RAMAddressValid((OS_WORD)Span) == FALSE)
+                return OS_INVALID_ARGUMENT_ADDRESS;
+
+            if (RAMAddressValid((OS_WORD)SpanSizeInBytes) == FALSE)
+                return OS_INVALID_ARGUMENT_ADDRESS;
+        #endif // end of #if (USING_CHECK_PIPE_PARAMETERS == 1)
+
+		*Span = GenericBufferGetWriteSpan(&Pipe->GenericBuffer, SpanSizeInBytes);
+
+		if (*SpanSizeInBytes == 0)
+			return OS_RESOURCE_FULL;
+
+		return OS_SUCCESS;
+	}
+
+	OS_RESULT PipeCommitWriteFromISR(PIPE *Pipe, UINT32 BytesToCommit, BOOL *HigherPriorityTask)
+	{
+		UINT32 BytesCommitted;
+
+        #if (USING_CHECK_PIPE_PARAMETERS == 1)
+            if (RAMAddressValid((OS_WORD)Pipe) == FALSE)
+                return OS_INVALID_ARGUMENT_ADDRESS;
+
+            if (RAMAddressValid((OS_WORD)HigherPriorityTask) == FALSE)
+                return OS_INVALID_ARGUMENT_ADDRESS;
+        #endif // end of #if (USING_CHECK_PIPE_PARAMETERS == 1)
+
+		BytesCommitted = GenericBufferCommitWrite(&Pipe->GenericBuffer, BytesToCommit);
+
+		// new data is in the PIPE, let any blocked readers have a go at it
+		if (BytesCommitted != 0)
+			*HigherPriorityTask = OS_AddTaskListToReadyQueue(&Pipe->PipeBlockedListHead);
+		else
+			*HigherPriorityTask = FALSE;
+
+		if (BytesCommitted != BytesToCommit)
+			return OS_RESOURCE_INSUFFICIENT_SPACE;
+
+		return OS_SUCCESS;
+	}
+
+	OS_RESULT PipeGetReadSpanFromISR(PIPE *Pipe, BYTE **Span, UINT32 *SpanSizeInBytes)
+	{
+        #if (USING_CHECK_PIPE_PARAMETERS == 1)
+            if (RAMAddressValid((OS_WORD)Pipe) == FALSE)
+                return OS_INVALID_ARGUMENT_ADDRESS;
+
+            if (RAMAddressValid((OS_WORD)Span) == FALSE)
+                return OS_INVALID_ARGUMENT_ADDRESS;
+
+            if (RAMAddressValid((OS_WORD)SpanSizeInBytes) == FALSE)
+                return OS_INVALID_ARGUMENT_ADDRESS;
+        #endif // end of #if (USING_CHECK_PIPE_PARAMETERS == 1)
+
+		*Span = GenericBufferGetReadSpan(&Pipe->GenericBuffer, SpanSizeInBytes);
+
+		if (*SpanSizeInBytes == 0)
+			return OS_RESOURCE_HAS_NO_DATA;
+
+		return OS_SUCCESS;
+	}
+
+	OS_RESULT PipeConsumeFromISR(PIPE *Pipe, UINT32 BytesToConsume, BOOL *HigherPriorityTask)
+	{
+		UINT32 BytesConsumed;
+
+        #if (USING_CHECK_PIPE_PARAMETERS == 1)
+            if (RAMAddressValid((OS_WORD)Pipe) == FALSE)
+                return OS_INVALID_ARGUMENT_ADDRESS;
+
+            if (RAMAddressValid((OS_WORD)HigherPriorityTask) == FALSE)
+                return OS_INVALID_ARGUMENT_ADDRESS;
+        #endif // end of #if (USING_CHECK_PIPE_PARAMETERS == 1)
+
+		BytesConsumed = GenericBufferConsume(&Pipe->GenericBuffer, BytesToConsume);
+
+		// space was freed up, let any blocked writers have a go at it
+		if (BytesConsumed != 0)
+			*HigherPriorityTask = OS_AddTaskListToReadyQueue(&Pipe->PipeBlockedListHead);
+		else
+			*HigherPriorityTask = FALSE;
+
+		if (BytesConsumed != BytesToConsume)
+			return OS_RESOURCE_INSUFFICIENT_DATA;
+
+		return OS_SUCCESS;
+	}
+#endif // end of #if (USING_PIPE_SPAN_FROM_ISR_METHODS == 1)
+
+#if (USING_PIPE_VECTOR_FROM_ISR_METHODS == 1)
+	OS_RESULT PipeWriteVectorFromISR(PIPE *Pipe, const GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, BOOL AllOrNothing, UINT32 *BytesWritten, BOOL *HigherPriorityTask)
+	{
+        #if (USING_CHECK_PIPE_PARAMETERS == 1)
+            if (RAMAddressValid((OS_WORD)Pipe) == FALSE)
+                return OS_INVALID_ARGUMENT_ADDRESS;
+
+            if (RAMAddressValid((OS_WORD)Vectors) == FALSE)
+                return OS_INVALID_ARGUMENT_ADDRESS;
+
+            if (RAMAddressValid((OS_WORD)BytesWritten) == FALSE)
+                return OS_INVALID_ARGUMENT_ADDRESS;
+
+            if (RAMAddressValid((OS_WORD)HigherPriorityTask) == FALSE)
+                return OS_INVALID_ARGUMENT_ADDRESS;
+        #endif // end of #if (USING_CHECK_PIPE_PARAMETERS == 1)
+
+		*BytesWritten = GenericBufferWriteVector(&Pipe->GenericBuffer, Vectors, NumberOfVectors, AllOrNothing);
+
+		// all the segments went in together, so the readers only need waking once
+		if (*BytesWritten != 0)
+			*HigherPriorityTask = OS_AddTaskListToReadyQueue(&Pipe->PipeBlockedListHead);
+		else
+			*HigherPriorityTask = FALSE;
+
+		// fewer bytes than the segments add up to were moved
+		if (GenericBufferVectorFits(Vectors, NumberOfVectors, *BytesWritten) == FALSE)
+			return OS_RESOURCE_INSUFFICIENT_SPACE;
+
+		return OS_SUCCESS;
+	}
+
+	OS_RESULT PipeReadVectorFromISR(PIPE *Pipe, GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, BOOL AllOrNothing, UINT32 *BytesRead, BOOL *HigherPriorityTask)
+	{
+        #if (USING_CHECK_PIPE_PARAMETERS == 1)
+            if (RAMAddressValid((OS_WORD)Pipe) == FALSE)
+                return OS_INVALID_ARGUMENT_ADDRESS;
+
+            if (RAMAddressValid((OS_WORD)Vectors) == FALSE)
+                return OS_INVALID_ARGUMENT_ADDRESS;
+
+            if (RAMAddressValid((OS_WORD)BytesRead) == FALSE)
+                return OS_INVALID_ARGUMENT_ADDRESS;
+
+            if (RAMAddressValid((OS_WORD)HigherPriorityTask) == FALSE)
+                return OS_INVALID_ARGUMENT_ADDRESS;
+        #endif // end of #if (USING_CHECK_PIPE_PARAMETERS == 1)
+
+		*BytesRead = GenericBufferReadVector(&Pipe->GenericBuffer, Vectors, NumberOfVectors, AllOrNothing);
+
+		// space was freed up, let any blocked writers have a go at it
+		if (*BytesRead != 0)
+			*HigherPriorityTask = OS_AddTaskListToReadyQueue(&Pipe->PipeBlockedListHead);
+		else
+			*HigherPriorityTask = FALSE;
+
+		// fewer bytes than the segments add up to were moved
+		if (GenericBufferVectorFits(Vectors, NumberOfVectors, *BytesRead) == FALSE)
+			return OS_RESOURCE_INSUFFICIENT_DATA;
+
+		return OS_SUCCESS;
+	}
+#endif // end of #if (USING_PIPE_VECTOR_FROM_ISR_METHODS == 1)
@@ -43,6 +43,40 @@
 #include "../Kernel/Kernel.h"
 #include "../../Generic Libraries/Generic Buffer/GenericBuffer.h"
 
+#if (USING_PIPE_SPAN_METHODS == 1 || USING_PIPE_SPAN_FROM_ISR_METHODS == 1)
+    #if (USING_GENERIC_BUFFER_SPAN_METHODS != 1)
+        #error "USING_GENERIC_BUFFER_SPAN_METHODS must be defined as a 1 in GenericBufferConfig.h to use the PIPE span methods"
+    #endif // end of #if (USING_GENERIC_BUFFER_SPAN_METHODS != 1)
+#endif // end of #if (USING_PIPE_SPAN_METHODS == 1 || USING_PIPE_SPAN_FROM_ISR_METHODS == 1)
+
+#if (USING_PIPE_SPAN_METHODS == 1 && USING_PIPE_SPAN_FROM_ISR_METHODS != 1)
+    #error "USING_PIPE_SPAN_FROM_ISR_METHODS must be defined as a 1 in RTOSConfig.h to use USING_PIPE_SPAN_METHODS"
+#endif // end of #if (USING_PIPE_SPAN_METHODS == 1 && USING_PIPE_SPAN_FROM_ISR_METHODS != 1)
+
+#if (USING_PIPE_SEARCH_METHOD == 1 || USING_PIPE_SEARCH_FROM_ISR_METHOD == 1)
+    #if (USING_GENERIC_BUFFER_SEARCH_METHODS != 1)
+        #error "USING_GENERIC_BUFFER_SEARCH_METHODS must be defined as a 1 in GenericBufferConfig.h to use the PIPE search methods"
+    #endif // end of #if (USING_GENERIC_BUFFER_SEARCH_METHODS != 1)
+#endif // end of #if (USING_PIPE_SEARCH_METHOD == 1 || USING_PIPE_SEARCH_FROM_ISR_METHOD == 1)
+
+#if (USING_PIPE_SEARCH_METHOD == 1 && USING_PIPE_SEARCH_FROM_ISR_METHOD != 1)
+    #error "USING_PIPE_SEARCH_FROM_ISR_METHOD must be defined as a 1 in RTOSConfig.h to use USING_PIPE_SEARCH_METHOD"
+#endif // end of #if (USING_PIPE_SEARCH_METHOD == 1 && USING_PIPE_SEARCH_FROM_ISR_METHOD != 1)
+
+#if (USING_PIPE_VECTOR_METHODS == 1 || USING_PIPE_VECTOR_FROM_ISR_METHODS == 1)
+    #if (USING_GENERIC_BUFFER_VECTOR_METHODS != 1)
+        #error "USING_GENERIC_BUFFER_VECTOR_METHODS must be defined as a 1 in GenericBufferConfig.h to use the PIPE vector methods"
+    #endif // end of #if (USING_GENERIC_BUFFER_VECTOR_METHODS != 1)
+#endif // end of #if (USING_PIPE_VECTOR_METHODS == 1 || USING_PIPE_VECTOR_FROM_ISR_METHODS == 1)
+
+#if (USING_PIPE_VECTOR_METHODS == 1 && USING_PIPE_VECTOR_FROM_ISR_METHODS != 1)
+    #error "USING_PIPE_VECTOR_FROM_ISR_METHODS must be defined as a 1 in RTOSConfig.h to use USING_PIPE_VECTOR_METHODS"
+#endif // end of #if (USING_PIPE_VECTOR_METHODS == 1 && USING_PIPE_VECTOR_FROM_ISR_METHODS != 1)
+
+#if (USING_PIPE_OVERWRITE_MODE == 1 && USING_GENERIC_BUFFER_OVERWRITE_MODE != 1)
+    #error "USING_GENERIC_BUFFER_OVERWRITE_MODE must be defined as a 1 in GenericBufferConfig.h to use USING_PIPE_OVERWRITE_MODE"
+#endif // end of #if (USING_PIPE_OVERWRITE_MODE == 1 && USING_GENERIC_BUFFER_OVERWRITE_MODE != 1)
+
 #define INVALID_PIPE_SIZE                                   0xFFFFFFFF
 
 typedef struct
@@ -61,7 +95,7 @@ typedef struct
 }PIPE;
 
 /*
-	PIPE *CreatePipe(PIPE *Pipe, BYTE *Buffer, UINT32 CapacityInBytes)
+	PIPE *CreatePipe(PIPE *Pipe, BYTE *Buffer, UINT32 CapacityInBytes, BOOL OverwriteOldest)
 
 	Description: This method creates a PIPE.  A PIPE can be used by 2 or more
     TASK's to communicate data.  The relationship between TASK's and a PIPE is not
@@ -81,17 +115,27 @@ typedef struct
         in the OS heap.  The size of the space allocated in the OS heap will be CapacityInBytes.
  
         UINT32 CapacityInBytes - The size of the buffer pointed to by BYTE *Buffer or to be created.
+
+        BOOL OverwriteOldest - If TRUE a write which does not fit drops the oldest data
+        in the PIPE to make room, so writers never block.  If FALSE writers wait for space.
  
 	Returns:
 		PIPE * - A pointer to a valid PIPE if successful, (PIPE*)NULL upon failure.
 
 	Notes:
-		- None
+		- OverwriteOldest is only present if USING_PIPE_OVERWRITE_MODE inside of
+          RTOSConfig.h is defined as a 1.
 
 	See Also:
-		- PipeDelete()
+		- PipeDelete(), PipeGetBytesDropped()
 */
-PIPE *CreatePipe(PIPE *Pipe, BYTE *Buffer, UINT32 CapacityInBytes);
+PIPE *CreatePipe(PIPE *Pipe, BYTE *Buffer, UINT32 CapacityInBytes
+
+                #if (USING_PIPE_OVERWRITE_MODE == 1)
+                    , BOOL OverwriteOldest
+                #endif // end of #if (USING_PIPE_OVERWRITE_MODE == 1)
+
+                );
 
 /*
 	OS_RESULT PipeWrite(PIPE *Pipe, BYTE *Data, UINT32 BytesToWrite, UINT32 *BytesWritten, INT32 TimeoutInTicks)
@@ -322,6 +366,40 @@ UINT32 PipeContains(PIPE *Pipe, BYTE Value);
 */
 OS_RESULT PipeContainsSequence(PIPE *Pipe, BYTE *Sequence, UINT32 SequenceSize);
 
+/*
+	UINT32 PipeSearch(PIPE *Pipe, GENERIC_BUFFER_SEARCH *Search, UINT32 *PatternIndex)
+
+	Description: This method will search a PIPE for the patterns in a GENERIC_BUFFER_SEARCH.
+    Only the bytes written since the last search are looked at, so this can be called
+    every time a few bytes arrive without searching the whole PIPE again.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		PIPE *Pipe - A pointer to a valid PIPE which was returned from CreatePipe().
+  
+        GENERIC_BUFFER_SEARCH *Search - A GENERIC_BUFFER_SEARCH which was set up with
+        CreateGenericBufferSearch() and GenericBufferSearchAddPattern().
+  
+        UINT32 *PatternIndex - The index of the pattern found is stored here, this can be NULL.
+ 
+	Returns:
+		UINT32 - How many bytes deep the end of the first pattern found is in the PIPE,
+        or 0 if not found.  Reading this many bytes reads through the pattern.
+
+	Notes:
+        - USING_PIPE_SEARCH_METHOD inside of RTOSConfig.h must
+          be defined as a 1 to use this method.
+
+	See Also:
+		- PipeContainsSequence(), PipeSearchFromISR()
+*/
+#if (USING_PIPE_SEARCH_METHOD == 1)
+    UINT32 PipeSearch(PIPE *Pipe, GENERIC_BUFFER_SEARCH *Search, UINT32 *PatternIndex);
+#endif // end of #if (USING_PIPE_SEARCH_METHOD == 1)
+
 /*
 	UINT32 PipeSeek(PIPE *Pipe, BYTE Value)
 
@@ -423,6 +501,34 @@ UINT32 PipeGetCapacity(PIPE *Pipe);
 */
 UINT32 PipeGetRemainingBytes(PIPE *Pipe);
 
+/*
+	UINT32 PipeGetBytesDropped(PIPE *Pipe)
+
+	Description: This method will return how many bytes a PIPE created with
+    OverwriteOldest as TRUE has dropped to make room for newer data.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		PIPE *Pipe - A pointer to a valid PIPE which was returned from CreatePipe().
+ 
+	Returns:
+		UINT32 - The total number of bytes dropped.  This wraps back around to 0,
+        take the difference of two calls to see how many were dropped in between.
+
+	Notes:
+        - USING_PIPE_OVERWRITE_MODE inside of RTOSConfig.h must
+          be defined as a 1 to use this method.
+
+	See Also:
+		- CreatePipe(), PipeGetBytesDroppedFromISR()
+*/
+#if (USING_PIPE_OVERWRITE_MODE == 1)
+    UINT32 PipeGetBytesDropped(PIPE *Pipe);
+#endif // end of #if (USING_PIPE_OVERWRITE_MODE == 1)
+
 /*
 	OS_RESULT PipeDelete(PIPE *Pipe, BOOL FreeBufferSpace)
 
@@ -451,6 +557,212 @@ UINT32 PipeGetRemainingBytes(PIPE *Pipe);
 */
 OS_RESULT PipeDelete(PIPE *Pipe, BOOL FreeBufferSpace);
 
+/*
+	OS_RESULT PipeGetWriteSpan(PIPE *Pipe, BYTE **Span, UINT32 *SpanSizeInBytes)
+
+	Description: This method returns the largest run of free space inside the PIPE
+    which does not wrap around the end of its buffer.  The data can be placed there
+    directly and then added to the PIPE with PipeCommitWrite(), which saves copying
+    it through a buffer of your own.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		PIPE *Pipe - A pointer to a valid PIPE which was returned from CreatePipe().
+ 
+        BYTE **Span - The address of the free space is stored here.  If the PIPE
+        is full (BYTE*)NULL is stored.
+
+        UINT32 *SpanSizeInBytes - The number of bytes which can be written to the span
+        is stored here.
+ 
+	Returns:
+		OS_RESULT - OS_SUCCESS if a span was returned, OS_RESOURCE_FULL if the PIPE has
+        no free space.
+
+	Notes:
+        - USING_PIPE_SPAN_METHODS inside of RTOSConfig.h must
+          be defined as a 1 to use this method.
+
+        - Only one TASK or ISR can be filling a write span at a time.  Nothing else
+          should write to the PIPE until the span is committed.
+
+	See Also:
+		- PipeCommitWrite(), PipeGetReadSpan()
+*/
+OS_RESULT PipeGetWriteSpan(PIPE *Pipe, BYTE **Span, UINT32 *SpanSizeInBytes);
+
+/*
+	OS_RESULT PipeCommitWrite(PIPE *Pipe, UINT32 BytesToCommit)
+
+	Description: This method adds the bytes placed in a span from PipeGetWriteSpan()
+    to the PIPE.  Any TASKs blocked on the PIPE are made ready.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		PIPE *Pipe - A pointer to a valid PIPE which was returned from CreatePipe().
+ 
+        UINT32 BytesToCommit - The number of bytes written into the span.
+ 
+	Returns:
+		OS_RESULT - OS_SUCCESS if all the bytes were committed, OS_RESOURCE_INSUFFICIENT_SPACE
+        if BytesToCommit was larger than the span and only the span was committed.
+
+	Notes:
+        - USING_PIPE_SPAN_METHODS inside of RTOSConfig.h must
+          be defined as a 1 to use this method.
+
+	See Also:
+		- PipeGetWriteSpan()
+*/
+OS_RESULT PipeCommitWrite(PIPE *Pipe, UINT32 BytesToCommit);
+
+/*
+	OS_RESULT PipeGetReadSpan(PIPE *Pipe, BYTE **Span, UINT32 *SpanSizeInBytes)
+
+	Description: This method returns the largest run of data inside the PIPE which
+    does not wrap around the end of its buffer.  The data can be used in place and
+    then removed from the PIPE with PipeConsume().
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		PIPE *Pipe - A pointer to a valid PIPE which was returned from CreatePipe().
+ 
+        BYTE **Span - The address of the data is stored here.  If the PIPE is
+        empty (BYTE*)NULL is stored.
+
+        UINT32 *SpanSizeInBytes - The number of bytes in the span is stored here.
+ 
+	Returns:
+		OS_RESULT - OS_SUCCESS if a span was returned, OS_RESOURCE_HAS_NO_DATA if the
+        PIPE is empty.
+
+	Notes:
+        - USING_PIPE_SPAN_METHODS inside of RTOSConfig.h must
+          be defined as a 1 to use this method.
+
+        - Only one TASK or ISR can be working on a read span at a time.  Nothing else
+          should read from the PIPE until the span is consumed.
+
+	See Also:
+		- PipeConsume(), PipeGetWriteSpan()
+*/
+OS_RESULT PipeGetReadSpan(PIPE *Pipe, BYTE **Span, UINT32 *SpanSizeInBytes);
+
+/*
+	OS_RESULT PipeConsume(PIPE *Pipe, UINT32 BytesToConsume)
+
+	Description: This method removes bytes from the PIPE without copying them.  It
+    is used once the data from PipeGetReadSpan() has been handled, but it can also
+    throw away data which isn't wanted.  Any TASKs blocked on the PIPE are made ready.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		PIPE *Pipe - A pointer to a valid PIPE which was returned from CreatePipe().
+ 
+        UINT32 BytesToConsume - The number of bytes to remove from the PIPE.
+ 
+	Returns:
+		OS_RESULT - OS_SUCCESS if all the bytes were removed, OS_RESOURCE_INSUFFICIENT_DATA
+        if the PIPE held fewer bytes than BytesToConsume.  Everything in the PIPE is removed
+        in that case.
+
+	Notes:
+        - USING_PIPE_SPAN_METHODS inside of RTOSConfig.h must
+          be defined as a 1 to use this method.
+
+	See Also:
+		- PipeGetReadSpan()
+*/
+OS_RESULT PipeConsume(PIPE *Pipe, UINT32 BytesToConsume);
+
+/*
+	OS_RESULT PipeWriteVector(PIPE *Pipe, const GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, BOOL AllOrNothing, UINT32 *BytesWritten)
+
+	Description: This method writes several separate segments to the PIPE as one piece
+    of data, for example a header and a payload.  The segments are written inside one
+    critical section so no other writer can get in between them, and blocked TASKs are
+    made ready once.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		PIPE *Pipe - A pointer to a valid PIPE which was returned from CreatePipe().
+ 
+        const GENERIC_BUFFER_VECTOR *Vectors - The segments to write, in order.
+
+        UINT32 NumberOfVectors - The number of segments in Vectors.
+
+        BOOL AllOrNothing - If TRUE nothing is written unless all the segments fit in the
+        PIPE.  If FALSE as many bytes as there is room for are written.
+
+        UINT32 *BytesWritten - The number of bytes written is stored here.
+ 
+	Returns:
+		OS_RESULT - OS_SUCCESS if all the segments were written, OS_RESOURCE_INSUFFICIENT_SPACE
+        otherwise.
+
+	Notes:
+        - USING_PIPE_VECTOR_METHODS inside of RTOSConfig.h must
+          be defined as a 1 to use this method.
+
+	See Also:
+		- PipeReadVector(), PipeWrite()
+*/
+#if (USING_PIPE_VECTOR_METHODS == 1)
+    OS_RESULT PipeWriteVector(PIPE *Pipe, const GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, BOOL AllOrNothing, UINT32 *BytesWritten);
+#endif // end of #if (USING_PIPE_VECTOR_METHODS == 1)
+
+/*
+	OS_RESULT PipeReadVector(PIPE *Pipe, GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, BOOL AllOrNothing, UINT32 *BytesRead)
+
+	Description: This method reads from the PIPE into several separate segments inside
+    one critical section, filling each segment before moving on to the next.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		PIPE *Pipe - A pointer to a valid PIPE which was returned from CreatePipe().
+ 
+        GENERIC_BUFFER_VECTOR *Vectors - The segments to read into, in order.
+
+        UINT32 NumberOfVectors - The number of segments in Vectors.
+
+        BOOL AllOrNothing - If TRUE nothing is read unless there is enough data in the
+        PIPE to fill all the segments.  If FALSE as many bytes as there are are read.
+
+        UINT32 *BytesRead - The number of bytes read is stored here.
+ 
+	Returns:
+		OS_RESULT - OS_SUCCESS if all the segments were filled, OS_RESOURCE_INSUFFICIENT_DATA
+        otherwise.
+
+	Notes:
+        - USING_PIPE_VECTOR_METHODS inside of RTOSConfig.h must
+          be defined as a 1 to use this method.
+
+	See Also:
+		- PipeWriteVector(), PipeRead()
+*/
+#if (USING_PIPE_VECTOR_METHODS == 1)
+    OS_RESULT PipeReadVector(PIPE *Pipe, GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, BOOL AllOrNothing, UINT32 *BytesRead);
+#endif // end of #if (USING_PIPE_VECTOR_METHODS == 1)
+
 /*
 	OS_RESULT PipeWriteFromISR(PIPE *Pipe, BYTE *Data, UINT32 BytesToWrite, UINT32 *BytesWritten, BOOL *HigherPriorityTask)
 
@@ -589,6 +901,39 @@ UINT32 PipeContainsFromISR(PIPE *Pipe, BYTE Value);
 */
 OS_RESULT PipeContainsSequenceFromISR(PIPE *Pipe, BYTE *Sequence, UINT32 SequenceSize);
 
+/*
+	UINT32 PipeSearchFromISR(PIPE *Pipe, GENERIC_BUFFER_SEARCH *Search, UINT32 *PatternIndex)
+
+	Description: This method will search a PIPE for the patterns in a GENERIC_BUFFER_SEARCH
+    from an ISR.  Only the bytes written since the last search are looked at.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		PIPE *Pipe - A pointer to a valid PIPE which was returned from CreatePipe().
+  
+        GENERIC_BUFFER_SEARCH *Search - A GENERIC_BUFFER_SEARCH which was set up with
+        CreateGenericBufferSearch() and GenericBufferSearchAddPattern().
+  
+        UINT32 *PatternIndex - The index of the pattern found is stored here, this can be NULL.
+ 
+	Returns:
+		UINT32 - How many bytes deep the end of the first pattern found is in the PIPE,
+        or 0 if not found.
+
+	Notes:
+        - USING_PIPE_SEARCH_FROM_ISR_METHOD inside of RTOSConfig.h must
+          be defined as a 1 to use this method.
+
+	See Also:
+		- PipeSearch()
+*/
+#if (USING_PIPE_SEARCH_FROM_ISR_METHOD == 1)
+    UINT32 PipeSearchFromISR(PIPE *Pipe, GENERIC_BUFFER_SEARCH *Search, UINT32 *PatternIndex);
+#endif // end of #if (USING_PIPE_SEARCH_FROM_ISR_METHOD == 1)
+
 /*
 	OS_RESULT PipeSeekFromISR(PIPE *Pipe, BYTE Value, UINT32 *BytesDeep)
 
@@ -681,6 +1026,34 @@ UINT32 PipeGetCapacityFromISR(PIPE *Pipe);
 */
 UINT32 PipeGetRemainingBytesFromISR(PIPE *Pipe);
 
+/*
+	UINT32 PipeGetBytesDroppedFromISR(PIPE *Pipe)
+
+	Description: This method will return how many bytes a PIPE created with
+    OverwriteOldest as TRUE has dropped to make room for newer data.  This
+    method can be called from an ISR.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		PIPE *Pipe - A pointer to a valid PIPE which was returned from CreatePipe().
+ 
+	Returns:
+		UINT32 - The total number of bytes dropped.  This wraps back around to 0.
+
+	Notes:
+        - USING_PIPE_OVERWRITE_MODE inside of RTOSConfig.h must
+          be defined as a 1 to use this method.
+
+	See Also:
+		- CreatePipe(), PipeGetBytesDropped()
+*/
+#if (USING_PIPE_OVERWRITE_MODE == 1)
+    UINT32 PipeGetBytesDroppedFromISR(PIPE *Pipe);
+#endif // end of #if (USING_PIPE_OVERWRITE_MODE == 1)
+
 /*
 	OS_RESULT PipeDeleteFromISR(PIPE *Pipe, BOOL FreeBufferSpace)
 
@@ -704,4 +1077,197 @@ UINT32 PipeGetRemainingBytesFromISR(PIPE *Pipe);
 */
 OS_RESULT PipeDeleteFromISR(PIPE *Pipe, BOOL FreeBufferSpace);
 
+/*
+	OS_RESULT PipeGetWriteSpanFromISR(PIPE *Pipe, BYTE **Span, UINT32 *SpanSizeInBytes)
+
+	Description: The same as PipeGetWriteSpan() but can be called from an ISR.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		PIPE *Pipe - A pointer to a valid PIPE which was returned from CreatePipe().
+ 
+        BYTE **Span - The address of the free space is stored here.
+
+        UINT32 *SpanSizeInBytes - The number of bytes which can be written to the span
+        is stored here.
+ 
+	Returns:
+		OS_RESULT - OS_SUCCESS if a span was returned, OS_RESOURCE_FULL if the PIPE has
+        no free space.
+
+	Notes:
+        - USING_PIPE_SPAN_FROM_ISR_METHODS inside of RTOSConfig.h must
+          be defined as a 1 to use this method.
+
+	See Also:
+		- PipeCommitWriteFromISR()
+*/
+OS_RESULT PipeGetWriteSpanFromISR(PIPE *Pipe, BYTE **Span, UINT32 *SpanSizeInBytes);
+
+/*
+	OS_RESULT PipeCommitWriteFromISR(PIPE *Pipe, UINT32 BytesToCommit, BOOL *HigherPriorityTask)
+
+	Description: The same as PipeCommitWrite() but can be called from an ISR.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		PIPE *Pipe - A pointer to a valid PIPE which was returned from CreatePipe().
+ 
+        UINT32 BytesToCommit - The number of bytes written into the span.
+
+        BOOL *HigherPriorityTask - Set to TRUE if a TASK of higher priority than
+        the current TASK was made ready.
+ 
+	Returns:
+		OS_RESULT - OS_SUCCESS if all the bytes were committed, OS_RESOURCE_INSUFFICIENT_SPACE
+        if BytesToCommit was larger than the span and only the span was committed.
+
+	Notes:
+        - USING_PIPE_SPAN_FROM_ISR_METHODS inside of RTOSConfig.h must
+          be defined as a 1 to use this method.
+
+	See Also:
+		- PipeGetWriteSpanFromISR()
+*/
+OS_RESULT PipeCommitWriteFromISR(PIPE *Pipe, UINT32 BytesToCommit, BOOL *HigherPriorityTask);
+
+/*
+	OS_RESULT PipeGetReadSpanFromISR(PIPE *Pipe, BYTE **Span, UINT32 *SpanSizeInBytes)
+
+	Description: The same as PipeGetReadSpan() but can be called from an ISR.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		PIPE *Pipe - A pointer to a valid PIPE which was returned from CreatePipe().
+ 
+        BYTE **Span - The address of the data is stored here.
+
+        UINT32 *SpanSizeInBytes - The number of bytes in the span is stored here.
+ 
+	Returns:
+		OS_RESULT - OS_SUCCESS if a span was returned, OS_RESOURCE_HAS_NO_DATA if the
+        PIPE is empty.
+
+	Notes:
+        - USING_PIPE_SPAN_FROM_ISR_METHODS inside of RTOSConfig.h must
+          be defined as a 1 to use this method.
+
+	See Also:
+		- PipeConsumeFromISR()
+*/
+OS_RESULT PipeGetReadSpanFromISR(PIPE *Pipe, BYTE **Span, UINT32 *SpanSizeInBytes);
+
+/*
+	OS_RESULT PipeConsumeFromISR(PIPE *Pipe, UINT32 BytesToConsume, BOOL *HigherPriorityTask)
+
+	Description: The same as PipeConsume() but can be called from an ISR.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		PIPE *Pipe - A pointer to a valid PIPE which was returned from CreatePipe().
+ 
+        UINT32 BytesToConsume - The number of bytes to remove from the PIPE.
+
+        BOOL *HigherPriorityTask - Set to TRUE if a TASK of higher priority than
+        the current TASK was made ready.
+ 
+	Returns:
+		OS_RESULT - OS_SUCCESS if all the bytes were removed, OS_RESOURCE_INSUFFICIENT_DATA
+        if the PIPE held fewer bytes than BytesToConsume.
+
+	Notes:
+        - USING_PIPE_SPAN_FROM_ISR_METHODS inside of RTOSConfig.h must
+          be defined as a 1 to use this method.
+
+	See Also:
+		- PipeGetReadSpanFromISR()
+*/
+OS_RESULT PipeConsumeFromISR(PIPE *Pipe, UINT32 BytesToConsume, BOOL *HigherPriorityTask);
+
+/*
+	OS_RESULT PipeWriteVectorFromISR(PIPE *Pipe, const GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, BOOL AllOrNothing, UINT32 *BytesWritten, BOOL *HigherPriorityTask)
+
+	Description: The same as PipeWriteVector() but can be called from an ISR.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		PIPE *Pipe - A pointer to a valid PIPE which was returned from CreatePipe().
+ 
+        const GENERIC_BUFFER_VECTOR *Vectors - The segments to write, in order.
+
+        UINT32 NumberOfVectors - The number of segments in Vectors.
+
+        BOOL AllOrNothing - If TRUE nothing is written unless all the segments fit.
+
+        UINT32 *BytesWritten - The number of bytes written is stored here.
+
+        BOOL *HigherPriorityTask - Set to TRUE if a higher priority TASK was made ready.
+ 
+	Returns:
+		OS_RESULT - OS_SUCCESS if all the segments were written, OS_RESOURCE_INSUFFICIENT_SPACE
+        otherwise.
+
+	Notes:
+        - USING_PIPE_VECTOR_FROM_ISR_METHODS inside of RTOSConfig.h must
+          be defined as a 1 to use this method.
+
+	See Also:
+		- PipeReadVectorFromISR()
+*/
+#if (USING_PIPE_VECTOR_FROM_ISR_METHODS == 1)
+    OS_RESULT PipeWriteVectorFromISR(PIPE *Pipe, const GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, BOOL AllOrNothing, UINT32 *BytesWritten, BOOL *HigherPriorityTask);
+#endif // end of #if (USING_PIPE_VECTOR_FROM_ISR_METHODS == 1)
+
+/*
+	OS_RESULT PipeReadVectorFromISR(PIPE *Pipe, GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, BOOL AllOrNothing, UINT32 *BytesRead, BOOL *HigherPriorityTask)
+
+	Description: The same as PipeReadVector() but can be called from an ISR.
+
+	Blocking: No
+
+	User Callable: Yes
+
+	Arguments:
+		PIPE *Pipe - A pointer to a valid PIPE which was returned from CreatePipe().
+ 
+        GENERIC_BUFFER_VECTOR *Vectors - The segments to read into, in order.
+
+        UINT32 NumberOfVectors - The number of segments in Vectors.
+
+        BOOL AllOrNothing - If TRUE nothing is read unless all the segments can be filled.
+
+        UINT32 *BytesRead - The number of bytes read is stored here.
+
+        BOOL *HigherPriorityTask - Set to TRUE if a higher priority TASK was made ready.
+ 
+	Returns:
+		OS_RESULT - OS_SUCCESS if all the segments were filled, OS_RESOURCE_INSUFFICIENT_DATA
+        otherwise.
+
+	Notes:
+        - USING_PIPE_VECTOR_FROM_ISR_METHODS inside of RTOSConfig.h must
+          be defined as a 1 to use this method.
+
+	See Also:
+		- PipeWriteVectorFromISR()
+*/
+#if (USING_PIPE_VECTOR_FROM_ISR_METHODS == 1)
+    OS_RESULT PipeReadVectorFromISR(PIPE *Pipe, GENERIC_BUFFER_VECTOR *Vectors, UINT32 NumberOfVectors, BOOL AllOrNothing, UINT32 *BytesRead, BOOL *HigherPriorityTask);
+#endif // end of #if (USING_PIPE_VECTOR_FROM_ISR_METHODS == 1)
+
 #endif // end of #ifndef PIPE_H
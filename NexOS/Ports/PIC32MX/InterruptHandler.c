@@ -294,6 +294,10 @@
                 OS_UpdateIOBufferRXInterruptTriggerLevel(IO_BUFFER_ADC_1_ID);
             }
 
+            // only one buffers worth was read, if the hardware has more let the IO Buffer TASK drain it
+            if(PortIOBufferSignalIfDataAvailable(IO_BUFFER_ADC_1_ID))
+                SwapTask = TRUE;
+
             #if (USING_ADC_1_CALLBACK == 1)
             {
                 UINT32 i;
@@ -419,6 +423,10 @@
                 OS_UpdateIOBufferRXInterruptTriggerLevel(IO_BUFFER_UART_1_ID);
             }
 
+            // only one buffers worth was read, if the hardware has more let the IO Buffer TASK drain it
+            if(PortIOBufferSignalIfDataAvailable(IO_BUFFER_UART_1_ID))
+                SwapTask = TRUE;
+
             #if (USING_UART_1_RX_CALLBACK == 1)
             {
                 UINT32 i;
@@ -634,6 +642,10 @@
                 OS_UpdateIOBufferRXInterruptTriggerLevel(IO_BUFFER_UART_2_ID);
             }
 
+            // only one buffers worth was read, if the hardware has more let the IO Buffer TASK drain it
+            if(PortIOBufferSignalIfDataAvailable(IO_BUFFER_UART_2_ID))
+                SwapTask = TRUE;
+
             #if (USING_UART_2_RX_CALLBACK == 1)
             {
                 UINT32 i;
@@ -849,6 +861,10 @@
                 OS_UpdateIOBufferRXInterruptTriggerLevel(IO_BUFFER_UART_3_ID);
             }
 
+            // only one buffers worth was read, if the hardware has more let the IO Buffer TASK drain it
+            if(PortIOBufferSignalIfDataAvailable(IO_BUFFER_UART_3_ID))
+                SwapTask = TRUE;
+
             #if (USING_UART_3_RX_CALLBACK == 1)
             {
                 UINT32 i;
@@ -1065,6 +1081,10 @@
                 OS_UpdateIOBufferRXInterruptTriggerLevel(IO_BUFFER_UART_4_ID);
             }
 
+            // only one buffers worth was read, if the hardware has more let the IO Buffer TASK drain it
+            if(PortIOBufferSignalIfDataAvailable(IO_BUFFER_UART_4_ID))
+                SwapTask = TRUE;
+
             #if (USING_UART_4_RX_CALLBACK == 1)
             {
                 UINT32 i;
@@ -1280,6 +1300,10 @@
                 OS_UpdateIOBufferRXInterruptTriggerLevel(IO_BUFFER_UART_5_ID);
             }
 
+            // only one buffers worth was read, if the hardware has more let the IO Buffer TASK drain it
+            if(PortIOBufferSignalIfDataAvailable(IO_BUFFER_UART_5_ID))
+                SwapTask = TRUE;
+
             #if (USING_UART_5_RX_CALLBACK == 1)
             {
                 UINT32 i;
@@ -1495,6 +1519,10 @@
                 OS_UpdateIOBufferRXInterruptTriggerLevel(IO_BUFFER_UART_6_ID);
             }
 
+            // only one buffers worth was read, if the hardware has more let the IO Buffer TASK drain it
+            if(PortIOBufferSignalIfDataAvailable(IO_BUFFER_UART_6_ID))
+                SwapTask = TRUE;
+
             #if (USING_UART_6_RX_CALLBACK == 1)
             {
                 UINT32 i;
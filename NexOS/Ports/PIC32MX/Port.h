@@ -383,6 +383,31 @@ BOOL PortIsStackOverflowed(OS_WORD *CurrentStackPointer, OS_WORD *StartOfStack,
 */
 FLOAT32 PortGetExecutionTimeInSeconds(UINT32 TaskRunTime);
 
+/*
+	UINT32 PortCountLeadingZeros(UINT32 Value)
+
+	Description: This method returns the number of zero bits above the highest
+    set bit in Value.
+
+	Blocking: No
+
+	User Callable: No
+
+	Arguments:
+		UINT32 Value - The value to count the leading zeros of.  This cannot be 0.
+
+	Returns: 
+        UINT32 - The number of leading zero bits, 0 through 31.
+
+	Notes:
+		- This method must be implemented if USING_TLSF_MEMORY_ALLOCATOR inside of RTOSConfig.h is a 1.
+        - The PIC32 has a single cycle CLZ instruction which the compiler uses for this.
+
+	See Also:
+		- None
+*/
+#define PortCountLeadingZeros(Value)                            (UINT32)__builtin_clz(Value)
+
 /*
 	void PortSetInterruptPriority(BYTE NewInterruptPriority)
 
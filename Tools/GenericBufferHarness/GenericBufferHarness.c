@@ -0,0 +1,1156 @@
+/*
+    NexOS Kernel Version v1.02.01
+    Copyright (c) 2023 brodie
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+ */
+
+
+
+/*
+	Host harness for Generic Libraries/Generic Buffer/GenericBuffer.c.
+
+	GenericBuffer.c is compiled unchanged against the headers in Shim/ and timed
+	against reference versions of the code it replaced, which are kept here so the
+	numbers can be reproduced on any host.
+
+	Usage:
+		GenericBufferHarness copy [BytesPerRun]
+			Writes and then reads back BytesPerRun bytes through a GENERIC_BUFFER in
+			chunks of 1, 16, 256 and 4096 bytes, once with GenericBufferWrite() and
+			GenericBufferRead() and once with the byte at a time loops they used to
+			have, and prints the time per chunk of each.
+
+		GenericBufferHarness check [Seed] [Operations]
+			Writes, reads, peeks and fills and empties spans at random through a small
+			GENERIC_BUFFER and checks every read, peek, span, GenericBufferContains(),
+			GenericBufferSeek() and GenericBufferSearch() against a plain array
+			holding what should be in it.  Stops at the first difference.  When
+			built with USING_GENERIC_BUFFER_OVERWRITE_MODE as 1 it then does the
+			same with a GENERIC_BUFFER which overwrites its oldest data.  Last a
+			SPSC_GENERIC_BUFFER is checked from one thread, and then Operations
+			sequence numbers are passed through it between two threads.
+
+		GenericBufferHarness scan [BytesPerRun]
+			Times GenericBufferContains() and GenericBufferSeek() on 16, 256 and
+			4096 bytes of data which wraps around the end of the Buffer.  The
+			Makefile builds GenericBufferHarnessByteScan with GENERIC_BUFFER_WORD_SCAN
+			set to 0 to compare against.
+*/
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "GenericBufferConfig.h"
+#include "GenericBuffer.h"
+
+// not a power of 2, so where the runs split at the end of the Buffer keeps moving
+#define HARNESS_RING_CAPACITY_IN_BYTES					8195
+#define HARNESS_MAXIMUM_CHUNK_SIZE_IN_BYTES				4096
+#define HARNESS_DEFAULT_BYTES_PER_RUN					(64 * 1024 * 1024)
+#define HARNESS_REPETITIONS								5
+#define HARNESS_SCAN_CHARACTER							'\n'
+#define HARNESS_SCAN_CHARACTER_SPACING					32 // the Character is every this many bytes for GenericBufferContains()
+#define HARNESS_CHECK_CAPACITY_IN_BYTES					32
+#define HARNESS_DEFAULT_SEED							1
+#define HARNESS_DEFAULT_OPERATIONS						1000000
+#define HARNESS_SPSC_CAPACITY_IN_BYTES					64
+#define HARNESS_SPSC_INDEX_START						((UINT32)0 - (UINT32)1000) // just below where the indexes wrap
+
+#if (GENERIC_BUFFER_WORD_SCAN == 1)
+	#define HARNESS_SCAN_NAME							"word"
+#else
+	#define HARNESS_SCAN_NAME							"byte"
+#endif // end of #if (GENERIC_BUFFER_WORD_SCAN == 1)
+
+#if (USING_GENERIC_BUFFER_OVERWRITE_MODE == 1)
+	#define HARNESS_OVERWRITE_NAME						", overwrite mode"
+#else
+	#define HARNESS_OVERWRITE_NAME						""
+#endif // end of #if (USING_GENERIC_BUFFER_OVERWRITE_MODE == 1)
+
+#if (USING_GENERIC_BUFFER_OVERWRITE_MODE == 1)
+	#define HarnessCreateGenericBuffer(GenericBuffer, CapacityInBytes, Buffer)		CreateGenericBuffer(GenericBuffer, CapacityInBytes, Buffer, FALSE)
+#else
+	#define HarnessCreateGenericBuffer(GenericBuffer, CapacityInBytes, Buffer)		CreateGenericBuffer(GenericBuffer, CapacityInBytes, Buffer)
+#endif // end of #if (USING_GENERIC_BUFFER_OVERWRITE_MODE == 1)
+
+typedef UINT32 (*HARNESS_WRITE)(GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes, const BYTE *DataToWrite);
+typedef UINT32 (*HARNESS_READ)(GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes, BYTE *DestinationBuffer, UINT32 DestinationBufferSize, BOOL NullTerminate);
+
+static BYTE gRing[HARNESS_RING_CAPACITY_IN_BYTES];
+static BYTE gSource[HARNESS_MAXIMUM_CHUNK_SIZE_IN_BYTES];
+static BYTE gDestination[HARNESS_MAXIMUM_CHUNK_SIZE_IN_BYTES + 1];
+
+static UINT32 gRandomState;
+
+static const UINT32 gChunkSizes[] = { 1, 16, 256, 4096 };
+static const UINT32 gScanSizes[] = { 16, 256, 4096 };
+
+#define HARNESS_NUMBER_OF_CHUNK_SIZES					(sizeof(gChunkSizes) / sizeof(gChunkSizes[0]))
+#define HARNESS_NUMBER_OF_SCAN_SIZES					(sizeof(gScanSizes) / sizeof(gScanSizes[0]))
+
+// xorshift32, so a seed gives the same run on any host C library
+static UINT32 HarnessRandomFrom(UINT32 *State)
+{
+	*State ^= *State << 13;
+	*State ^= *State >> 17;
+	*State ^= *State << 5;
+
+	return *State;
+}
+
+static UINT32 HarnessRandom(void)
+{
+	return HarnessRandomFrom(&gRandomState);
+}
+
+static UINT32 HarnessRandomRange(UINT32 Minimum, UINT32 Maximum)
+{
+	return Minimum + (HarnessRandom() % (Maximum - Minimum + 1));
+}
+
+static UINT64 HarnessNow(void)
+{
+	struct timespec Now;
+
+	clock_gettime(CLOCK_MONOTONIC, &Now);
+
+	return (UINT64)Now.tv_sec * 1000000000ULL + (UINT64)Now.tv_nsec;
+}
+
+/*
+	GenericBufferWrite() and GenericBufferRead() as they were before the copies were
+	done with memcpy(), a byte per pass with a wrap check on every byte.  The safe mode
+	checks are kept so both sides do the same work apart from the copy.
+*/
+static __attribute__((noinline)) UINT32 ByteLoopWrite(GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes, const BYTE *DataToWrite)
+{
+	UINT32 BytesWritten;
+	BYTE *DataPtr;
+
+	if(GenericBuffer == (GENERIC_BUFFER*)NULL || NumberOfBytes == 0 || DataToWrite == (BYTE*)NULL)
+		return (UINT32)0;
+
+	BytesWritten = (UINT32)0;
+	DataPtr = (BYTE*)DataToWrite;
+
+	while(GenericBuffer->BufferSize < (UINT32)(GenericBuffer->BufferCapacity) && BytesWritten != (UINT32)NumberOfBytes)
+	{
+		BytesWritten++;
+		GenericBuffer->BufferSize++;
+
+		*(GenericBuffer->CurrentWritePosition) = *DataPtr++;
+		GenericBuffer->CurrentWritePosition++;
+
+		if(GenericBuffer->CurrentWritePosition == GenericBuffer->Buffer + GenericBuffer->BufferCapacity)
+			GenericBuffer->CurrentWritePosition = (BYTE*)(GenericBuffer->Buffer);
+	}
+
+	return (UINT32)BytesWritten;
+}
+
+static __attribute__((noinline)) UINT32 ByteLoopRead(GENERIC_BUFFER *GenericBuffer, UINT32 NumberOfBytes, BYTE *DestinationBuffer, UINT32 DestinationBufferSize, BOOL NullTerminate)
+{
+	UINT32 BytesRead;
+	BYTE *ReadPtr;
+
+	if(GenericBuffer == (GENERIC_BUFFER*)NULL || GenericBuffer->BufferSize == 0 || DestinationBuffer == (BYTE*)NULL)
+		return (UINT32)0;
+
+	if(DestinationBufferSize == 0 || NumberOfBytes > DestinationBufferSize || (NullTerminate == TRUE && NumberOfBytes + 1 > DestinationBufferSize))
+		return (UINT32)0;
+
+	BytesRead = (UINT32)0;
+	ReadPtr = DestinationBuffer;
+
+	while(GenericBuffer->BufferSize && BytesRead != (UINT32)NumberOfBytes)
+	{
+		BytesRead++;
+
+		GenericBuffer->BufferSize--;
+
+		*ReadPtr++ = *(GenericBuffer->CurrentReadPosition);
+
+		GenericBuffer->CurrentReadPosition++;
+
+		if(GenericBuffer->CurrentReadPosition == GenericBuffer->Buffer + GenericBuffer->BufferCapacity)
+			GenericBuffer->CurrentReadPosition = (BYTE*)(GenericBuffer->Buffer);
+	}
+
+	#if (USING_GENERIC_BUFFER_SEARCH_METHODS == 1)
+		GenericBuffer->TotalBytesRead += BytesRead;
+	#endif // end of USING_GENERIC_BUFFER_SEARCH_METHODS
+
+	if(NullTerminate == TRUE)
+		DestinationBuffer[BytesRead] = '\0';
+
+	return (UINT32)BytesRead;
+}
+
+/*
+	Pushes BytesPerRun bytes through a GENERIC_BUFFER ChunkSizeInBytes at a time and
+	returns how long it took in nanoseconds, or 0 if anything came back wrong.  When
+	Verify is TRUE every chunk read is compared with what was written.
+*/
+static UINT64 CopyRun(HARNESS_WRITE Write, HARNESS_READ Read, UINT32 ChunkSizeInBytes, UINT32 BytesPerRun, BOOL Verify)
+{
+	GENERIC_BUFFER GenericBuffer;
+	UINT32 i, Chunks;
+	UINT64 Start, End;
+
+	HarnessCreateGenericBuffer(&GenericBuffer, HARNESS_RING_CAPACITY_IN_BYTES, gRing);
+
+	Chunks = BytesPerRun / ChunkSizeInBytes;
+
+	Start = HarnessNow();
+
+	for (i = 0; i < Chunks; i++)
+	{
+		gSource[0] = (BYTE)i;
+
+		if (Write(&GenericBuffer, ChunkSizeInBytes, gSource) != ChunkSizeInBytes)
+			return 0;
+
+		if (Read(&GenericBuffer, ChunkSizeInBytes, gDestination, sizeof(gDestination), FALSE) != ChunkSizeInBytes)
+			return 0;
+
+		if (Verify == TRUE && memcmp(gSource, gDestination, ChunkSizeInBytes) != 0)
+			return 0;
+	}
+
+	End = HarnessNow();
+
+	return End - Start;
+}
+
+// the fastest of a few runs, after one run which checks the data
+static UINT64 BestCopyRun(HARNESS_WRITE Write, HARNESS_READ Read, UINT32 ChunkSizeInBytes, UINT32 BytesPerRun)
+{
+	UINT64 Best, Nanoseconds;
+	UINT32 i;
+
+	if (CopyRun(Write, Read, ChunkSizeInBytes, BytesPerRun, TRUE) == 0)
+		return 0;
+
+	Best = 0;
+
+	for (i = 0; i < HARNESS_REPETITIONS; i++)
+	{
+		if ((Nanoseconds = CopyRun(Write, Read, ChunkSizeInBytes, BytesPerRun, FALSE)) == 0)
+			return 0;
+
+		if (Best == 0 || Nanoseconds < Best)
+			Best = Nanoseconds;
+	}
+
+	return Best;
+}
+
+static int Copy(UINT32 BytesPerRun)
+{
+	UINT64 MemcpyNanoseconds, ByteLoopNanoseconds;
+	UINT32 i, Chunks;
+
+	for (i = 0; i < sizeof(gSource); i++)
+		gSource[i] = (BYTE)(i * 131 + 7);
+
+	printf("copy, %u byte ring, %u bytes written and read per run, best of %u runs\n", HARNESS_RING_CAPACITY_IN_BYTES, BytesPerRun, HARNESS_REPETITIONS);
+	printf("chunk bytes   memcpy ns/chunk  byte loop ns/chunk   memcpy MB/s  byte loop MB/s  speedup\n");
+
+	for (i = 0; i < HARNESS_NUMBER_OF_CHUNK_SIZES; i++)
+	{
+		MemcpyNanoseconds = BestCopyRun(GenericBufferWrite, GenericBufferRead, gChunkSizes[i], BytesPerRun);
+		ByteLoopNanoseconds = BestCopyRun(ByteLoopWrite, ByteLoopRead, gChunkSizes[i], BytesPerRun);
+
+		if (MemcpyNanoseconds == 0 || ByteLoopNanoseconds == 0)
+		{
+			printf("%u byte chunks came back wrong\n", gChunkSizes[i]);
+
+			return 1;
+		}
+
+		Chunks = BytesPerRun / gChunkSizes[i];
+
+		printf("%11u %17.1f %18.1f %13.0f %15.0f %7.2fx\n", gChunkSizes[i],
+			(double)MemcpyNanoseconds / Chunks, (double)ByteLoopNanoseconds / Chunks,
+			(double)Chunks * gChunkSizes[i] * 1000.0 / MemcpyNanoseconds,
+			(double)Chunks * gChunkSizes[i] * 1000.0 / ByteLoopNanoseconds,
+			(double)ByteLoopNanoseconds / MemcpyNanoseconds);
+	}
+
+	return 0;
+}
+
+/*
+	Fills a GENERIC_BUFFER with SizeInBytes bytes which start a little before the end of
+	the Buffer, so both runs get scanned, and have the Character every
+	HARNESS_SCAN_CHARACTER_SPACING bytes when Spaced is TRUE or only in the last byte
+	when it is FALSE.
+*/
+static void ScanFill(GENERIC_BUFFER *GenericBuffer, UINT32 SizeInBytes, BOOL Spaced)
+{
+	UINT32 i, Skip;
+
+	HarnessCreateGenericBuffer(GenericBuffer, HARNESS_RING_CAPACITY_IN_BYTES, gRing);
+
+	for (i = HARNESS_RING_CAPACITY_IN_BYTES - SizeInBytes / 2; i != 0; i -= Skip)
+	{
+		Skip = i < HARNESS_MAXIMUM_CHUNK_SIZE_IN_BYTES ? i : HARNESS_MAXIMUM_CHUNK_SIZE_IN_BYTES;
+
+		GenericBufferWrite(GenericBuffer, Skip, gSource);
+		GenericBufferRead(GenericBuffer, Skip, gDestination, sizeof(gDestination), FALSE);
+	}
+
+	for (i = 0; i < SizeInBytes; i++)
+		gDestination[i] = (BYTE)('a' + i % 26);
+
+	if (Spaced == TRUE)
+	{
+		for (i = HARNESS_SCAN_CHARACTER_SPACING - 1; i < SizeInBytes; i += HARNESS_SCAN_CHARACTER_SPACING)
+			gDestination[i] = HARNESS_SCAN_CHARACTER;
+	}
+	else
+	{
+		gDestination[SizeInBytes - 1] = HARNESS_SCAN_CHARACTER;
+	}
+
+	GenericBufferWrite(GenericBuffer, SizeInBytes, gDestination);
+}
+
+// the fastest of a few runs of Calls calls, in nanoseconds per call, 0 if a result was wrong
+static double BestScanRun(GENERIC_BUFFER *GenericBuffer, UINT32 (*Scan)(GENERIC_BUFFER *GenericBuffer, BYTE Character), UINT32 Expected, UINT32 Calls)
+{
+	UINT64 Best, Start, Nanoseconds;
+	UINT32 i, j, Wrong;
+
+	Best = 0;
+
+	for (i = 0; i < HARNESS_REPETITIONS; i++)
+	{
+		Wrong = 0;
+
+		Start = HarnessNow();
+
+		for (j = 0; j < Calls; j++)
+			Wrong |= Scan(GenericBuffer, HARNESS_SCAN_CHARACTER) ^ Expected;
+
+		Nanoseconds = HarnessNow() - Start;
+
+		if (Wrong != 0)
+			return 0;
+
+		if (Best == 0 || Nanoseconds < Best)
+			Best = Nanoseconds;
+	}
+
+	return (double)Best / Calls;
+}
+
+static int Scan(UINT32 BytesPerRun)
+{
+	GENERIC_BUFFER GenericBuffer;
+	double ContainsNanoseconds, SeekNanoseconds;
+	UINT32 i, SizeInBytes, Calls;
+
+	printf("scan, %s at a time, %u bytes scanned per run, best of %u runs\n", HARNESS_SCAN_NAME, BytesPerRun, HARNESS_REPETITIONS);
+	printf("data bytes  contains ns/call  seek ns/call  contains MB/s  seek MB/s\n");
+
+	for (i = 0; i < HARNESS_NUMBER_OF_SCAN_SIZES; i++)
+	{
+		SizeInBytes = gScanSizes[i];
+		Calls = BytesPerRun / SizeInBytes;
+
+		ScanFill(&GenericBuffer, SizeInBytes, TRUE);
+		ContainsNanoseconds = BestScanRun(&GenericBuffer, GenericBufferContains, SizeInBytes / HARNESS_SCAN_CHARACTER_SPACING, Calls);
+
+		ScanFill(&GenericBuffer, SizeInBytes, FALSE);
+		SeekNanoseconds = BestScanRun(&GenericBuffer, GenericBufferSeek, SizeInBytes, Calls);
+
+		if (ContainsNanoseconds == 0 || SeekNanoseconds == 0)
+		{
+			printf("scanning %u bytes came back wrong\n", SizeInBytes);
+
+			return 1;
+		}
+
+		printf("%10u %17.1f %13.1f %14.0f %10.0f\n", SizeInBytes, ContainsNanoseconds, SeekNanoseconds,
+			SizeInBytes * 1000.0 / ContainsNanoseconds, SizeInBytes * 1000.0 / SeekNanoseconds);
+	}
+
+	return 0;
+}
+
+/*
+	What GenericBufferSearch() should return for Contents, the length up to and
+	including the end of the match which ends first, with the lowest pattern index
+	winning a tie.
+*/
+static UINT32 ExpectedSearch(const BYTE *Contents, UINT32 SizeInBytes, BYTE Patterns[][GENERIC_BUFFER_SEARCH_MAX_PATTERN_SIZE_IN_BYTES], const UINT32 *PatternSizes, UINT32 NumberOfPatterns, UINT32 *PatternIndex)
+{
+	UINT32 End, i;
+
+	for (End = 1; End <= SizeInBytes; End++)
+	{
+		for (i = 0; i < NumberOfPatterns; i++)
+		{
+			if (PatternSizes[i] <= End && memcmp(&Contents[End - PatternSizes[i]], Patterns[i], PatternSizes[i]) == 0)
+			{
+				*PatternIndex = i;
+
+				return End;
+			}
+		}
+	}
+
+	return 0;
+}
+
+/*
+	"XA" searched for "AA" leaves the search 1 byte into a match.  If a peek counted
+	as a read the search would drop the X, look at the A again and find "AA".
+*/
+static BOOL CheckSearchAfterPeek(void)
+{
+	GENERIC_BUFFER GenericBuffer;
+	GENERIC_BUFFER_SEARCH *Search;
+	BYTE Ring[8], Peeked[1];
+	UINT32 Found;
+
+	HarnessCreateGenericBuffer(&GenericBuffer, sizeof(Ring), Ring);
+
+	if ((Search = CreateGenericBufferSearch((GENERIC_BUFFER_SEARCH*)NULL)) == (GENERIC_BUFFER_SEARCH*)NULL)
+		return FALSE;
+
+	GenericBufferSearchAddPattern(Search, (const BYTE*)"AA", 2);
+
+	GenericBufferWrite(&GenericBuffer, 2, (const BYTE*)"XA");
+
+	Found = GenericBufferSearch(&GenericBuffer, Search, (UINT32*)NULL);
+
+	GenericBufferPeek(&GenericBuffer, 1, Peeked, sizeof(Peeked), FALSE);
+
+	Found += GenericBufferSearch(&GenericBuffer, Search, (UINT32*)NULL);
+
+	GenericBufferSearchDelete(Search);
+
+	if (Found != 0)
+	{
+		printf("search found \"AA\" in \"XA\" after a peek\n");
+
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+#if (USING_GENERIC_BUFFER_OVERWRITE_MODE == 1)
+	/*
+		A ring buffer which makes room for each new byte by dropping the oldest one, a
+		byte at a time, to check the overwrite mode of a GENERIC_BUFFER against.
+	*/
+	typedef struct
+	{
+		BYTE Data[HARNESS_CHECK_CAPACITY_IN_BYTES];
+		UINT32 Capacity, Start, Size;
+		UINT32 BytesRead, BytesDropped;
+
+		// bytes dropped by the same write which put them in, a search never sees these
+		UINT32 BytesNeverStored;
+	}HARNESS_REFERENCE_RING;
+
+	static void ReferenceWrite(HARNESS_REFERENCE_RING *Reference, const BYTE *Data, UINT32 NumberOfBytes)
+	{
+		UINT32 i;
+
+		for (i = 0; i < NumberOfBytes; i++)
+		{
+			if (Reference->Size == Reference->Capacity)
+			{
+				Reference->Start = (Reference->Start + 1) % Reference->Capacity;
+				Reference->Size--;
+				Reference->BytesDropped++;
+
+				if (i >= Reference->Capacity)
+					Reference->BytesNeverStored++;
+			}
+
+			Reference->Data[(Reference->Start + Reference->Size) % Reference->Capacity] = Data[i];
+			Reference->Size++;
+		}
+	}
+
+	// copies out up to NumberOfBytes of the oldest bytes, and removes them when Remove is TRUE
+	static UINT32 ReferenceRead(HARNESS_REFERENCE_RING *Reference, BYTE *Data, UINT32 NumberOfBytes, BOOL Remove)
+	{
+		UINT32 i;
+
+		if (NumberOfBytes > Reference->Size)
+			NumberOfBytes = Reference->Size;
+
+		for (i = 0; i < NumberOfBytes; i++)
+			Data[i] = Reference->Data[(Reference->Start + i) % Reference->Capacity];
+
+		if (Remove == TRUE)
+		{
+			Reference->Start = (Reference->Start + NumberOfBytes) % Reference->Capacity;
+			Reference->Size -= NumberOfBytes;
+			Reference->BytesRead += NumberOfBytes;
+		}
+
+		return NumberOfBytes;
+	}
+
+	/*
+		Writes, vector writes, reads and peeks at random through a GENERIC_BUFFER created
+		with OverwriteOldest as TRUE, with writes of up to twice its capacity so some
+		only keep their newest part.  After every call the bytes moved, the whole of the
+		contents, GenericBufferGetBytesDropped() and the total read as a search sees it
+		are checked against a HARNESS_REFERENCE_RING.
+	*/
+	static int CheckOverwrite(UINT32 Operations)
+	{
+		GENERIC_BUFFER GenericBuffer;
+		GENERIC_BUFFER_VECTOR Vectors[3];
+		HARNESS_REFERENCE_RING Reference;
+		BYTE Ring[HARNESS_CHECK_CAPACITY_IN_BYTES];
+		BYTE Data[2 * HARNESS_CHECK_CAPACITY_IN_BYTES];
+		BYTE Contents[HARNESS_CHECK_CAPACITY_IN_BYTES], ExpectedContents[HARNESS_CHECK_CAPACITY_IN_BYTES];
+		UINT32 Operation, Size, Expected, Got, NumberOfVectors, i;
+
+		for (Operation = 0; Operation < Operations; Operation++)
+		{
+			if (Operation % 1000 == 0)
+			{
+				memset((void*)&Reference, 0, sizeof(Reference));
+
+				Reference.Capacity = HarnessRandomRange(3, HARNESS_CHECK_CAPACITY_IN_BYTES);
+
+				CreateGenericBuffer(&GenericBuffer, Reference.Capacity, Ring, TRUE);
+			}
+
+			for (i = 0; i < sizeof(Data); i++)
+				Data[i] = (BYTE)HarnessRandom();
+
+			switch (HarnessRandom() % 4)
+			{
+				case 0:
+				{
+					Size = HarnessRandomRange(1, 2 * Reference.Capacity);
+
+					Got = GenericBufferWrite(&GenericBuffer, Size, Data);
+
+					ReferenceWrite(&Reference, Data, Size);
+
+					Expected = Size;
+
+					break;
+				}
+
+				case 1:
+				{
+					NumberOfVectors = HarnessRandomRange(1, 3);
+
+					for (i = 0, Expected = 0; i < NumberOfVectors; i++)
+					{
+						Vectors[i].Data = &Data[Expected];
+						Vectors[i].SizeInBytes = HarnessRandomRange(0, Reference.Capacity / 2);
+
+						ReferenceWrite(&Reference, Vectors[i].Data, Vectors[i].SizeInBytes);
+
+						Expected += Vectors[i].SizeInBytes;
+					}
+
+					Got = GenericBufferWriteVector(&GenericBuffer, Vectors, NumberOfVectors, TRUE);
+
+					break;
+				}
+
+				case 2:
+				{
+					Size = HarnessRandomRange(1, Reference.Capacity);
+
+					Got = GenericBufferRead(&GenericBuffer, Size, Data, sizeof(Data), FALSE);
+					Expected = ReferenceRead(&Reference, ExpectedContents, Size, TRUE);
+
+					if (Got == Expected && memcmp(Data, ExpectedContents, Expected) != 0)
+						Got = ~Expected;
+
+					break;
+				}
+
+				default:
+				{
+					Size = HarnessRandomRange(1, Reference.Capacity);
+
+					Got = GenericBufferPeek(&GenericBuffer, Size, Data, sizeof(Data), FALSE);
+					Expected = ReferenceRead(&Reference, ExpectedContents, Size, FALSE);
+
+					if (Got == Expected && memcmp(Data, ExpectedContents, Expected) != 0)
+						Got = ~Expected;
+
+					break;
+				}
+			}
+
+			if (Got != Expected)
+			{
+				printf("overwrite operation %u: moved %u bytes or moved the wrong ones, wanted %u\n", Operation, Got, Expected);
+
+				return 1;
+			}
+
+			Got = GenericBufferPeek(&GenericBuffer, Reference.Capacity, Contents, sizeof(Contents), FALSE);
+			Expected = ReferenceRead(&Reference, ExpectedContents, Reference.Capacity, FALSE);
+
+			if (Got != Expected || memcmp(Contents, ExpectedContents, Expected) != 0)
+			{
+				printf("overwrite operation %u: holds %u bytes or the wrong ones, wanted %u\n", Operation, Got, Expected);
+
+				return 1;
+			}
+
+			if ((Got = GenericBufferGetBytesDropped(&GenericBuffer)) != Reference.BytesDropped)
+			{
+				printf("overwrite operation %u: dropped %u bytes, wanted %u\n", Operation, Got, Reference.BytesDropped);
+
+				return 1;
+			}
+
+			// to a search a dropped byte is gone the same as a read one
+			Expected = Reference.BytesRead + Reference.BytesDropped - Reference.BytesNeverStored;
+
+			if (GenericBuffer.TotalBytesRead != Expected)
+			{
+				printf("overwrite operation %u: %u bytes read in total, wanted %u\n", Operation, GenericBuffer.TotalBytesRead, Expected);
+
+				return 1;
+			}
+		}
+
+		return 0;
+	}
+#endif // end of #if (USING_GENERIC_BUFFER_OVERWRITE_MODE == 1)
+
+#if (USING_SPSC_GENERIC_BUFFER_METHODS == 1)
+	/*
+		Checks a SPSC_GENERIC_BUFFER from one thread.  It has to refuse a capacity which
+		is not a power of 2, hand back nothing when empty and take nothing when full.
+		Then random writes and reads are checked against a plain array with the
+		indexes starting just below where they wrap, so the masking is tested across it.
+	*/
+	static BOOL CheckSPSCSingleThread(UINT32 Operations)
+	{
+		SPSC_GENERIC_BUFFER GenericBuffer;
+		BYTE Ring[HARNESS_SPSC_CAPACITY_IN_BYTES];
+		BYTE Model[HARNESS_SPSC_CAPACITY_IN_BYTES];
+		BYTE Data[HARNESS_SPSC_CAPACITY_IN_BYTES + 1];
+		UINT32 ModelSize, Operation, Size, Expected, Got, i;
+
+		if (CreateSPSCGenericBuffer(&GenericBuffer, 48, Ring) != (SPSC_GENERIC_BUFFER*)NULL)
+		{
+			printf("spsc: created with a capacity of 48, which is not a power of 2\n");
+
+			return FALSE;
+		}
+
+		CreateSPSCGenericBuffer(&GenericBuffer, sizeof(Ring), Ring);
+
+		GenericBuffer.WriteIndex = GenericBuffer.ReadIndex = HARNESS_SPSC_INDEX_START;
+
+		if (SPSCGenericBufferRead(&GenericBuffer, 1, Data) != 0 || SPSCGenericBufferGetSize(&GenericBuffer) != 0 || SPSCGenericBufferGetRemainingBytes(&GenericBuffer) != sizeof(Ring))
+		{
+			printf("spsc: an empty buffer handed back data or has the wrong size\n");
+
+			return FALSE;
+		}
+
+		memset((void*)Data, 'A', sizeof(Data));
+
+		if (SPSCGenericBufferWrite(&GenericBuffer, sizeof(Data), Data) != sizeof(Ring) || SPSCGenericBufferWrite(&GenericBuffer, 1, Data) != 0 || SPSCGenericBufferGetSize(&GenericBuffer) != sizeof(Ring) || SPSCGenericBufferGetRemainingBytes(&GenericBuffer) != 0)
+		{
+			printf("spsc: a full buffer took more data or has the wrong size\n");
+
+			return FALSE;
+		}
+
+		memset((void*)Model, 'A', sizeof(Model));
+		ModelSize = sizeof(Model);
+
+		for (Operation = 0; Operation < Operations; Operation++)
+		{
+			Size = HarnessRandomRange(0, sizeof(Data));
+
+			if (HarnessRandom() % 2 == 0)
+			{
+				for (i = 0; i < Size; i++)
+					Data[i] = (BYTE)HarnessRandom();
+
+				Got = SPSCGenericBufferWrite(&GenericBuffer, Size, Data);
+				Expected = sizeof(Model) - ModelSize < Size ? sizeof(Model) - ModelSize : Size;
+
+				memcpy(&Model[ModelSize], Data, Expected);
+				ModelSize += Expected;
+			}
+			else
+			{
+				Got = SPSCGenericBufferRead(&GenericBuffer, Size, Data);
+				Expected = ModelSize < Size ? ModelSize : Size;
+
+				if (Got == Expected && memcmp(Data, Model, Expected) != 0)
+					Got = ~Expected;
+
+				memmove(Model, &Model[Expected], ModelSize - Expected);
+				ModelSize -= Expected;
+			}
+
+			if (Got != Expected || SPSCGenericBufferGetSize(&GenericBuffer) != ModelSize || SPSCGenericBufferGetRemainingBytes(&GenericBuffer) != sizeof(Model) - ModelSize)
+			{
+				printf("spsc operation %u: moved %u bytes or the wrong ones, wanted %u, or holds %u bytes, wanted %u\n", Operation, Got, Expected, SPSCGenericBufferGetSize(&GenericBuffer), ModelSize);
+
+				return FALSE;
+			}
+		}
+
+		return TRUE;
+	}
+
+	/*
+		The two threads of CheckSPSCThreads() pass a stream of 32 bit sequence numbers, a
+		byte at a time in random sized pieces.  This is byte Position of that stream.
+	*/
+	static BYTE SPSCStreamByte(UINT32 Position)
+	{
+		return (BYTE)((Position / sizeof(UINT32)) >> ((Position % sizeof(UINT32)) * 8));
+	}
+
+	typedef struct
+	{
+		SPSC_GENERIC_BUFFER *GenericBuffer;
+		UINT32 StreamSizeInBytes;
+		UINT32 RandomState;
+
+		// set by the consumer, the first position which held the wrong byte and what it held
+		UINT32 BadPosition;
+		BYTE BadByte;
+		BOOL Failed;
+	}HARNESS_SPSC_THREAD;
+
+	// both sides yield when they can't move anything so a single CPU host still finishes
+	static void *SPSCProducer(void *Argument)
+	{
+		HARNESS_SPSC_THREAD *Thread = (HARNESS_SPSC_THREAD*)Argument;
+		BYTE Data[HARNESS_SPSC_CAPACITY_IN_BYTES + 1];
+		UINT32 Position, Size, Written, i;
+
+		for (Position = 0; Position < Thread->StreamSizeInBytes; Position += Written)
+		{
+			Size = 1 + HarnessRandomFrom(&Thread->RandomState) % sizeof(Data);
+
+			if (Size > Thread->StreamSizeInBytes - Position)
+				Size = Thread->StreamSizeInBytes - Position;
+
+			for (i = 0; i < Size; i++)
+				Data[i] = SPSCStreamByte(Position + i);
+
+			if ((Written = SPSCGenericBufferWrite(Thread->GenericBuffer, Size, Data)) == 0)
+				sched_yield();
+		}
+
+		return NULL;
+	}
+
+	static void *SPSCConsumer(void *Argument)
+	{
+		HARNESS_SPSC_THREAD *Thread = (HARNESS_SPSC_THREAD*)Argument;
+		BYTE Data[HARNESS_SPSC_CAPACITY_IN_BYTES + 1];
+		UINT32 Position, Read, i;
+
+		for (Position = 0; Position < Thread->StreamSizeInBytes; Position += Read)
+		{
+			if ((Read = SPSCGenericBufferRead(Thread->GenericBuffer, 1 + HarnessRandomFrom(&Thread->RandomState) % sizeof(Data), Data)) == 0)
+				sched_yield();
+
+			for (i = 0; i < Read; i++)
+			{
+				if (Data[i] != SPSCStreamByte(Position + i) && Thread->Failed == FALSE)
+				{
+					Thread->BadPosition = Position + i;
+					Thread->BadByte = Data[i];
+					Thread->Failed = TRUE;
+				}
+			}
+		}
+
+		return NULL;
+	}
+
+	/*
+		Runs a producer and a consumer thread on one SPSC_GENERIC_BUFFER with no locks,
+		the way an ISR and a TASK would use it, and checks every sequence number arrives
+		once and in order.
+	*/
+	static BOOL CheckSPSCThreads(UINT32 NumberOfSequenceNumbers)
+	{
+		SPSC_GENERIC_BUFFER GenericBuffer;
+		BYTE Ring[HARNESS_SPSC_CAPACITY_IN_BYTES];
+		HARNESS_SPSC_THREAD Producer, Consumer;
+		pthread_t ProducerThread, ConsumerThread;
+
+		CreateSPSCGenericBuffer(&GenericBuffer, sizeof(Ring), Ring);
+
+		GenericBuffer.WriteIndex = GenericBuffer.ReadIndex = HARNESS_SPSC_INDEX_START;
+
+		memset((void*)&Producer, 0, sizeof(Producer));
+
+		Producer.GenericBuffer = &GenericBuffer;
+		Producer.StreamSizeInBytes = NumberOfSequenceNumbers * sizeof(UINT32);
+		Producer.RandomState = HarnessRandom() | 1;
+
+		Consumer = Producer;
+		Consumer.RandomState = HarnessRandom() | 1;
+
+		if (pthread_create(&ConsumerThread, (const pthread_attr_t*)NULL, SPSCConsumer, (void*)&Consumer) != 0 || pthread_create(&ProducerThread, (const pthread_attr_t*)NULL, SPSCProducer, (void*)&Producer) != 0)
+		{
+			printf("spsc: could not start the producer and consumer threads\n");
+
+			exit(2);
+		}
+
+		pthread_join(ProducerThread, (void**)NULL);
+		pthread_join(ConsumerThread, (void**)NULL);
+
+		if (Consumer.Failed == TRUE)
+		{
+			printf("spsc threads: byte %u of sequence number %u was %u, wanted %u\n", Consumer.BadPosition % (UINT32)sizeof(UINT32), Consumer.BadPosition / (UINT32)sizeof(UINT32), (UINT32)Consumer.BadByte, (UINT32)SPSCStreamByte(Consumer.BadPosition));
+
+			return FALSE;
+		}
+
+		if (SPSCGenericBufferGetSize(&GenericBuffer) != 0)
+		{
+			printf("spsc threads: %u bytes were left over\n", SPSCGenericBufferGetSize(&GenericBuffer));
+
+			return FALSE;
+		}
+
+		return TRUE;
+	}
+#endif // end of #if (USING_SPSC_GENERIC_BUFFER_METHODS == 1)
+
+static int Check(UINT32 Seed, UINT32 Operations)
+{
+	GENERIC_BUFFER GenericBuffer;
+	GENERIC_BUFFER_SEARCH *Search;
+	BYTE Ring[HARNESS_CHECK_CAPACITY_IN_BYTES];
+	BYTE Model[HARNESS_CHECK_CAPACITY_IN_BYTES];
+	BYTE Data[HARNESS_CHECK_CAPACITY_IN_BYTES + 1];
+	BYTE Patterns[GENERIC_BUFFER_SEARCH_MAX_PATTERNS][GENERIC_BUFFER_SEARCH_MAX_PATTERN_SIZE_IN_BYTES];
+	UINT32 PatternSizes[GENERIC_BUFFER_SEARCH_MAX_PATTERNS];
+	UINT32 NumberOfPatterns, ModelSize, ModelStart, Operation, Size, Expected, Got, i, j;
+	UINT32 ExpectedIndex, GotIndex, SpanSize, ExpectedSpanSize;
+	BYTE *Found, *Span;
+
+	gRandomState = Seed != 0 ? Seed : HARNESS_DEFAULT_SEED;
+
+	if (CheckSearchAfterPeek() == FALSE)
+		return 1;
+
+	Search = (GENERIC_BUFFER_SEARCH*)NULL;
+	NumberOfPatterns = ModelSize = ModelStart = 0;
+
+	for (Operation = 0; Operation < Operations; Operation++)
+	{
+		// start over now and then with a new capacity and new patterns
+		if (Operation % 1000 == 0)
+		{
+			if (Search != (GENERIC_BUFFER_SEARCH*)NULL)
+				GenericBufferSearchDelete(Search);
+
+			HarnessCreateGenericBuffer(&GenericBuffer, HarnessRandomRange(3, HARNESS_CHECK_CAPACITY_IN_BYTES), Ring);
+
+			if ((Search = CreateGenericBufferSearch((GENERIC_BUFFER_SEARCH*)NULL)) == (GENERIC_BUFFER_SEARCH*)NULL)
+				return 2;
+
+			NumberOfPatterns = HarnessRandomRange(1, GENERIC_BUFFER_SEARCH_MAX_PATTERNS);
+
+			// two letters keep partial matches, and so KMP fallbacks, common
+			for (i = 0; i < NumberOfPatterns; i++)
+			{
+				PatternSizes[i] = HarnessRandomRange(1, 4);
+
+				for (j = 0; j < PatternSizes[i]; j++)
+					Patterns[i][j] = (BYTE)"AB"[HarnessRandom() % 2];
+
+				GenericBufferSearchAddPattern(Search, Patterns[i], PatternSizes[i]);
+			}
+
+			ModelSize = ModelStart = 0;
+		}
+
+		Size = HarnessRandomRange(1, 6);
+
+		switch (HarnessRandom() % 5)
+		{
+			case 0:
+			{
+				for (i = 0; i < Size; i++)
+					Data[i] = (BYTE)"ABC"[HarnessRandom() % 3];
+
+				Got = GenericBufferWrite(&GenericBuffer, Size, Data);
+
+				Expected = GenericBuffer.BufferCapacity - ModelSize < Size ? GenericBuffer.BufferCapacity - ModelSize : Size;
+
+				memcpy(&Model[ModelSize], Data, Expected);
+				ModelSize += Expected;
+
+				break;
+			}
+
+			case 1:
+			{
+				Got = GenericBufferRead(&GenericBuffer, Size, Data, sizeof(Data), FALSE);
+
+				Expected = ModelSize < Size ? ModelSize : Size;
+
+				if (Got == Expected && memcmp(Data, Model, Expected) != 0)
+					Got = ~Expected;
+
+				memmove(Model, &Model[Expected], ModelSize - Expected);
+				ModelSize -= Expected;
+				ModelStart = (ModelStart + Expected) % GenericBuffer.BufferCapacity;
+
+				break;
+			}
+
+			case 2:
+			{
+				Got = GenericBufferPeek(&GenericBuffer, Size, Data, sizeof(Data), FALSE);
+
+				Expected = ModelSize < Size ? ModelSize : Size;
+
+				if (Got == Expected && memcmp(Data, Model, Expected) != 0)
+					Got = ~Expected;
+
+				break;
+			}
+
+			case 3:
+			{
+				/*
+					Fill part or all of a write span and commit it, sometimes asking to commit
+					more than the span holds.  A span which was filled up to the end of the
+					Buffer is followed by a second one from the start of it.
+				*/
+				for (j = 0; j < 2; j++)
+				{
+					Span = GenericBufferGetWriteSpan(&GenericBuffer, &SpanSize);
+
+					i = (ModelStart + ModelSize) % GenericBuffer.BufferCapacity;
+					ExpectedSpanSize = GenericBuffer.BufferCapacity - ModelSize < GenericBuffer.BufferCapacity - i ? GenericBuffer.BufferCapacity - ModelSize : GenericBuffer.BufferCapacity - i;
+
+					if (SpanSize != ExpectedSpanSize || Span != (ExpectedSpanSize != 0 ? &Ring[i] : (BYTE*)NULL))
+					{
+						printf("operation %u: write span of %u bytes at %p, wanted %u bytes at %p\n", Operation, SpanSize, (void*)Span, ExpectedSpanSize, (void*)&Ring[i]);
+
+						return 1;
+					}
+
+					Size = HarnessRandom() % 2 == 0 ? SpanSize : HarnessRandomRange(0, SpanSize + 2);
+					Expected = Size < SpanSize ? Size : SpanSize;
+
+					for (i = 0; i < Expected; i++)
+						Span[i] = Model[ModelSize + i] = (BYTE)"ABC"[HarnessRandom() % 3];
+
+					if ((Got = GenericBufferCommitWrite(&GenericBuffer, Size)) != Expected)
+					{
+						printf("operation %u: committed %u of a %u byte write span, wanted %u\n", Operation, Got, SpanSize, Expected);
+
+						return 1;
+					}
+
+					ModelSize += Expected;
+
+					if (Expected == 0 || (ModelStart + ModelSize) % GenericBuffer.BufferCapacity != 0)
+						break;
+				}
+
+				Got = Expected;
+
+				break;
+			}
+
+			default:
+			{
+				/*
+					Check a read span holds the oldest data and consume part or all of it,
+					sometimes running on past the span.  A span which reached the end of the
+					Buffer is followed by a second one from the start of it.
+				*/
+				for (j = 0; j < 2; j++)
+				{
+					Span = GenericBufferGetReadSpan(&GenericBuffer, &SpanSize);
+
+					ExpectedSpanSize = ModelSize < GenericBuffer.BufferCapacity - ModelStart ? ModelSize : GenericBuffer.BufferCapacity - ModelStart;
+
+					if (SpanSize != ExpectedSpanSize || Span != (ExpectedSpanSize != 0 ? &Ring[ModelStart] : (BYTE*)NULL) || memcmp(Span, Model, SpanSize) != 0)
+					{
+						printf("operation %u: read span of %u bytes at %p or the wrong ones, wanted %u bytes at %p\n", Operation, SpanSize, (void*)Span, ExpectedSpanSize, (void*)&Ring[ModelStart]);
+
+						return 1;
+					}
+
+					Size = HarnessRandom() % 2 == 0 ? SpanSize : HarnessRandomRange(0, ModelSize + 2);
+					Expected = Size < ModelSize ? Size : ModelSize;
+
+					if ((Got = GenericBufferConsume(&GenericBuffer, Size)) != Expected)
+					{
+						printf("operation %u: consumed %u bytes, wanted %u\n", Operation, Got, Expected);
+
+						return 1;
+					}
+
+					memmove(Model, &Model[Expected], ModelSize - Expected);
+					ModelSize -= Expected;
+					ModelStart = (ModelStart + Expected) % GenericBuffer.BufferCapacity;
+
+					if (Expected == 0 || ModelStart != 0)
+						break;
+				}
+
+				Got = Expected;
+
+				break;
+			}
+		}
+
+		if (Got != Expected)
+		{
+			printf("operation %u: moved %u bytes or moved the wrong ones, wanted %u\n", Operation, Got, Expected);
+
+			return 1;
+		}
+
+		Data[0] = (BYTE)"ABC"[HarnessRandom() % 3];
+
+		for (i = 0, Expected = 0; i < ModelSize; i++)
+		{
+			if (Model[i] == Data[0])
+				Expected++;
+		}
+
+		if ((Got = GenericBufferContains(&GenericBuffer, Data[0])) != Expected)
+		{
+			printf("operation %u: contains counted %u of %c, wanted %u\n", Operation, Got, Data[0], Expected);
+
+			return 1;
+		}
+
+		Found = (BYTE*)memchr(Model, Data[0], ModelSize);
+		Expected = Found != (BYTE*)NULL ? (UINT32)(Found - Model) + 1 : 0;
+
+		if ((Got = GenericBufferSeek(&GenericBuffer, Data[0])) != Expected)
+		{
+			printf("operation %u: seek found %c at %u, wanted %u\n", Operation, Data[0], Got, Expected);
+
+			return 1;
+		}
+
+		GotIndex = ExpectedIndex = GENERIC_BUFFER_SEARCH_MAX_PATTERNS;
+
+		Got = GenericBufferSearch(&GenericBuffer, Search, &GotIndex);
+		Expected = ExpectedSearch(Model, ModelSize, Patterns, PatternSizes, NumberOfPatterns, &ExpectedIndex);
+
+		if (Got != Expected || (Expected != 0 && GotIndex != ExpectedIndex))
+		{
+			printf("operation %u: search found %u bytes with pattern %u, wanted %u bytes with pattern %u\n", Operation, Got, GotIndex, Expected, ExpectedIndex);
+
+			return 1;
+		}
+	}
+
+	GenericBufferSearchDelete(Search);
+
+	#if (USING_GENERIC_BUFFER_OVERWRITE_MODE == 1)
+		if (CheckOverwrite(Operations) != 0)
+			return 1;
+	#endif // end of #if (USING_GENERIC_BUFFER_OVERWRITE_MODE == 1)
+
+	#if (USING_SPSC_GENERIC_BUFFER_METHODS == 1)
+		if (CheckSPSCSingleThread(Operations) == FALSE || CheckSPSCThreads(Operations) == FALSE)
+			return 1;
+	#endif // end of #if (USING_SPSC_GENERIC_BUFFER_METHODS == 1)
+
+	printf("check, %s scan%s, seed %u, %u operations, ok\n", HARNESS_SCAN_NAME, HARNESS_OVERWRITE_NAME, Seed, Operations);
+
+	return 0;
+}
+
+static void Usage(void)
+{
+	fprintf(stderr, "usage: GenericBufferHarness copy [BytesPerRun]\n");
+	fprintf(stderr, "       GenericBufferHarness check [Seed] [Operations]\n");
+	fprintf(stderr, "       GenericBufferHarness scan [BytesPerRun]\n");
+
+	exit(2);
+}
+
+int main(int argc, char *argv[])
+{
+	UINT32 BytesPerRun, Seed, Operations;
+
+	if (argc < 2)
+		Usage();
+
+	if (strcmp(argv[1], "copy") == 0)
+	{
+		BytesPerRun = argc > 2 ? (UINT32)strtoul(argv[2], (char**)NULL, 0) : HARNESS_DEFAULT_BYTES_PER_RUN;
+
+		if (BytesPerRun < HARNESS_MAXIMUM_CHUNK_SIZE_IN_BYTES)
+			Usage();
+
+		return Copy(BytesPerRun);
+	}
+
+	if (strcmp(argv[1], "scan") == 0)
+	{
+		BytesPerRun = argc > 2 ? (UINT32)strtoul(argv[2], (char**)NULL, 0) : HARNESS_DEFAULT_BYTES_PER_RUN;
+
+		if (BytesPerRun < HARNESS_MAXIMUM_CHUNK_SIZE_IN_BYTES)
+			Usage();
+
+		return Scan(BytesPerRun);
+	}
+
+	if (strcmp(argv[1], "check") == 0)
+	{
+		Seed = argc > 2 ? (UINT32)strtoul(argv[2], (char**)NULL, 0) : HARNESS_DEFAULT_SEED;
+		Operations = argc > 3 ? (UINT32)strtoul(argv[3], (char**)NULL, 0) : HARNESS_DEFAULT_OPERATIONS;
+
+		return Check(Seed, Operations);
+	}
+
+	Usage();
+
+	return 2;
+}
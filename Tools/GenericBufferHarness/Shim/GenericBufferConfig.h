@@ -0,0 +1,76 @@
+/*
+    NexOS Kernel Version v1.02.01
+    Copyright (c) 2023 brodie
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+ */
+
+
+
+/*
+	Host stand in for GenericBufferConfig.h.  It enables every GENERIC_BUFFER method
+	with the same settings as the GenericBufferConfig.h at the top of the tree, but
+	gets its memory from malloc() instead of the NexOS heap so GenericBuffer.c can be
+	built on its own.
+*/
+
+#ifndef GENERIC_BUFFER_CONFIG_H
+	#define GENERIC_BUFFER_CONFIG_H
+
+// overwrite mode is off at the top of the tree, the Makefile builds a harness with it on to check it
+#ifndef GENERIC_BUFFER_HARNESS_OVERWRITE_MODE
+	#define GENERIC_BUFFER_HARNESS_OVERWRITE_MODE			0
+#endif // end of #ifndef GENERIC_BUFFER_HARNESS_OVERWRITE_MODE
+
+#define USING_GENERIC_BUFFER_PEEK_METHOD					1
+#define USING_GENERIC_BUFFER_CONTAINS_METHOD				1
+#define USING_GENERIC_BUFFER_CONTAINS_SEQUENCE_METHOD		1
+#define USING_GENERIC_BUFFER_SEEK_METHOD					1
+#define USING_GENERIC_BUFFER_FLUSH_METHOD					1
+#define USING_GENERIC_BUFFER_GET_SIZE_METHOD				1
+#define USING_GENERIC_BUFFER_GET_CAPACITY_METHOD			1
+#define USING_GENERIC_BUFFER_DELETE_METHOD					1
+#define USING_GENERIC_BUFFER_GET_REMAINING_BYTES_METHOD		1
+#define USING_GENERIC_BUFFER_SPAN_METHODS					1
+#define USING_SPSC_GENERIC_BUFFER_METHODS					1
+#define USING_GENERIC_BUFFER_SEARCH_METHODS					1
+#define USING_GENERIC_BUFFER_VECTOR_METHODS					1
+#define USING_GENERIC_BUFFER_OVERWRITE_MODE					GENERIC_BUFFER_HARNESS_OVERWRITE_MODE
+#define USING_GENERIC_BUFFER_GET_LIBRARY_VERSION			1
+#define GENERIC_BUFFER_SAFE_MODE							1
+
+// the Makefile builds the harness once with each scan so the two can be compared
+#ifndef GENERIC_BUFFER_HARNESS_WORD_SCAN
+	#define GENERIC_BUFFER_HARNESS_WORD_SCAN				1
+#endif // end of #ifndef GENERIC_BUFFER_HARNESS_WORD_SCAN
+
+#define GENERIC_BUFFER_WORD_SCAN							GENERIC_BUFFER_HARNESS_WORD_SCAN
+
+// a full fence, the harness runs the SPSC_GENERIC_BUFFER check on two threads which may be on two CPUs
+#define GenericBufferMemoryBarrier()						__sync_synchronize()
+
+#define GENERIC_BUFFER_SEARCH_MAX_PATTERNS					4
+#define GENERIC_BUFFER_SEARCH_MAX_PATTERN_SIZE_IN_BYTES		8
+
+#define GENERIC_BUFFER_USE_MALLOC							1
+
+#define BufferMemAlloc(Mem)									malloc(Mem)
+#define BufferMemDealloc(Mem)								free(Mem)
+
+#endif // end of GENERIC_BUFFER_CONFIG_H
@@ -0,0 +1,1546 @@
+/*
+    NexOS Kernel Version v1.02.01
+    Copyright (c) 2023 brodie
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+ */
+
+
+/*
+	Host harness for NexOS/Kernel/Memory.c.
+
+	Memory.c is compiled unchanged against the headers in Shim/, once with the first
+	fit allocator and once with TLSF, and driven with synthetic workloads which are
+	known to fragment a heap, or with a trace recorded on the target.  Every
+	allocation and release is timed and the heap is walked with GetHeapStatistics()
+	after each one, so the two allocators can be compared on latency, fragmentation
+	and how often a request fails.
+
+	Usage:
+		HeapHarness stress [Seed] [OperationsPerWorkload]
+			Runs every synthetic workload and prints one line of results for each.
+
+		HeapHarness trace Workload [Seed] [Operations]
+			Runs one synthetic workload and writes what it did to stdout as a trace in
+			the format IOBufferWriteMemoryTrace() uses, so it can be replayed or fed
+			to Tools/MemoryTraceAnalyzer.py.
+
+		HeapHarness replay Trace...
+			Replays traces written by IOBufferWriteMemoryTrace() or by the trace
+			command and prints the same results as stress.
+
+		HeapHarness fuzz [Seed] [Operations]
+			Calls every heap method at random with random arguments and checks the
+			heap with CheckHeapIntegrity() after each call, along with the contents,
+			alignment and zeroing of every live block.  Stops at the first problem
+			and prints the operation it happened on.
+
+		HeapHarness accounting [Seed] [Operations]
+			Only in the binaries built with HEAP_HARNESS_ACCOUNTING.  Allocates,
+			resizes, hands over and releases blocks as several TASKs with random
+			quotas, while an interrupt allocates and releases its own blocks every
+			time the last critical section is left.  Checks that each TASK owns
+			exactly the blocks it should after every operation, that a quota is never
+			overrun, and that a TASK owns nothing after its memory is reclaimed or
+			after every block is released.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "RTOSConfig.h"
+#include "Memory.h"
+
+#if (USING_TASK_HEAP_ACCOUNTING == 1)
+	#include "Kernel.h"
+#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
+
+#define HARNESS_MAXIMUM_LIVE_BLOCKS						1024
+#define HARNESS_MAXIMUM_REPLAY_BLOCKS					4096
+#define HARNESS_MAXIMUM_FUZZ_BLOCKS						512
+#define HARNESS_FUZZ_REGION_SIZE_IN_WORDS				2048
+#define HARNESS_DEFAULT_SEED							1
+#define HARNESS_DEFAULT_OPERATIONS						200000
+#define HARNESS_ACCOUNTING_TASKS						4
+#define HARNESS_MAXIMUM_ISR_BLOCKS						16
+
+#if (USING_TLSF_MEMORY_ALLOCATOR == 1)
+	#define HARNESS_ALLOCATOR_NAME						"TLSF"
+#else
+	#define HARNESS_ALLOCATOR_NAME						"first fit"
+#endif // end of #if (USING_TLSF_MEMORY_ALLOCATOR == 1)
+
+typedef struct
+{
+	UINT32 *Samples;
+	UINT32 Count;
+	UINT32 Size;
+}LATENCY_SAMPLES;
+
+typedef struct
+{
+	LATENCY_SAMPLES AllocateLatency;
+	LATENCY_SAMPLES ReleaseLatency;
+	UINT32 Operations;
+	UINT32 Allocations;
+	UINT32 Failures;
+	UINT32 FragmentationFailures; // failures where the heap had enough free bytes, just not in one block
+	UINT32 PeakFragmentationPercent;
+	UINT64 FragmentationPercentSum;
+	UINT32 PeakHeapUsedInBytes;
+}HARNESS_RESULTS;
+
+typedef struct
+{
+	void *Ptr;
+	UINT32 SizeInBytes;
+	UINT32 ReleaseAtOperation; // used by the mixed lifetime workload
+}HARNESS_BLOCK;
+
+typedef struct
+{
+	HARNESS_BLOCK Blocks[HARNESS_MAXIMUM_LIVE_BLOCKS];
+	UINT32 Count;
+}HARNESS_LIVE_BLOCKS;
+
+typedef void (*HARNESS_WORKLOAD)(HARNESS_RESULTS *Results, HARNESS_LIVE_BLOCKS *LiveBlocks, UINT32 Operation);
+
+typedef struct
+{
+	const char *Name;
+	const char *ShortName; // what the trace command takes
+	HARNESS_WORKLOAD Workload;
+}HARNESS_WORKLOAD_INFO;
+
+typedef struct
+{
+	UINT32 TracePtr; // the address the target handed out
+	void *Ptr; // where the same block is in the harness heap
+}HARNESS_REPLAY_BLOCK;
+
+typedef enum
+{
+	FUZZ_HEAP_BLOCK = 0,
+	FUZZ_ALIGNED_BLOCK,
+	FUZZ_REGION_BLOCK,
+	FUZZ_TASK_STACK_BLOCK
+}FUZZ_BLOCK_KIND;
+
+typedef struct
+{
+	BYTE *Ptr;
+	UINT32 SizeInBytes;
+	UINT32 AlignmentInBytes;
+	BYTE Fill;
+	FUZZ_BLOCK_KIND Kind;
+}FUZZ_BLOCK;
+
+#if (USING_TASK_HEAP_ACCOUNTING == 1)
+	typedef struct
+	{
+		BYTE *Ptr;
+		UINT32 SizeInBytes;
+		TASK *Owner; // NULL for a block an ISR allocated
+		BYTE Fill;
+	}ACCOUNTING_BLOCK;
+#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
+
+static UINT32 gRandomState;
+
+// set by the trace command, every heap call made through the harness is written to it
+static FILE *gTraceFile = (FILE*)NULL;
+static UINT32 gTraceTick;
+
+// AddHeapRegion() only works before the OS is started
+BOOL gCPUSchedulerRunning = FALSE;
+
+#if (USING_TASK_HEAP_ACCOUNTING == 1)
+	// who AllocateMemory() charges once gCPUSchedulerRunning is TRUE
+	TASK * volatile gCurrentTask = (TASK*)NULL;
+#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
+
+static UINT32 gCriticalCount;
+
+// set by the accounting command, called as if an interrupt came in whenever the last critical section is left
+static void (*gHarnessInterrupt)(void) = (void(*)(void))NULL;
+
+// The harness is single threaded, the count is only kept to know when interrupts would be back on.
+void EnterCritical(void)
+{
+	gCriticalCount++;
+}
+
+void ExitCritical(void)
+{
+	void (*Interrupt)(void) = gHarnessInterrupt;
+
+	if (--gCriticalCount == 0 && Interrupt != (void(*)(void))NULL)
+	{
+		// the interrupt leaves critical sections of its own, it must not come in on top of itself
+		gHarnessInterrupt = (void(*)(void))NULL;
+
+		Interrupt();
+
+		gHarnessInterrupt = Interrupt;
+	}
+}
+
+// xorshift32, so a seed gives the same run on any host C library
+static UINT32 HarnessRandom(void)
+{
+	gRandomState ^= gRandomState << 13;
+	gRandomState ^= gRandomState >> 17;
+	gRandomState ^= gRandomState << 5;
+
+	return gRandomState;
+}
+
+static UINT32 HarnessRandomRange(UINT32 Minimum, UINT32 Maximum)
+{
+	return Minimum + (HarnessRandom() % (Maximum - Minimum + 1));
+}
+
+static void HarnessSeed(UINT32 Seed)
+{
+	gRandomState = Seed != 0 ? Seed : HARNESS_DEFAULT_SEED;
+}
+
+static UINT64 HarnessNow(void)
+{
+	struct timespec Now;
+
+	clock_gettime(CLOCK_MONOTONIC, &Now);
+
+	return (UINT64)Now.tv_sec * 1000000000ULL + (UINT64)Now.tv_nsec;
+}
+
+static void AddLatencySample(LATENCY_SAMPLES *LatencySamples, UINT64 Nanoseconds)
+{
+	if (LatencySamples->Count == LatencySamples->Size)
+	{
+		LatencySamples->Size = LatencySamples->Size != 0 ? LatencySamples->Size * 2 : 4096;
+
+		if ((LatencySamples->Samples = (UINT32*)realloc(LatencySamples->Samples, LatencySamples->Size * sizeof(UINT32))) == (UINT32*)NULL)
+		{
+			fprintf(stderr, "out of host memory\n");
+			exit(2);
+		}
+	}
+
+	LatencySamples->Samples[LatencySamples->Count++] = Nanoseconds > 0xFFFFFFFF ? 0xFFFFFFFF : (UINT32)Nanoseconds;
+}
+
+static int CompareLatency(const void *First, const void *Second)
+{
+	UINT32 FirstValue = *(const UINT32*)First, SecondValue = *(const UINT32*)Second;
+
+	return (FirstValue > SecondValue) - (FirstValue < SecondValue);
+}
+
+static UINT32 LatencyPercentile(LATENCY_SAMPLES *LatencySamples, UINT32 Percentile)
+{
+	UINT32 Index;
+
+	if (LatencySamples->Count == 0)
+		return 0;
+
+	// nearest rank, the samples are sorted by then
+	Index = (UINT32)(((UINT64)LatencySamples->Count * Percentile + 99) / 100);
+
+	return LatencySamples->Samples[Index != 0 ? Index - 1 : 0];
+}
+
+static void SampleHeap(HARNESS_RESULTS *Results)
+{
+	HEAP_STATISTICS HeapStatistics;
+	UINT32 HeapUsedInBytes = GetHeapUsedInBytes();
+
+	if (HeapUsedInBytes > Results->PeakHeapUsedInBytes)
+		Results->PeakHeapUsedInBytes = HeapUsedInBytes;
+
+	if (GetHeapStatistics(&HeapStatistics) == FALSE)
+		return;
+
+	if (HeapStatistics.FragmentationPercent > Results->PeakFragmentationPercent)
+		Results->PeakFragmentationPercent = HeapStatistics.FragmentationPercent;
+
+	Results->FragmentationPercentSum += HeapStatistics.FragmentationPercent;
+}
+
+static void *HarnessAllocate(HARNESS_RESULTS *Results, UINT32 SizeInBytes)
+{
+	void *Ptr;
+	UINT64 Start;
+
+	Start = HarnessNow();
+
+	Ptr = AllocateMemory(SizeInBytes);
+
+	AddLatencySample(&Results->AllocateLatency, HarnessNow() - Start);
+
+	Results->Operations++;
+	Results->Allocations++;
+
+	if (gTraceFile != (FILE*)NULL && Ptr != (void*)NULL)
+		fprintf(gTraceFile, "A %u %08X %08X %08X %u\r\n", gTraceTick, 0, 0, (unsigned int)(OS_WORD)Ptr, SizeInBytes);
+
+	if (Ptr == (void*)NULL)
+	{
+		Results->Failures++;
+
+		// the header is the only thing besides the data a block needs
+		if (GetHeapRemainingInBytes() >= SizeInBytes + OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES)
+			Results->FragmentationFailures++;
+	}
+
+	SampleHeap(Results);
+
+	return Ptr;
+}
+
+static void HarnessRelease(HARNESS_RESULTS *Results, void *Ptr)
+{
+	UINT64 Start;
+
+	Start = HarnessNow();
+
+	if (ReleaseMemory(Ptr) == FALSE)
+	{
+		fprintf(stderr, "ReleaseMemory(%p) failed\n", Ptr);
+		exit(1);
+	}
+
+	AddLatencySample(&Results->ReleaseLatency, HarnessNow() - Start);
+
+	Results->Operations++;
+
+	if (gTraceFile != (FILE*)NULL)
+		fprintf(gTraceFile, "R %u %08X %08X %08X %u\r\n", gTraceTick, 0, 0, (unsigned int)(OS_WORD)Ptr, 0);
+
+	SampleHeap(Results);
+}
+
+static void *HarnessResize(HARNESS_RESULTS *Results, void *Ptr, UINT32 SizeInBytes)
+{
+	void *NewPtr;
+	UINT64 Start;
+
+	Start = HarnessNow();
+
+	NewPtr = ReallocMemory(Ptr, SizeInBytes);
+
+	// a resize is an allocation as far as the caller is concerned
+	AddLatencySample(&Results->AllocateLatency, HarnessNow() - Start);
+
+	Results->Operations++;
+	Results->Allocations++;
+
+	// the target only records a resize done in place, a move is a release and an allocation
+	if (gTraceFile != (FILE*)NULL && NewPtr != (void*)NULL)
+	{
+		if (NewPtr == Ptr)
+		{
+			fprintf(gTraceFile, "S %u %08X %08X %08X %u\r\n", gTraceTick, 0, 0, (unsigned int)(OS_WORD)Ptr, SizeInBytes);
+		}
+		else
+		{
+			fprintf(gTraceFile, "A %u %08X %08X %08X %u\r\n", gTraceTick, 0, 0, (unsigned int)(OS_WORD)NewPtr, SizeInBytes);
+			fprintf(gTraceFile, "R %u %08X %08X %08X %u\r\n", gTraceTick, 0, 0, (unsigned int)(OS_WORD)Ptr, 0);
+		}
+	}
+
+	if (NewPtr == (void*)NULL)
+	{
+		Results->Failures++;
+
+		if (GetHeapRemainingInBytes() >= SizeInBytes + OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES)
+			Results->FragmentationFailures++;
+	}
+
+	SampleHeap(Results);
+
+	return NewPtr;
+}
+
+static void AddLiveBlock(HARNESS_LIVE_BLOCKS *LiveBlocks, void *Ptr, UINT32 SizeInBytes, UINT32 ReleaseAtOperation)
+{
+	HARNESS_BLOCK *Block = &LiveBlocks->Blocks[LiveBlocks->Count++];
+
+	Block->Ptr = Ptr;
+	Block->SizeInBytes = SizeInBytes;
+	Block->ReleaseAtOperation = ReleaseAtOperation;
+}
+
+static void ReleaseLiveBlock(HARNESS_RESULTS *Results, HARNESS_LIVE_BLOCKS *LiveBlocks, UINT32 Index)
+{
+	HarnessRelease(Results, LiveBlocks->Blocks[Index].Ptr);
+
+	LiveBlocks->Blocks[Index] = LiveBlocks->Blocks[--LiveBlocks->Count];
+}
+
+/*
+	Small blocks of any size from 8 to 256 bytes, allocated and released at random
+	around a live set of 150 blocks.  This is the common case of messages and nodes.
+*/
+static void SteadyWorkload(HARNESS_RESULTS *Results, HARNESS_LIVE_BLOCKS *LiveBlocks, UINT32 Operation)
+{
+	void *Ptr;
+	UINT32 SizeInBytes;
+
+	if (LiveBlocks->Count != 0 && (LiveBlocks->Count >= 150 || (HarnessRandom() & 1) == 0))
+	{
+		ReleaseLiveBlock(Results, LiveBlocks, HarnessRandom() % LiveBlocks->Count);
+	}
+	else
+	{
+		SizeInBytes = HarnessRandomRange(8, 256);
+
+		if ((Ptr = HarnessAllocate(Results, SizeInBytes)) != (void*)NULL)
+			AddLiveBlock(LiveBlocks, Ptr, SizeInBytes, 0);
+	}
+}
+
+/*
+	Mostly short lived small blocks with every tenth block a long lived one of up to
+	1KB.  The long lived blocks pin the heap down between the short lived ones, which
+	is what breaks a first fit heap up over weeks of uptime.
+*/
+static void MixedLifetimeWorkload(HARNESS_RESULTS *Results, HARNESS_LIVE_BLOCKS *LiveBlocks, UINT32 Operation)
+{
+	void *Ptr;
+	UINT32 i, SizeInBytes, Lifetime;
+
+	for (i = 0; i < LiveBlocks->Count; i++)
+	{
+		if (LiveBlocks->Blocks[i].ReleaseAtOperation <= Operation)
+		{
+			ReleaseLiveBlock(Results, LiveBlocks, i);
+
+			return;
+		}
+	}
+
+	if (LiveBlocks->Count == HARNESS_MAXIMUM_LIVE_BLOCKS)
+	{
+		ReleaseLiveBlock(Results, LiveBlocks, HarnessRandom() % LiveBlocks->Count);
+
+		return;
+	}
+
+	if (HarnessRandom() % 10 == 0)
+	{
+		SizeInBytes = HarnessRandomRange(128, 1024);
+		Lifetime = HarnessRandomRange(2000, 20000);
+	}
+	else
+	{
+		SizeInBytes = HarnessRandomRange(16, 64);
+		Lifetime = HarnessRandomRange(1, 64);
+	}
+
+	if ((Ptr = HarnessAllocate(Results, SizeInBytes)) != (void*)NULL)
+		AddLiveBlock(LiveBlocks, Ptr, SizeInBytes, Operation + Lifetime);
+}
+
+/*
+	Blocks of 16 bytes to 2KB are allocated until the heap is full, then three out of
+	four are released at random and the heap is filled again.  This shows how much of
+	the heap is still usable once it has been broken up.
+*/
+static void SawtoothWorkload(HARNESS_RESULTS *Results, HARNESS_LIVE_BLOCKS *LiveBlocks, UINT32 Operation)
+{
+	static BOOL Draining = FALSE;
+	void *Ptr;
+	UINT32 SizeInBytes;
+
+	if (Operation == 0)
+		Draining = FALSE;
+
+	if (Draining == TRUE)
+	{
+		if (LiveBlocks->Count > 0 && HarnessRandom() % 4 != 0)
+			ReleaseLiveBlock(Results, LiveBlocks, HarnessRandom() % LiveBlocks->Count);
+
+		// stop once about a quarter of the blocks are left
+		if (LiveBlocks->Count == 0 || HarnessRandom() % (LiveBlocks->Count + 1) == 0)
+			Draining = FALSE;
+
+		return;
+	}
+
+	if (LiveBlocks->Count == HARNESS_MAXIMUM_LIVE_BLOCKS)
+	{
+		Draining = TRUE;
+
+		return;
+	}
+
+	SizeInBytes = HarnessRandomRange(16, 2048);
+
+	if ((Ptr = HarnessAllocate(Results, SizeInBytes)) != (void*)NULL)
+		AddLiveBlock(LiveBlocks, Ptr, SizeInBytes, 0);
+	else
+		Draining = TRUE;
+}
+
+/*
+	Buffers which grow a little at a time with ReallocMemory(), like a line being
+	assembled from a UART, among small blocks which come and go.
+*/
+static void GrowingBufferWorkload(HARNESS_RESULTS *Results, HARNESS_LIVE_BLOCKS *LiveBlocks, UINT32 Operation)
+{
+	void *Ptr;
+	UINT32 Index, SizeInBytes;
+
+	if (LiveBlocks->Count != 0 && HarnessRandom() % 3 == 0)
+	{
+		Index = HarnessRandom() % LiveBlocks->Count;
+
+		if (LiveBlocks->Blocks[Index].SizeInBytes < 1024 && HarnessRandom() % 4 != 0)
+		{
+			SizeInBytes = LiveBlocks->Blocks[Index].SizeInBytes + HarnessRandomRange(8, 64);
+
+			if ((Ptr = HarnessResize(Results, LiveBlocks->Blocks[Index].Ptr, SizeInBytes)) != (void*)NULL)
+			{
+				LiveBlocks->Blocks[Index].Ptr = Ptr;
+				LiveBlocks->Blocks[Index].SizeInBytes = SizeInBytes;
+			}
+		}
+		else
+		{
+			ReleaseLiveBlock(Results, LiveBlocks, Index);
+		}
+
+		return;
+	}
+
+	if (LiveBlocks->Count >= 200)
+	{
+		ReleaseLiveBlock(Results, LiveBlocks, HarnessRandom() % LiveBlocks->Count);
+
+		return;
+	}
+
+	SizeInBytes = HarnessRandomRange(8, 96);
+
+	if ((Ptr = HarnessAllocate(Results, SizeInBytes)) != (void*)NULL)
+		AddLiveBlock(LiveBlocks, Ptr, SizeInBytes, 0);
+}
+
+static void PrintResultsHeader(void)
+{
+	printf("%-16s %8s %8s %7s %10s %9s %9s %10s %22s %22s\n", "workload", "ops", "allocs", "fail%", "frag fail%", "peak frag", "mean frag", "peak used", "alloc p50/p99/max ns", "release p50/p99/max ns");
+}
+
+static void PrintResults(const char *Name, HARNESS_RESULTS *Results)
+{
+	char AllocateLatency[32], ReleaseLatency[32];
+
+	qsort(Results->AllocateLatency.Samples, Results->AllocateLatency.Count, sizeof(UINT32), CompareLatency);
+	qsort(Results->ReleaseLatency.Samples, Results->ReleaseLatency.Count, sizeof(UINT32), CompareLatency);
+
+	snprintf(AllocateLatency, sizeof(AllocateLatency), "%u/%u/%u", LatencyPercentile(&Results->AllocateLatency, 50), LatencyPercentile(&Results->AllocateLatency, 99), LatencyPercentile(&Results->AllocateLatency, 100));
+	snprintf(ReleaseLatency, sizeof(ReleaseLatency), "%u/%u/%u", LatencyPercentile(&Results->ReleaseLatency, 50), LatencyPercentile(&Results->ReleaseLatency, 99), LatencyPercentile(&Results->ReleaseLatency, 100));
+
+	printf("%-16s %8u %8u %6.2f%% %9.2f%% %8u%% %8.1f%% %10u %22s %22s\n", Name, Results->Operations, Results->Allocations,
+		Results->Allocations != 0 ? 100.0 * Results->Failures / Results->Allocations : 0.0,
+		Results->Allocations != 0 ? 100.0 * Results->FragmentationFailures / Results->Allocations : 0.0,
+		Results->PeakFragmentationPercent,
+		Results->Operations != 0 ? (double)Results->FragmentationPercentSum / Results->Operations : 0.0,
+		Results->PeakHeapUsedInBytes, AllocateLatency, ReleaseLatency);
+}
+
+static void FreeResults(HARNESS_RESULTS *Results)
+{
+	free(Results->AllocateLatency.Samples);
+	free(Results->ReleaseLatency.Samples);
+}
+
+static void RunWorkload(const char *Name, HARNESS_WORKLOAD Workload, UINT32 Seed, UINT32 Operations)
+{
+	static HARNESS_LIVE_BLOCKS LiveBlocks;
+	HARNESS_RESULTS Results;
+	UINT32 Operation;
+
+	memset(&Results, 0, sizeof(Results));
+
+	LiveBlocks.Count = 0;
+
+	OS_InitializeHeap();
+
+	HarnessSeed(Seed);
+
+	for (Operation = 0; Operation < Operations; Operation++)
+		Workload(&Results, &LiveBlocks, Operation);
+
+	while (LiveBlocks.Count != 0)
+		ReleaseLiveBlock(&Results, &LiveBlocks, LiveBlocks.Count - 1);
+
+	if (GetHeapUsedInBytes() != 0 || CheckHeapIntegrity() == FALSE)
+	{
+		fprintf(stderr, "%s: the heap did not come back whole\n", Name);
+		exit(1);
+	}
+
+	PrintResults(Name, &Results);
+
+	FreeResults(&Results);
+}
+
+// every latency sample includes one call to HarnessNow(), this is what that costs
+static UINT32 TimerOverhead(void)
+{
+	LATENCY_SAMPLES LatencySamples;
+	UINT32 i, Overhead;
+	UINT64 Start;
+
+	memset(&LatencySamples, 0, sizeof(LatencySamples));
+
+	for (i = 0; i < 10000; i++)
+	{
+		Start = HarnessNow();
+
+		AddLatencySample(&LatencySamples, HarnessNow() - Start);
+	}
+
+	qsort(LatencySamples.Samples, LatencySamples.Count, sizeof(UINT32), CompareLatency);
+
+	Overhead = LatencyPercentile(&LatencySamples, 50);
+
+	free(LatencySamples.Samples);
+
+	return Overhead;
+}
+
+static const HARNESS_WORKLOAD_INFO gWorkloads[] =
+{
+	{ "steady", "steady", SteadyWorkload },
+	{ "mixed lifetime", "mixed", MixedLifetimeWorkload },
+	{ "sawtooth", "sawtooth", SawtoothWorkload },
+	{ "growing buffer", "growing", GrowingBufferWorkload }
+};
+
+#define HARNESS_NUMBER_OF_WORKLOADS						(sizeof(gWorkloads) / sizeof(gWorkloads[0]))
+
+static int Stress(UINT32 Seed, UINT32 Operations)
+{
+	UINT32 i;
+
+	printf("allocator %s, %u byte heap, seed %u, %u operations per workload, timer overhead %u ns\n", HARNESS_ALLOCATOR_NAME, OS_HEAP_SIZE_IN_BYTES, Seed, Operations, TimerOverhead());
+
+	PrintResultsHeader();
+
+	for (i = 0; i < HARNESS_NUMBER_OF_WORKLOADS; i++)
+		RunWorkload(gWorkloads[i].Name, gWorkloads[i].Workload, Seed, Operations);
+
+	return 0;
+}
+
+static int Trace(const char *ShortName, UINT32 Seed, UINT32 Operations)
+{
+	static HARNESS_LIVE_BLOCKS LiveBlocks;
+	HARNESS_RESULTS Results;
+	UINT32 i;
+
+	for (i = 0; i < HARNESS_NUMBER_OF_WORKLOADS; i++)
+		if (strcmp(gWorkloads[i].ShortName, ShortName) == 0)
+			break;
+
+	if (i == HARNESS_NUMBER_OF_WORKLOADS)
+	{
+		fprintf(stderr, "unknown workload %s\n", ShortName);
+
+		return 2;
+	}
+
+	memset(&Results, 0, sizeof(Results));
+
+	OS_InitializeHeap();
+
+	HarnessSeed(Seed);
+
+	gTraceFile = stdout;
+
+	// one operation is one tick, the analyzer only uses ticks for rates
+	for (gTraceTick = 0; gTraceTick < Operations; gTraceTick++)
+		gWorkloads[i].Workload(&Results, &LiveBlocks, gTraceTick);
+
+	gTraceFile = (FILE*)NULL;
+
+	FreeResults(&Results);
+
+	return 0;
+}
+
+static HARNESS_REPLAY_BLOCK *FindReplayBlock(HARNESS_REPLAY_BLOCK *ReplayBlocks, UINT32 Count, UINT32 TracePtr)
+{
+	UINT32 i;
+
+	for (i = 0; i < Count; i++)
+		if (ReplayBlocks[i].TracePtr == TracePtr)
+			return &ReplayBlocks[i];
+
+	return (HARNESS_REPLAY_BLOCK*)NULL;
+}
+
+/*
+	A record for a block the harness does not have is counted and skipped.  That
+	happens when the allocation failed here but not on the target, when the trace
+	started after the block was allocated, or when records were dropped.
+*/
+static int Replay(int NumberOfFiles, char *FileNames[])
+{
+	static HARNESS_REPLAY_BLOCK ReplayBlocks[HARNESS_MAXIMUM_REPLAY_BLOCKS];
+	HARNESS_RESULTS Results;
+	HARNESS_REPLAY_BLOCK *ReplayBlock;
+	UINT32 Count = 0, Unmatched = 0, Dropped = 0, Tick, Task, Caller, TracePtr, SizeInBytes;
+	char Line[128], Type;
+	void *Ptr;
+	FILE *File;
+	int i;
+
+	memset(&Results, 0, sizeof(Results));
+
+	OS_InitializeHeap();
+
+	for (i = 0; i < NumberOfFiles; i++)
+	{
+		if ((File = fopen(FileNames[i], "r")) == (FILE*)NULL)
+		{
+			perror(FileNames[i]);
+
+			return 2;
+		}
+
+		while (fgets(Line, sizeof(Line), File) != (char*)NULL)
+		{
+			if (sscanf(Line, "D %u", &SizeInBytes) == 1)
+			{
+				Dropped += SizeInBytes;
+
+				continue;
+			}
+
+			if (sscanf(Line, "%c %u %x %x %x %u", &Type, &Tick, &Task, &Caller, &TracePtr, &SizeInBytes) != 6)
+				continue;
+
+			ReplayBlock = FindReplayBlock(ReplayBlocks, Count, TracePtr);
+
+			if (Type == 'A')
+			{
+				// the target handed out a block it never released, give ours back so the heap does not fill up
+				if (ReplayBlock != (HARNESS_REPLAY_BLOCK*)NULL)
+				{
+					Unmatched++;
+
+					HarnessRelease(&Results, ReplayBlock->Ptr);
+
+					*ReplayBlock = ReplayBlocks[--Count];
+				}
+
+				if ((Ptr = HarnessAllocate(&Results, SizeInBytes)) == (void*)NULL)
+					continue;
+
+				if (Count == HARNESS_MAXIMUM_REPLAY_BLOCKS)
+				{
+					fprintf(stderr, "more than %u live blocks, raise HARNESS_MAXIMUM_REPLAY_BLOCKS\n", HARNESS_MAXIMUM_REPLAY_BLOCKS);
+
+					return 2;
+				}
+
+				ReplayBlocks[Count].TracePtr = TracePtr;
+				ReplayBlocks[Count++].Ptr = Ptr;
+			}
+			else if (ReplayBlock == (HARNESS_REPLAY_BLOCK*)NULL)
+			{
+				Unmatched++;
+			}
+			else if (Type == 'R')
+			{
+				HarnessRelease(&Results, ReplayBlock->Ptr);
+
+				*ReplayBlock = ReplayBlocks[--Count];
+			}
+			else if (Type == 'S')
+			{
+				if ((Ptr = HarnessResize(&Results, ReplayBlock->Ptr, SizeInBytes)) != (void*)NULL)
+					ReplayBlock->Ptr = Ptr;
+			}
+		}
+
+		fclose(File);
+	}
+
+	printf("allocator %s, %u byte heap, %u blocks still live, %u records unmatched, %u records dropped on the target\n", HARNESS_ALLOCATOR_NAME, OS_HEAP_SIZE_IN_BYTES, Count, Unmatched, Dropped);
+
+	PrintResultsHeader();
+
+	PrintResults(NumberOfFiles == 1 ? FileNames[0] : "replay", &Results);
+
+	FreeResults(&Results);
+
+	return 0;
+}
+
+static BOOL FuzzCheckBlock(FUZZ_BLOCK *Block)
+{
+	UINT32 i;
+
+	if (((OS_WORD)Block->Ptr & (Block->AlignmentInBytes - 1)) != 0)
+		return FALSE;
+
+	for (i = 0; i < Block->SizeInBytes; i++)
+		if (Block->Ptr[i] != Block->Fill)
+			return FALSE;
+
+	return TRUE;
+}
+
+static void FuzzAddBlock(FUZZ_BLOCK *Blocks, UINT32 *Count, void *Ptr, UINT32 SizeInBytes, UINT32 AlignmentInBytes, FUZZ_BLOCK_KIND Kind)
+{
+	FUZZ_BLOCK *Block = &Blocks[(*Count)++];
+
+	Block->Ptr = (BYTE*)Ptr;
+	Block->SizeInBytes = SizeInBytes;
+	Block->AlignmentInBytes = AlignmentInBytes;
+	Block->Kind = Kind;
+	Block->Fill = (BYTE)HarnessRandom();
+
+	memset(Block->Ptr, Block->Fill, SizeInBytes);
+}
+
+/*
+	Flips a bit in the size and then the allocated flag of a block header, which
+	CheckHeapIntegrity() has to notice, and puts them back.  Without this a fuzzer
+	which never fails could just mean a checker which never fails.
+*/
+static BOOL FuzzCheckIntegrityCanFail(void)
+{
+	OS_WORD *Header;
+	BOOL Caught = TRUE;
+	void *First, *Second;
+
+	First = AllocateMemory(40);
+	Second = AllocateMemory(40);
+
+	if (First == (void*)NULL || Second == (void*)NULL)
+		return FALSE;
+
+	// the size is the low bits of the first header word, the allocated flag is above it
+	Header = (OS_WORD*)((OS_MEMORY_BLOCK_HEADER*)First - 1);
+
+	Header[0] ^= 0x10;
+	Caught &= (CheckHeapIntegrity() == FALSE);
+	Header[0] ^= 0x10;
+
+	Header = (OS_WORD*)((OS_MEMORY_BLOCK_HEADER*)Second - 1);
+
+	Header[1] ^= 1;
+	Caught &= (CheckHeapIntegrity() == FALSE);
+	Header[1] ^= 1;
+
+	Caught &= (CheckHeapIntegrity() == TRUE);
+
+	ReleaseMemory(Second);
+	ReleaseMemory(First);
+
+	return Caught;
+}
+
+/*
+	Gets an 8 byte aligned block which happens to sit on a 1024 byte boundary, fills
+	the heap so no free block is that big, then grows it.  ReallocMemory() has to ask
+	for the 8 bytes it was given, not the 1024 the address looks like.
+*/
+static BOOL FuzzCheckReallocKeepsAlignment(void)
+{
+	static void *Blocks[HARNESS_MAXIMUM_FUZZ_BLOCKS];
+	UINT32 Count = 0, FirstFiller, LastFiller, DistanceInBytes, i;
+	void *Ptr = (void*)NULL, *Grown = (void*)NULL;
+
+	while (Count < HARNESS_MAXIMUM_FUZZ_BLOCKS && (Ptr = AllocateAlignedMemory(8, 8)) != (void*)NULL && ((OS_WORD)Ptr & 1023) != 0)
+	{
+		DistanceInBytes = 1024 - ((OS_WORD)Ptr & 1023);
+
+		if (DistanceInBytes < OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES + OS_WORD_SIZE_IN_BYTES)
+			DistanceInBytes += 1024;
+
+		ReleaseMemory(Ptr);
+
+		Ptr = (void*)NULL;
+
+		// a block where that one was, ending just where the next header has to go for its space to be on the boundary
+		if ((Blocks[Count] = AllocateMemory(DistanceInBytes - OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES)) == (void*)NULL)
+			break;
+
+		Count++;
+	}
+
+	FirstFiller = Count;
+
+	while (Count < HARNESS_MAXIMUM_FUZZ_BLOCKS && (Blocks[Count] = AllocateMemory(512)) != (void*)NULL)
+		Count++;
+
+	LastFiller = Count;
+
+	while (Count < HARNESS_MAXIMUM_FUZZ_BLOCKS && (Blocks[Count] = AllocateMemory(8)) != (void*)NULL)
+		Count++;
+
+	// every other 512 byte block released leaves holes big enough to grow into, just not 1024 bytes big, and
+	// the one right after the block stays so it cannot grow where it is
+	for (i = FirstFiller + 1; i < LastFiller; i += 2)
+	{
+		ReleaseMemory(Blocks[i]);
+
+		Blocks[i] = (void*)NULL;
+	}
+
+	if (Ptr != (void*)NULL)
+		Grown = ReallocMemory(Ptr, 64);
+
+	for (i = 0; i < Count; i++)
+		if (Blocks[i] != (void*)NULL)
+			ReleaseMemory(Blocks[i]);
+
+	ReleaseMemory(Grown != (void*)NULL ? Grown : Ptr);
+
+	return (BOOL)(Grown != (void*)NULL && ((OS_WORD)Grown & 7) == 0 && CheckHeapIntegrity() == TRUE && GetHeapUsedInBytes() == 0);
+}
+
+static int Fuzz(UINT32 Seed, UINT32 Operations)
+{
+	static FUZZ_BLOCK Blocks[HARNESS_MAXIMUM_FUZZ_BLOCKS];
+	static OS_WORD RegionMemory[HARNESS_FUZZ_REGION_SIZE_IN_WORDS];
+	static const char *OperationNames[] = { "AllocateMemory", "AllocateAlignedMemory", "CallocMemory", "AllocateMemoryFromRegion", "OS_AllocateTaskStackMemory", "ReallocMemory", "ReleaseMemory" };
+	HEAP_REGION_ID RegionID;
+	FUZZ_BLOCK *Block;
+	BOOL Released;
+	UINT32 Count = 0, Operation, Kind, Index, SizeInBytes, AlignmentInBytes, NumberOfItems, i;
+	UINT32 Calls[7], Failures[7];
+	void *Ptr;
+
+	memset(Calls, 0, sizeof(Calls));
+	memset(Failures, 0, sizeof(Failures));
+
+	HarnessSeed(Seed);
+
+	OS_InitializeHeap();
+
+	if ((RegionID = AddHeapRegion((void*)RegionMemory, sizeof(RegionMemory), TRUE)) == INVALID_HEAP_REGION_ID || FuzzCheckIntegrityCanFail() == FALSE || FuzzCheckReallocKeepsAlignment() == FALSE)
+	{
+		fprintf(stderr, "the fuzzer could not be set up\n");
+
+		return 1;
+	}
+
+	for (Operation = 0; Operation < Operations; Operation++)
+	{
+		// five allocations, two resizes and five releases out of every twelve, so the heap neither fills up nor empties
+		Kind = HarnessRandom() % 12;
+
+		if (Kind >= 7)
+			Kind = 6;
+		else if (Kind == 6)
+			Kind = 5;
+
+		// keep the operations to ones which make sense with what is live
+		if (Count == HARNESS_MAXIMUM_FUZZ_BLOCKS)
+			Kind = 6;
+		else if (Count == 0 && Kind >= 5)
+			Kind = 0;
+
+		Calls[Kind]++;
+
+		// mostly small requests, sometimes one too big for the heap and now and then one that wraps if it is rounded up carelessly
+		SizeInBytes = HarnessRandom() % 8 != 0 ? HarnessRandomRange(1, 300) : HarnessRandomRange(1, OS_HEAP_SIZE_IN_BYTES + 1024);
+
+		if (HarnessRandom() % 64 == 0)
+			SizeInBytes = 0xFFFFFFFF - HarnessRandomRange(0, 2 * OS_WORD_SIZE_IN_BYTES);
+		AlignmentInBytes = OS_WORD_SIZE_IN_BYTES;
+		Index = Count != 0 ? HarnessRandom() % Count : 0;
+		Ptr = (void*)NULL;
+		Released = FALSE;
+
+		switch (Kind)
+		{
+			case 0:
+			{
+				if ((Ptr = AllocateMemory(SizeInBytes)) != (void*)NULL)
+					FuzzAddBlock(Blocks, &Count, Ptr, SizeInBytes, AlignmentInBytes, FUZZ_HEAP_BLOCK);
+
+				break;
+			}
+
+			case 1:
+			{
+				AlignmentInBytes = (UINT32)1 << HarnessRandomRange(0, 8);
+
+				if ((Ptr = AllocateAlignedMemory(SizeInBytes, AlignmentInBytes)) != (void*)NULL)
+				{
+					// anything under a word comes back word aligned
+					if (AlignmentInBytes < OS_WORD_SIZE_IN_BYTES)
+						AlignmentInBytes = OS_WORD_SIZE_IN_BYTES;
+
+					FuzzAddBlock(Blocks, &Count, Ptr, SizeInBytes, AlignmentInBytes, FUZZ_ALIGNED_BLOCK);
+				}
+
+				break;
+			}
+
+			case 2:
+			{
+				NumberOfItems = HarnessRandomRange(1, 16);
+				SizeInBytes = HarnessRandomRange(1, 24);
+
+				// dirty the memory first so zeroing it is not free
+				if ((Ptr = AllocateMemory(NumberOfItems * SizeInBytes + OS_WORD_SIZE_IN_BYTES)) != (void*)NULL)
+				{
+					memset(Ptr, 0xA5, NumberOfItems * SizeInBytes + OS_WORD_SIZE_IN_BYTES);
+
+					ReleaseMemory(Ptr);
+				}
+
+				if ((Ptr = CallocMemory(NumberOfItems, SizeInBytes)) != (void*)NULL)
+				{
+					for (i = 0; i < NumberOfItems * SizeInBytes; i++)
+					{
+						if (((BYTE*)Ptr)[i] != 0)
+						{
+							fprintf(stderr, "seed %u operation %u: CallocMemory(%u, %u) left byte %u set\n", Seed, Operation, NumberOfItems, SizeInBytes, i);
+
+							return 1;
+						}
+					}
+
+					FuzzAddBlock(Blocks, &Count, Ptr, NumberOfItems * SizeInBytes, AlignmentInBytes, FUZZ_HEAP_BLOCK);
+				}
+
+				break;
+			}
+
+			case 3:
+			{
+				if ((Ptr = AllocateMemoryFromRegion(RegionID, SizeInBytes)) != (void*)NULL)
+					FuzzAddBlock(Blocks, &Count, Ptr, SizeInBytes, AlignmentInBytes, FUZZ_REGION_BLOCK);
+
+				break;
+			}
+
+			case 4:
+			{
+				SizeInBytes = HarnessRandomRange(64, 2048);
+
+				if ((Ptr = OS_AllocateTaskStackMemory(SizeInBytes)) != (void*)NULL)
+					FuzzAddBlock(Blocks, &Count, Ptr, SizeInBytes, AlignmentInBytes, FUZZ_TASK_STACK_BLOCK);
+
+				break;
+			}
+
+			case 5:
+			{
+				Block = &Blocks[Index];
+
+				// TASK stacks can come from the TASK stack arena, which does not resize
+				if (Block->Kind == FUZZ_TASK_STACK_BLOCK)
+				{
+					Calls[Kind]--;
+
+					continue;
+				}
+
+				if ((Ptr = ReallocMemory(Block->Ptr, SizeInBytes)) != (void*)NULL)
+				{
+					if (Block->Kind == FUZZ_REGION_BLOCK && ((OS_WORD*)Ptr < RegionMemory || (OS_WORD*)Ptr >= &RegionMemory[HARNESS_FUZZ_REGION_SIZE_IN_WORDS]))
+					{
+						fprintf(stderr, "seed %u operation %u: ReallocMemory() moved a block out of its region\n", Seed, Operation);
+
+						return 1;
+					}
+
+					// what fits of the old contents has to have come along
+					if (SizeInBytes < Block->SizeInBytes)
+						Block->SizeInBytes = SizeInBytes;
+
+					Block->Ptr = (BYTE*)Ptr;
+
+					if (FuzzCheckBlock(Block) == FALSE)
+					{
+						fprintf(stderr, "seed %u operation %u: ReallocMemory() lost the contents or alignment of a block\n", Seed, Operation);
+
+						return 1;
+					}
+
+					Block->SizeInBytes = SizeInBytes;
+
+					memset(Block->Ptr, Block->Fill, SizeInBytes);
+				}
+
+				break;
+			}
+
+			default:
+			{
+				Block = &Blocks[Index];
+
+				if (FuzzCheckBlock(Block) == FALSE)
+				{
+					fprintf(stderr, "seed %u operation %u: a block was overwritten while it was live\n", Seed, Operation);
+
+					return 1;
+				}
+
+				if (ReleaseMemory(Block->Ptr) == FALSE)
+				{
+					fprintf(stderr, "seed %u operation %u: ReleaseMemory() refused a live block\n", Seed, Operation);
+
+					return 1;
+				}
+
+				// a block released twice has to be refused, not put on a free list again
+				if (HarnessRandom() % 16 == 0 && Block->Kind != FUZZ_TASK_STACK_BLOCK && ReleaseMemory(Block->Ptr) == TRUE)
+				{
+					fprintf(stderr, "seed %u operation %u: ReleaseMemory() took the same block twice\n", Seed, Operation);
+
+					return 1;
+				}
+
+				*Block = Blocks[--Count];
+
+				Released = TRUE;
+
+				break;
+			}
+		}
+
+		if (Ptr == (void*)NULL && Released == FALSE)
+			Failures[Kind]++;
+
+		if (CheckHeapIntegrity() == FALSE)
+		{
+			fprintf(stderr, "seed %u operation %u: CheckHeapIntegrity() failed after %s\n", Seed, Operation, OperationNames[Kind]);
+
+			return 1;
+		}
+	}
+
+	while (Count != 0)
+	{
+		if (FuzzCheckBlock(&Blocks[--Count]) == FALSE || ReleaseMemory(Blocks[Count].Ptr) == FALSE)
+		{
+			fprintf(stderr, "seed %u: a block was overwritten or could not be released at the end\n", Seed);
+
+			return 1;
+		}
+	}
+
+	if (CheckHeapIntegrity() == FALSE || GetHeapUsedInBytes() != 0)
+	{
+		fprintf(stderr, "seed %u: the heap did not come back whole\n", Seed);
+
+		return 1;
+	}
+
+	printf("allocator %s, seed %u, %u operations, heap intact after every one\n", HARNESS_ALLOCATOR_NAME, Seed, Operations);
+
+	for (i = 0; i < sizeof(Calls) / sizeof(Calls[0]); i++)
+		printf("    %-28s %8u calls %8u failed\n", OperationNames[i], Calls[i], Failures[i]);
+
+	return 0;
+}
+
+#if (USING_TASK_HEAP_ACCOUNTING == 1)
+	static TASK gAccountingTasks[HARNESS_ACCOUNTING_TASKS];
+	static ACCOUNTING_BLOCK gAccountingISRBlocks[HARNESS_MAXIMUM_ISR_BLOCKS];
+	static UINT32 gAccountingISRBlockCount;
+	static UINT32 gAccountingInterrupts;
+
+	// what a block counts for, the same as Memory.c charges its owner
+	static UINT32 AccountingBlockBytes(void *Ptr)
+	{
+		return (((OS_MEMORY_BLOCK_HEADER*)Ptr - 1)->SizeInWords * OS_WORD_SIZE_IN_BYTES) + OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES;
+	}
+
+	static void AccountingAddBlock(ACCOUNTING_BLOCK *Blocks, UINT32 *Count, void *Ptr, UINT32 SizeInBytes, TASK *Owner)
+	{
+		ACCOUNTING_BLOCK *Block = &Blocks[(*Count)++];
+
+		Block->Ptr = (BYTE*)Ptr;
+		Block->SizeInBytes = SizeInBytes;
+		Block->Owner = Owner;
+		Block->Fill = (BYTE)HarnessRandom();
+
+		memset(Block->Ptr, Block->Fill, SizeInBytes);
+	}
+
+	static BOOL AccountingCheckBlock(ACCOUNTING_BLOCK *Block)
+	{
+		UINT32 i;
+
+		if (((OS_MEMORY_BLOCK_HEADER*)Block->Ptr - 1)->Owner != (void*)Block->Owner)
+			return FALSE;
+
+		for (i = 0; i < Block->SizeInBytes; i++)
+			if (Block->Ptr[i] != Block->Fill)
+				return FALSE;
+
+		return TRUE;
+	}
+
+	/*
+		Stands in for an ISR, it allocates with AllocateMemoryFromISR() or releases one of
+		its own blocks now and then.  Inside of a reclaim that changes the heap between
+		chunks, which makes the reclaim start over.
+	*/
+	static void AccountingInterrupt(void)
+	{
+		UINT32 Index;
+		void *Ptr;
+
+		gAccountingInterrupts++;
+
+		if (HarnessRandom() % 4 != 0)
+			return;
+
+		if (gAccountingISRBlockCount == HARNESS_MAXIMUM_ISR_BLOCKS || (gAccountingISRBlockCount != 0 && HarnessRandom() % 2 == 0))
+		{
+			Index = HarnessRandom() % gAccountingISRBlockCount;
+
+			ReleaseMemory(gAccountingISRBlocks[Index].Ptr);
+
+			gAccountingISRBlocks[Index] = gAccountingISRBlocks[--gAccountingISRBlockCount];
+		}
+		else
+		{
+			Index = HarnessRandomRange(1, 64);
+
+			if ((Ptr = AllocateMemoryFromISR(Index)) != (void*)NULL)
+				AccountingAddBlock(gAccountingISRBlocks, &gAccountingISRBlockCount, Ptr, Index, (TASK*)NULL);
+		}
+	}
+
+	// every TASK has to own exactly the blocks the harness gave it, and nothing can have been written over
+	static BOOL AccountingCheck(ACCOUNTING_BLOCK *Blocks, UINT32 Count)
+	{
+		UINT32 UsedInBytes[HARNESS_ACCOUNTING_TASKS];
+		UINT32 i;
+
+		memset(UsedInBytes, 0, sizeof(UsedInBytes));
+
+		for (i = 0; i < Count; i++)
+		{
+			if (AccountingCheckBlock(&Blocks[i]) == FALSE)
+				return FALSE;
+
+			UsedInBytes[Blocks[i].Owner - gAccountingTasks] += AccountingBlockBytes(Blocks[i].Ptr);
+		}
+
+		for (i = 0; i < gAccountingISRBlockCount; i++)
+			if (AccountingCheckBlock(&gAccountingISRBlocks[i]) == FALSE)
+				return FALSE;
+
+		for (i = 0; i < HARNESS_ACCOUNTING_TASKS; i++)
+			if (gAccountingTasks[i].HeapUsedInBytes != UsedInBytes[i] || gAccountingTasks[i].MaximumHeapUsedInBytes < UsedInBytes[i])
+				return FALSE;
+
+		return CheckHeapIntegrity();
+	}
+
+	// TRUE if a quota should turn away a request, the same sum Memory.c does before it allocates
+	static BOOL AccountingQuotaRefuses(TASK *Task, UINT32 SizeInBytes)
+	{
+		UINT32 RequestInBytes = ((SizeInBytes + OS_WORD_SIZE_IN_BYTES - 1) & ~(OS_WORD_SIZE_IN_BYTES - 1)) + OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES;
+
+		return (BOOL)(Task->HeapQuotaInBytes != 0 && (Task->HeapUsedInBytes > Task->HeapQuotaInBytes || RequestInBytes > Task->HeapQuotaInBytes - Task->HeapUsedInBytes));
+	}
+
+	static int Accounting(UINT32 Seed, UINT32 Operations)
+	{
+		static ACCOUNTING_BLOCK Blocks[HARNESS_MAXIMUM_FUZZ_BLOCKS];
+		static const char *OperationNames[] = { "AllocateMemory", "AllocateAlignedMemory", "ReallocMemory", "ReleaseMemory", "OS_SetMemoryOwner", "TaskSetHeapQuota", "OS_ReleaseTaskMemory" };
+		ACCOUNTING_BLOCK *Block;
+		TASK *Task;
+		UINT32 Count = 0, Operation, Kind, Index, SizeInBytes, AlignmentInBytes, i;
+		UINT32 Calls[7], QuotaRefusals = 0, Reclaims = 0, ReclaimInterrupts = 0;
+		void *Ptr;
+
+		memset(Calls, 0, sizeof(Calls));
+
+		HarnessSeed(Seed);
+
+		OS_InitializeHeap();
+
+		gCPUSchedulerRunning = TRUE;
+
+		gHarnessInterrupt = AccountingInterrupt;
+
+		for (Operation = 0; Operation < Operations; Operation++)
+		{
+			gCurrentTask = Task = &gAccountingTasks[HarnessRandom() % HARNESS_ACCOUNTING_TASKS];
+
+			// mostly allocations and releases, with a quota change or a reclaim now and then
+			Kind = HarnessRandom() % 64;
+
+			if (Kind < 20)
+				Kind = 0;
+			else if (Kind < 26)
+				Kind = 1;
+			else if (Kind < 34)
+				Kind = 2;
+			else if (Kind < 58)
+				Kind = 3;
+			else if (Kind < 61)
+				Kind = 4;
+			else if (Kind < 63)
+				Kind = 5;
+			else
+				Kind = 6;
+
+			if (Count == HARNESS_MAXIMUM_FUZZ_BLOCKS)
+				Kind = 3;
+			else if (Count == 0 && (Kind >= 2 && Kind <= 4))
+				Kind = 0;
+
+			Calls[Kind]++;
+
+			SizeInBytes = HarnessRandomRange(1, 300);
+			Index = Count != 0 ? HarnessRandom() % Count : 0;
+
+			switch (Kind)
+			{
+				case 0:
+				case 1:
+				{
+					AlignmentInBytes = Kind == 1 ? (UINT32)1 << HarnessRandomRange(3, 7) : OS_WORD_SIZE_IN_BYTES;
+
+					if (AccountingQuotaRefuses(Task, SizeInBytes) == TRUE)
+					{
+						QuotaRefusals++;
+
+						if ((Kind == 0 ? AllocateMemory(SizeInBytes) : AllocateAlignedMemory(SizeInBytes, AlignmentInBytes)) != (void*)NULL)
+						{
+							fprintf(stderr, "seed %u operation %u: %s() let a TASK go over its quota\n", Seed, Operation, OperationNames[Kind]);
+
+							return 1;
+						}
+					}
+					else if ((Ptr = (Kind == 0 ? AllocateMemory(SizeInBytes) : AllocateAlignedMemory(SizeInBytes, AlignmentInBytes))) != (void*)NULL)
+					{
+						AccountingAddBlock(Blocks, &Count, Ptr, SizeInBytes, Task);
+					}
+
+					break;
+				}
+
+				case 2:
+				{
+					Block = &Blocks[Index];
+
+					// the block stays with whoever owns it, not with the TASK which resized it
+					if ((Ptr = ReallocMemory(Block->Ptr, SizeInBytes)) != (void*)NULL)
+					{
+						if (SizeInBytes < Block->SizeInBytes)
+							Block->SizeInBytes = SizeInBytes;
+
+						Block->Ptr = (BYTE*)Ptr;
+
+						if (AccountingCheckBlock(Block) == FALSE)
+						{
+							fprintf(stderr, "seed %u operation %u: ReallocMemory() lost the contents or owner of a block\n", Seed, Operation);
+
+							return 1;
+						}
+
+						Block->SizeInBytes = SizeInBytes;
+
+						memset(Block->Ptr, Block->Fill, SizeInBytes);
+					}
+
+					break;
+				}
+
+				case 3:
+				{
+					ReleaseMemory(Blocks[Index].Ptr);
+
+					Blocks[Index] = Blocks[--Count];
+
+					break;
+				}
+
+				case 4:
+				{
+					EnterCritical();
+
+					OS_SetMemoryOwner(Blocks[Index].Ptr, (void*)Task);
+
+					ExitCritical();
+
+					Blocks[Index].Owner = Task;
+
+					break;
+				}
+
+				case 5:
+				{
+					// a quota of 0 means no limit, otherwise small enough to be reached
+					Task->HeapQuotaInBytes = HarnessRandom() % 2 == 0 ? 0 : HarnessRandomRange(256, 4096);
+
+					break;
+				}
+
+				default:
+				{
+					i = gAccountingInterrupts;
+
+					OS_ReleaseTaskMemory((void*)Task);
+
+					Reclaims++;
+					ReclaimInterrupts += gAccountingInterrupts - i;
+
+					if (Task->HeapUsedInBytes != 0)
+					{
+						fprintf(stderr, "seed %u operation %u: a TASK still owns %u bytes after its memory was reclaimed\n", Seed, Operation, Task->HeapUsedInBytes);
+
+						return 1;
+					}
+
+					for (i = 0; i < Count; )
+					{
+						if (Blocks[i].Owner == Task)
+							Blocks[i] = Blocks[--Count];
+						else
+							i++;
+					}
+
+					break;
+				}
+			}
+
+			if (AccountingCheck(Blocks, Count) == FALSE)
+			{
+				fprintf(stderr, "seed %u operation %u: the heap or what a TASK owns is wrong after %s\n", Seed, Operation, OperationNames[Kind]);
+
+				return 1;
+			}
+		}
+
+		gHarnessInterrupt = (void(*)(void))NULL;
+
+		while (Count != 0)
+			ReleaseMemory(Blocks[--Count].Ptr);
+
+		while (gAccountingISRBlockCount != 0)
+			ReleaseMemory(gAccountingISRBlocks[--gAccountingISRBlockCount].Ptr);
+
+		for (i = 0; i < HARNESS_ACCOUNTING_TASKS; i++)
+		{
+			if (gAccountingTasks[i].HeapUsedInBytes != 0)
+			{
+				fprintf(stderr, "seed %u: TASK %u still owns %u bytes after every block was released\n", Seed, i, gAccountingTasks[i].HeapUsedInBytes);
+
+				return 1;
+			}
+		}
+
+		if (CheckHeapIntegrity() == FALSE || GetHeapUsedInBytes() != 0)
+		{
+			fprintf(stderr, "seed %u: the heap did not come back whole\n", Seed);
+
+			return 1;
+		}
+
+		// a reclaim which never lets an interrupt in is holding the critical section for the whole heap
+		if (Reclaims != 0 && ReclaimInterrupts <= Reclaims)
+		{
+			fprintf(stderr, "seed %u: OS_ReleaseTaskMemory() never left the critical section between chunks\n", Seed);
+
+			return 1;
+		}
+
+		printf("allocator %s, seed %u, %u operations, every TASK owned what it should after every one\n", HARNESS_ALLOCATOR_NAME, Seed, Operations);
+
+		for (i = 0; i < sizeof(Calls) / sizeof(Calls[0]); i++)
+			printf("    %-28s %8u calls\n", OperationNames[i], Calls[i]);
+
+		printf("    %u requests turned away by a quota, %u interrupts let in during %u reclaims\n", QuotaRefusals, ReclaimInterrupts, Reclaims);
+
+		return 0;
+	}
+#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
+
+static void Usage(void)
+{
+	fprintf(stderr, "usage: HeapHarness stress [Seed] [OperationsPerWorkload]\n");
+	fprintf(stderr, "       HeapHarness trace steady|mixed|sawtooth|growing [Seed] [Operations]\n");
+	fprintf(stderr, "       HeapHarness replay Trace...\n");
+	fprintf(stderr, "       HeapHarness fuzz [Seed] [Operations]\n");
+
+	#if (USING_TASK_HEAP_ACCOUNTING == 1)
+		fprintf(stderr, "       HeapHarness accounting [Seed] [Operations]\n");
+	#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
+
+	exit(2);
+}
+
+int main(int argc, char *argv[])
+{
+	UINT32 Seed, Operations;
+
+	if (argc < 2)
+		Usage();
+
+	if (strcmp(argv[1], "replay") == 0)
+	{
+		if (argc < 3)
+			Usage();
+
+		return Replay(argc - 2, &argv[2]);
+	}
+
+	if (strcmp(argv[1], "trace") == 0)
+	{
+		if (argc < 3)
+			Usage();
+
+		Seed = argc > 3 ? (UINT32)strtoul(argv[3], (char**)NULL, 0) : HARNESS_DEFAULT_SEED;
+		Operations = argc > 4 ? (UINT32)strtoul(argv[4], (char**)NULL, 0) : HARNESS_DEFAULT_OPERATIONS;
+
+		return Trace(argv[2], Seed, Operations);
+	}
+
+	Seed = argc > 2 ? (UINT32)strtoul(argv[2], (char**)NULL, 0) : HARNESS_DEFAULT_SEED;
+	Operations = argc > 3 ? (UINT32)strtoul(argv[3], (char**)NULL, 0) : HARNESS_DEFAULT_OPERATIONS;
+
+	if (strcmp(argv[1], "stress") == 0)
+		return Stress(Seed, Operations);
+
+	if (strcmp(argv[1], "fuzz") == 0)
+		return Fuzz(Seed, Operations);
+
+	#if (USING_TASK_HEAP_ACCOUNTING == 1)
+		if (strcmp(argv[1], "accounting") == 0)
+			return Accounting(Seed, Operations);
+	#endif // end of #if (USING_TASK_HEAP_ACCOUNTING == 1)
+
+	Usage();
+
+	return 2;
+}
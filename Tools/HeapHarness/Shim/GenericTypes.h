@@ -0,0 +1,65 @@
+/*
+    NexOS Kernel Version v1.02.01
+    Copyright (c) 2023 brodie
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+ */
+
+
+/*
+	Host stand in for Generic Libraries/GenericTypes.h.  That file makes UINT32 an
+	unsigned long, which is 64 bits on a 64 bit host, and the heap headers have to be
+	laid out exactly as they are on the PIC32 for Memory.c to behave the same.
+*/
+
+#ifndef __GENERIC_TYPE_DEFS_H_
+#define __GENERIC_TYPE_DEFS_H_
+#ifndef GENERIC_TYPES_H
+#define GENERIC_TYPES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef enum _BOOL { FALSE = 0, TRUE } BOOL;
+typedef enum _BIT { CLEAR = 0, SET } BIT;
+
+typedef int INT;
+typedef int8_t INT8;
+typedef int16_t INT16;
+typedef int32_t INT32;
+typedef int64_t INT64;
+
+typedef unsigned int UINT;
+typedef uint8_t UINT8;
+typedef uint16_t UINT16;
+typedef uint32_t UINT32;
+typedef uint64_t UINT64;
+
+typedef float FLOAT32;
+typedef double FLOAT64;
+
+typedef char CHAR8;
+typedef unsigned char UCHAR8;
+typedef uint8_t BYTE;
+typedef uint16_t WORD;
+typedef uint32_t DWORD;
+typedef uint64_t QWORD;
+
+#endif // end of #ifndef GENERIC_TYPES_H
+#endif // end of #ifndef __GENERIC_TYPE_DEFS_H_
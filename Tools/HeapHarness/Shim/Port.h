@@ -0,0 +1,56 @@
+/*
+    NexOS Kernel Version v1.02.01
+    Copyright (c) 2023 brodie
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+ */
+
+
+/*
+	Host stand in for Ports/PIC32MX/Port.h with only what Memory.c needs.
+*/
+
+#ifndef PORT_H
+	#define PORT_H
+
+#include "GenericTypes.h"
+
+#ifndef TASK_ENTRY_POINT_DATA_TYPE
+	#define TASK_ENTRY_POINT_DATA_TYPE
+
+	typedef UINT32 (*TASK_ENTRY_POINT)(void *);
+#endif // end of #ifndef TASK_ENTRY_POINT_DATA_TYPE
+
+#ifndef TASK_EXIT_POINT_DATA_TYPE
+	#define TASK_EXIT_POINT_DATA_TYPE
+
+	typedef void (*TASK_EXIT_CALLBACK)(void);
+#endif // end of #ifndef TASK_EXIT_POINT_DATA_TYPE
+
+// Memory.c keeps addresses in an OS_WORD, so the harness is linked with -no-pie to keep the heap below 4GB
+#define OS_WORD														UINT32
+#define OS_WORD_SIZE_IN_BYTES										4
+
+// only ProgramAddressValid() and RAMAddressValid() use these, the harness never calls them
+#define USER_PROGRAM_SIZE_IN_BYTES									0
+#define USER_RAM_SIZE_IN_BYTES										0
+
+#define PortCountLeadingZeros(Value)								(UINT32)__builtin_clz(Value)
+
+#endif // end of #ifndef PORT_H
@@ -0,0 +1,123 @@
+/*
+    NexOS Kernel Version v1.02.01
+    Copyright (c) 2023 brodie
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+ */
+
+
+/*
+	The harness builds Memory.c from the real NexOS/RTOSConfig.h, then turns on every
+	heap method it drives and turns off anything which needs the rest of the kernel.
+	HEAP_HARNESS_TLSF picks the allocator, the Makefile builds one binary of each.
+	HEAP_HARNESS_ACCOUNTING turns on the per TASK accounting, quota and reclaim.
+*/
+
+#ifndef HEAP_HARNESS_RTOS_CONFIG_H
+	#define HEAP_HARNESS_RTOS_CONFIG_H
+
+#include "../../../NexOS/RTOSConfig.h"
+
+#ifndef HEAP_HARNESS_TLSF
+	#define HEAP_HARNESS_TLSF										0
+#endif // end of #ifndef HEAP_HARNESS_TLSF
+
+#ifndef HEAP_HARNESS_ACCOUNTING
+	#define HEAP_HARNESS_ACCOUNTING									0
+#endif // end of #ifndef HEAP_HARNESS_ACCOUNTING
+
+#undef USING_TLSF_MEMORY_ALLOCATOR
+#define USING_TLSF_MEMORY_ALLOCATOR									HEAP_HARNESS_TLSF
+
+#undef OS_HEAP_SIZE_IN_BYTES
+#define OS_HEAP_SIZE_IN_BYTES										32768
+
+#undef TLSF_MAXIMUM_BLOCK_SIZE_LOG2
+#define TLSF_MAXIMUM_BLOCK_SIZE_LOG2								16
+
+#undef USING_CALLOC_MEMORY_METHOD
+#define USING_CALLOC_MEMORY_METHOD									1
+
+#undef USING_REALLOC_MEMORY_METHOD
+#define USING_REALLOC_MEMORY_METHOD									1
+
+#undef USING_ALLOCATE_ALIGNED_MEMORY_METHOD
+#define USING_ALLOCATE_ALIGNED_MEMORY_METHOD						1
+
+#undef USING_GET_HEAP_USED_IN_BYTES_METHOD
+#define USING_GET_HEAP_USED_IN_BYTES_METHOD							1
+
+#undef USING_GET_HEAP_REMAINING_IN_BYTES_METHOD
+#define USING_GET_HEAP_REMAINING_IN_BYTES_METHOD					1
+
+#undef USING_GET_HEAP_STATISTICS_METHOD
+#define USING_GET_HEAP_STATISTICS_METHOD							1
+
+#undef USING_CHECK_HEAP_INTEGRITY_METHOD
+#define USING_CHECK_HEAP_INTEGRITY_METHOD							1
+
+#undef USING_HEAP_REGIONS
+#define USING_HEAP_REGIONS											1
+
+#undef NUMBER_OF_HEAP_REGIONS
+#define NUMBER_OF_HEAP_REGIONS										2
+
+#undef USING_TASK_STACK_ARENA
+#define USING_TASK_STACK_ARENA										1
+
+#undef TASK_STACK_ARENA_SIZE_LOG2
+#define TASK_STACK_ARENA_SIZE_LOG2									14
+
+#undef TASK_STACK_ARENA_MINIMUM_BLOCK_SIZE_LOG2
+#define TASK_STACK_ARENA_MINIMUM_BLOCK_SIZE_LOG2					9
+
+#undef USING_TASK_HEAP_ACCOUNTING
+#define USING_TASK_HEAP_ACCOUNTING									HEAP_HARNESS_ACCOUNTING
+
+#undef USING_TASK_HEAP_QUOTA
+#define USING_TASK_HEAP_QUOTA										HEAP_HARNESS_ACCOUNTING
+
+#undef USING_TASK_HEAP_RECLAIM
+#define USING_TASK_HEAP_RECLAIM										HEAP_HARNESS_ACCOUNTING
+
+// the owner is a TASK pointer, which takes 8 bytes on a 64 bit host instead of the 4 the PIC32 gives it
+#undef OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES
+
+#if (HEAP_HARNESS_ACCOUNTING == 1)
+	#define OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES					16
+#else
+	#define OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES					8
+#endif // end of #if (HEAP_HARNESS_ACCOUNTING == 1)
+
+#undef USING_MEMORY_TRACE
+#define USING_MEMORY_TRACE											0
+
+#undef USING_MEMORY_WARNING_EVENT
+#define USING_MEMORY_WARNING_EVENT									0
+
+#undef USING_MEMORY_WARNING_CLEAR_EVENT
+#define USING_MEMORY_WARNING_CLEAR_EVENT							0
+
+#undef USING_MEMORY_WARNING_USER_CALLBACK
+#define USING_MEMORY_WARNING_USER_CALLBACK							0
+
+#undef USING_MEMORY_WARNING_CLEAR_USER_CALLBACK
+#define USING_MEMORY_WARNING_CLEAR_USER_CALLBACK					0
+
+#endif // end of #ifndef HEAP_HARNESS_RTOS_CONFIG_H
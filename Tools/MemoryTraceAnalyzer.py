@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+"""
+    NexOS memory trace analyzer
+
+    Reads the text written by IOBufferWriteMemoryTrace() (saved from a serial
+    terminal into one or more files, in order) and reports:
+
+        - the allocations still live at the end of the trace, grouped by the
+          code which made them
+        - call sites which look like they are leaking, their live blocks end
+          the trace at the highest point they ever reached
+        - the call sites which allocate most often
+
+    Each line of the trace is one of:
+
+        A <tick> <task> <caller> <ptr> <size>     an allocation
+        R <tick> <task> <caller> <ptr> <size>     a release
+        S <tick> <task> <caller> <ptr> <size>     a block resized in place
+        D <count>                                 records dropped on the target
+
+    The tick is the 32 bit OS tick count, which may wrap during a long trace.
+
+    Usage:
+        MemoryTraceAnalyzer.py [--tick-hz 1000] [--top 10] [--min-live 4]
+                               [--elf App.elf [--addr2line xc32-addr2line]] trace.txt...
+"""
+
+import argparse
+import subprocess
+import sys
+from collections import defaultdict
+
+
+class CallSite:
+    def __init__(self):
+        self.Allocations = 0
+        self.Releases = 0
+        self.LiveBlocks = 0
+        self.LiveBytes = 0
+        self.MaximumLiveBlocks = 0
+        self.Tasks = set()
+
+
+def ParseTrace(Files):
+    for FileName in Files:
+        with open(FileName, "r", errors="replace") as File:
+            for LineNumber, Line in enumerate(File, 1):
+                Fields = Line.split()
+
+                if not Fields:
+                    continue
+
+                if Fields[0] == "D" and len(Fields) == 2:
+                    yield ("D", 0, 0, 0, 0, int(Fields[1]))
+                elif Fields[0] in ("A", "R", "S") and len(Fields) == 6:
+                    try:
+                        yield (Fields[0], int(Fields[1]), int(Fields[2], 16), int(Fields[3], 16), int(Fields[4], 16), int(Fields[5]))
+                    except ValueError:
+                        print("%s:%d: skipping bad line" % (FileName, LineNumber), file=sys.stderr)
+                else:
+                    print("%s:%d: skipping bad line" % (FileName, LineNumber), file=sys.stderr)
+
+
+def Symbolize(Addresses, Elf, Addr2Line):
+    Names = {}
+
+    if Elf is None or not Addresses:
+        return Names
+
+    # the return address points after the call, back up one instruction to land on it
+    Sorted = sorted(Addresses)
+    Query = ["0x%08X" % max(Address - 4, 0) for Address in Sorted]
+
+    try:
+        Output = subprocess.run([Addr2Line, "-f", "-C", "-s", "-e", Elf] + Query, capture_output=True, text=True, check=True).stdout.split("\n")
+    except (OSError, subprocess.CalledProcessError) as Error:
+        print("could not run %s: %s" % (Addr2Line, Error), file=sys.stderr)
+        return Names
+
+    for i, Address in enumerate(Sorted):
+        if 2 * i + 1 < len(Output):
+            Names[Address] = "%s (%s)" % (Output[2 * i], Output[2 * i + 1])
+
+    return Names
+
+
+def Main():
+    Parser = argparse.ArgumentParser(description="Find leaks and allocation hotspots in a NexOS memory trace.")
+    Parser.add_argument("Trace", nargs="+", help="trace files in the order they were captured")
+    Parser.add_argument("--tick-hz", type=float, default=1000.0, help="OS ticks per second, default 1000")
+    Parser.add_argument("--top", type=int, default=10, help="how many call sites to list in each report")
+    Parser.add_argument("--min-live", type=int, default=4, help="live blocks a call site needs before it is called a leak")
+    Parser.add_argument("--elf", help="the application image, used to turn caller addresses into function names")
+    Parser.add_argument("--addr2line", default="xc32-addr2line", help="the addr2line to use with --elf")
+    Args = Parser.parse_args()
+
+    Sites = defaultdict(CallSite)
+    LiveBlocks = {}  # pointer -> (tick, task, caller, size), ticks are unwrapped
+    FirstTick = None
+    LastTick = 0
+    RawLastTick = 0
+    Dropped = 0
+    UnknownReleases = 0
+    MissedReleases = 0
+
+    def ReleaseBlock(Ptr):
+        AllocatedTick, AllocatedTask, AllocatedCaller, OldSize = LiveBlocks.pop(Ptr)
+        Site = Sites[AllocatedCaller]
+        Site.Releases += 1
+        Site.LiveBlocks -= 1
+        Site.LiveBytes -= OldSize
+
+    for Type, Tick, Task, Caller, Ptr, Size in ParseTrace(Args.Trace):
+        if Type == "D":
+            # anything could have happened in the gap, releases of blocks we never saw are expected after this
+            Dropped += Size
+            continue
+
+        # the OS tick count is a UINT32, count forward across a wrap so the times stay right
+        if FirstTick is None:
+            FirstTick = Tick
+            RawFirstTick = Tick
+            LastTick = Tick
+        else:
+            LastTick += (Tick - RawLastTick) & 0xFFFFFFFF
+
+        RawLastTick = Tick
+        Tick = LastTick
+
+        if Type == "A":
+            # the heap only hands out a live address once, so its release was lost
+            if Ptr in LiveBlocks:
+                MissedReleases += 1
+                ReleaseBlock(Ptr)
+
+            Site = Sites[Caller]
+            Site.Allocations += 1
+            Site.LiveBlocks += 1
+            Site.LiveBytes += Size
+            Site.Tasks.add(Task)
+
+            Site.MaximumLiveBlocks = max(Site.MaximumLiveBlocks, Site.LiveBlocks)
+
+            LiveBlocks[Ptr] = (Tick, Task, Caller, Size)
+        elif Type == "S":
+            if Ptr in LiveBlocks:
+                AllocatedTick, AllocatedTask, AllocatedCaller, OldSize = LiveBlocks[Ptr]
+                Sites[AllocatedCaller].LiveBytes += Size - OldSize
+                LiveBlocks[Ptr] = (AllocatedTick, AllocatedTask, AllocatedCaller, Size)
+        else:
+            if Ptr not in LiveBlocks:
+                UnknownReleases += 1
+                continue
+
+            ReleaseBlock(Ptr)
+
+    if FirstTick is None:
+        print("no records found")
+        return 1
+
+    Seconds = max(LastTick - FirstTick, 1) / Args.tick_hz
+    Names = Symbolize(set(Sites.keys()), Args.elf, Args.addr2line)
+
+    def Name(Caller):
+        return Names.get(Caller, "0x%08X" % Caller)
+
+    print("Trace covers ticks %u to %u (%.1f s)" % (RawFirstTick, RawLastTick, Seconds))
+
+    if Dropped or UnknownReleases or MissedReleases:
+        print("%u records were dropped on the target, %u releases had no allocation and %u blocks were allocated again without a release, results may be incomplete" % (Dropped, UnknownReleases, MissedReleases))
+
+    print("\nLive at end of trace: %u blocks, %u bytes" % (len(LiveBlocks), sum(Block[3] for Block in LiveBlocks.values())))
+    print("%-40s %8s %10s %12s" % ("call site", "blocks", "bytes", "oldest (s)"))
+
+    OldestTick = {}
+
+    for Tick, Task, Caller, Size in LiveBlocks.values():
+        OldestTick[Caller] = min(OldestTick.get(Caller, Tick), Tick)
+
+    ByBytes = sorted((Caller for Caller in Sites if Sites[Caller].LiveBlocks > 0), key=lambda Caller: -Sites[Caller].LiveBytes)
+
+    for Caller in ByBytes[:Args.top]:
+        print("%-40s %8u %10u %12.1f" % (Name(Caller), Sites[Caller].LiveBlocks, Sites[Caller].LiveBytes, (LastTick - OldestTick[Caller]) / Args.tick_hz))
+
+    print("\nLeak suspects (live blocks end the trace at their peak):")
+
+    Suspects = [Caller for Caller in ByBytes if Sites[Caller].LiveBlocks >= Args.min_live and Sites[Caller].LiveBlocks == Sites[Caller].MaximumLiveBlocks]
+
+    if not Suspects:
+        print("    none")
+
+    for Caller in Suspects[:Args.top]:
+        Site = Sites[Caller]
+        print("    %s: %u allocated, %u released, %u live, tasks %s" % (Name(Caller), Site.Allocations, Site.Releases, Site.LiveBlocks, " ".join("%08X" % Task for Task in sorted(Site.Tasks))))
+
+    print("\nAllocation hotspots:")
+    print("%-40s %10s %10s" % ("call site", "allocs", "per sec"))
+
+    for Caller in sorted(Sites, key=lambda Caller: -Sites[Caller].Allocations)[:Args.top]:
+        print("%-40s %10u %10.2f" % (Name(Caller), Sites[Caller].Allocations, Sites[Caller].Allocations / Seconds))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(Main())
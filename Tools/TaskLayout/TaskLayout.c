@@ -0,0 +1,64 @@
+/*
+    NexOS Kernel Version v1.02.01
+    Copyright (c) 2023 brodie
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+ */
+
+
+
+/*
+	Measures where the fields OS_NextTask() uses on every context switch sit inside
+	of a TASK.  Nothing here runs, every offset and size becomes the size of an array
+	so it can be read back with nm from the object file.  That way it works with any
+	compiler that targets a 32 bit CPU, including the one used for the PIC32.  See
+	TaskLayout.sh.
+*/
+
+#include <stddef.h>
+
+#include "TaskObject.h"
+
+#define TASK_LAYOUT_FIELD(Name, Field)		char TaskLayoutOffset_##Name[offsetof(TASK, Field) + 1];\
+											char TaskLayoutSize_##Name[sizeof(((TASK*)0)->Field) + 1];
+
+char TaskLayoutSize_TASK[sizeof(TASK) + 1];
+
+TASK_LAYOUT_FIELD(TaskStackPointer, TaskStackPointer)
+TASK_LAYOUT_FIELD(CriticalCount, CriticalCount)
+TASK_LAYOUT_FIELD(TaskInfo, TaskInfo)
+
+#if (USING_DELETE_TASK == 1) || (USING_RESTART_TASK == 1) || (ANALYZE_TASK_STACK_USAGE == 1) || (USING_CHECK_TASK_STACK_FOR_OVERFLOW == 1) || (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+	TASK_LAYOUT_FIELD(StartOfTaskStackPointer, StartOfTaskStackPointer)
+#endif // end of using task restart or delete task
+
+#if (ANALYZE_TASK_STACK_USAGE == 1) || (USING_CHECK_TASK_STACK_FOR_OVERFLOW == 1) || (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+	TASK_LAYOUT_FIELD(StartingTaskStackSizeInWords, StartingTaskStackSizeInWords)
+#endif // end of #if (ANALYZE_TASK_STACK_USAGE == 1) || (USING_CHECK_TASK_STACK_FOR_OVERFLOW == 1) || (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+
+#if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+	TASK_LAYOUT_FIELD(LowestTaskStackPointer, LowestTaskStackPointer)
+#endif // end of #if (USING_TASK_STACK_HIGH_WATER_MARK == 1)
+
+#if (USING_TASK_RUNTIME_EXECUTION_COUNTER == 1)
+	TASK_LAYOUT_FIELD(TaskRunTime, TaskRunTime)
+#endif // end of #if (USING_TASK_RUNTIME_EXECUTION_COUNTER == 1)
+
+// the ready queue is walked through the PRIMARY_TASK_NODE of every TASK on it
+TASK_LAYOUT_FIELD(PrimaryTaskNode, TaskNodeArray[PRIMARY_TASK_NODE])
@@ -0,0 +1,69 @@
+#!/bin/sh
+#
+# Prints how many cache lines the fields OS_NextTask() uses on every context switch
+# are spread over inside of a TASK, for 16 and 32 byte lines.  It is run once with
+# NexOS/RTOSConfig.h as it is and once with every USING_ and ANALYZE_ option on.
+#
+#   ./TaskLayout.sh                      uses cc -m32, TaskLayoutResults.txt is its output
+#   CC=xc32-gcc NM=xc32-nm ./TaskLayout.sh
+#
+# The TASK is assumed to start on a line, a TASK from the heap may not, which can
+# add one line to each count.
+
+CC=${CC:-cc -m32}
+NM=${NM:-nm}
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+ROOT=$HERE/../..
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+mkdir "$WORK/Shipped" "$WORK/Everything"
+cp "$ROOT/NexOS/RTOSConfig.h" "$WORK/Shipped/RTOSConfig.h"
+sed -E -e 's/^(#define (USING_[A-Z0-9_]+|ANALYZE_[A-Z_]+)[[:space:]]+)0/\11/' \
+	-e 's/^(#define NUMBER_OF_LOCAL_THREAD_STORAGE_POINTERS[[:space:]]+)0/\14/' \
+	-e 's/^(#define TASK_STACK_HIGH_WATER_MARK_GUARD_WORDS[[:space:]]+)0/\14/' \
+	-e 's/^(#define OS_MEMORY_BLOCK_HEADER_SIZE_IN_BYTES[[:space:]]+)4/\18/' \
+	"$ROOT/NexOS/RTOSConfig.h" > "$WORK/Everything/RTOSConfig.h"
+
+for Config in Shipped Everything
+do
+	$CC -c -std=gnu99 -fcommon -w -I"$WORK/$Config" -I"$HERE/Shim" -I"$ROOT/NexOS/Kernel" -I"$ROOT/Generic Libraries" -I"$ROOT" \
+		"$HERE/TaskLayout.c" -o "$WORK/$Config.o" || exit 1
+
+	echo "$Config RTOSConfig.h"
+
+	# every symbol is one byte bigger than what it measures so none are empty
+	$NM -S "$WORK/$Config.o" | while read Address Size Type Name
+	do
+		echo "$Name $(( 0x$Size - 1 ))"
+	done | sort -k 2 -n | awk '
+		/^TaskLayoutSize_TASK / { TaskSize = $2; next }
+		/^TaskLayoutSize_/ { sub(/^TaskLayoutSize_/, "", $1); Size[$1] = $2; next }
+		/^TaskLayoutOffset_/ { sub(/^TaskLayoutOffset_/, "", $1); Name[Fields++] = $1; Offset[$1] = $2; next }
+		END {
+			printf "  sizeof(TASK) %u bytes\n", TaskSize
+			printf "  %-30s %6s %4s\n", "switch time field", "offset", "size"
+
+			for (i = 0; i < Fields; i++)
+			{
+				printf "  %-30s %6u %4u\n", Name[i], Offset[Name[i]], Size[Name[i]]
+
+				for (Line = 16; Line <= 32; Line *= 2)
+					for (Byte = Offset[Name[i]]; Byte < Offset[Name[i]] + Size[Name[i]]; Byte++)
+						Touched[Line, int(Byte / Line)] = 1
+
+				HotBytes += Size[Name[i]]
+			}
+
+			for (Line = 16; Line <= 32; Line *= 2)
+			{
+				Lines = 0
+
+				for (Index = 0; Index * Line < TaskSize; Index++)
+					Lines += Touched[Line, Index]
+
+				printf "  %u bytes of switch time fields on %u of %u %u byte lines\n", HotBytes, Lines, int((TaskSize + Line - 1) / Line), Line
+			}
+		}'
+done